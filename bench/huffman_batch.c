@@ -0,0 +1,133 @@
+// Compares the batch huffman functions with calling the single buffer
+// functions in a loop. The payloads look like snapshot deltas: packed ints
+// that are mostly zero or small.
+//
+// cmake -B build -DBENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+// cmake --build build --target huffman_batch
+// ./build/bench/huffman_batch
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <ddnet_protocol/huffman.h>
+#include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/packet.h>
+
+#define NUM_PACKETS 64
+#define ROUNDS 200
+#define RUNS 50
+
+static uint8_t payloads[NUM_PACKETS][DDPROTO_MAX_PACKET_SIZE];
+static size_t payload_lens[NUM_PACKETS];
+static uint8_t compressed[NUM_PACKETS][DDPROTO_MAX_PACKET_SIZE * 2];
+static size_t compressed_lens[NUM_PACKETS];
+static uint8_t output[NUM_PACKETS][DDPROTO_MAX_PACKET_SIZE * 2];
+static DDProtoHuffmanBuffer buffers[NUM_PACKETS];
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static uint32_t next_random(uint32_t *state) {
+	*state = *state * 1103515245 + 12345;
+	return *state >> 16;
+}
+
+static void fill_payloads(void) {
+	uint32_t state = 42;
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		// between 400 and 1300 bytes
+		size_t target = 400 + next_random(&state) % 900;
+		DDProtoPackerBuffer packer_buffer;
+		DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+		while(ddproto_packer_size(packer) < target) {
+			uint32_t rand = next_random(&state);
+			int32_t value = 0;
+			if(rand % 3 == 0) {
+				value = (int32_t)(next_random(&state) % 64) - 32;
+			} else if(rand % 7 == 0) {
+				value = (int32_t)next_random(&state) * 1000;
+			}
+			ddproto_packer_add_int(packer, value);
+		}
+		payload_lens[i] = ddproto_packer_size(packer);
+		memcpy(payloads[i], ddproto_packer_data(packer), payload_lens[i]);
+
+		DDProtoError err = DDPROTO_ERR_NONE;
+		compressed_lens[i] = ddproto_huffman_compress(payloads[i], payload_lens[i], compressed[i], sizeof(compressed[i]), &err);
+	}
+}
+
+static void compress_single(void) {
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		DDProtoError err = DDPROTO_ERR_NONE;
+		ddproto_huffman_compress(payloads[i], payload_lens[i], output[i], sizeof(output[i]), &err);
+	}
+}
+
+static void compress_batch(void) {
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		buffers[i] = (DDProtoHuffmanBuffer){payloads[i], payload_lens[i], output[i], sizeof(output[i]), 0, DDPROTO_ERR_NONE};
+	}
+	ddproto_huffman_compress_batch(ddproto_huffman_default(), buffers, NUM_PACKETS);
+}
+
+static void decompress_single(void) {
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		DDProtoError err = DDPROTO_ERR_NONE;
+		ddproto_huffman_decompress(compressed[i], compressed_lens[i], output[i], sizeof(output[i]), &err);
+	}
+}
+
+static void decompress_batch(void) {
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		buffers[i] = (DDProtoHuffmanBuffer){compressed[i], compressed_lens[i], output[i], sizeof(output[i]), 0, DDPROTO_ERR_NONE};
+	}
+	ddproto_huffman_decompress_batch(ddproto_huffman_default(), buffers, NUM_PACKETS);
+}
+
+// time per packet in nanoseconds
+static double measure(void (*run)(void)) {
+	double start = now();
+	for(int i = 0; i < ROUNDS; i++) {
+		run();
+	}
+	return (now() - start) * 1e9 / ((double)ROUNDS * NUM_PACKETS);
+}
+
+// the runs alternate between both functions and the best one is kept, so
+// noise from other processes affects both the same way
+static void report(const char *name, void (*single)(void), void (*batch)(void)) {
+	double single_ns = 0;
+	double batch_ns = 0;
+	for(int r = 0; r < RUNS; r++) {
+		double single_run = measure(single);
+		double batch_run = measure(batch);
+		if(r == 0 || single_run < single_ns) {
+			single_ns = single_run;
+		}
+		if(r == 0 || batch_run < batch_ns) {
+			batch_ns = batch_run;
+		}
+	}
+	printf("%-10s single %8.1f ns/packet  batch %8.1f ns/packet  speedup %.2fx\n", name, single_ns, batch_ns, single_ns / batch_ns);
+}
+
+int main(void) {
+	fill_payloads();
+
+	size_t total = 0;
+	size_t total_compressed = 0;
+	for(int i = 0; i < NUM_PACKETS; i++) {
+		total += payload_lens[i];
+		total_compressed += compressed_lens[i];
+	}
+	printf("%d packets, %zu bytes, %zu bytes compressed\n", NUM_PACKETS, total, total_compressed);
+
+	report("compress", compress_single, compress_batch);
+	report("decompress", decompress_single, decompress_batch);
+}
@@ -0,0 +1,145 @@
+// Compares the vectorized string cleanup with the byte by byte loops it
+// replaced. The inputs are a long MOTD with line breaks and a batch of rcon
+// output lines. The UTF-8 check of the MOTD is compared with copying it.
+//
+// cmake -B build -DBENCHMARKS=ON -DCMAKE_BUILD_TYPE=Release
+// cmake --build build --target str_sanitize
+// ./build/bench/str_sanitize
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include <ddnet_protocol/int_string.h>
+#include <ddnet_protocol/packer.h>
+
+#define NUM_LINES 64
+#define ROUNDS 2000
+#define RUNS 20
+
+static char motd[1024];
+static char lines[NUM_LINES][256];
+static char work[NUM_LINES][256];
+
+static double now(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void fill_strings(void) {
+	const char *motd_line = "Welcome to the server! Please read the rules:\n\tno blocking, no cheating,  be nice\n";
+	while(strlen(motd) + strlen(motd_line) < sizeof(motd)) {
+		strcat(motd, motd_line);
+	}
+
+	for(int i = 0; i < NUM_LINES; i++) {
+		snprintf(lines[i], sizeof(lines[i]), "[%d][server]: ClientId=%d addr=<{127.0.0.1:8303}> name='nameless tee'  clan='' country=-1 \x1b[0m", i, i % 64);
+	}
+}
+
+static void reference_sanitize(char *str) {
+	for(; *str; str++) {
+		if((uint8_t)*str < 32 && *str != '\r' && *str != '\n' && *str != '\t') {
+			*str = ' ';
+		}
+	}
+}
+
+static void reference_clean_whitespaces(char *str) {
+	char *read = str;
+	char *write = str;
+	while(*read == ' ') {
+		read++;
+	}
+	while(true) {
+		bool found_whitespace = false;
+		for(; *read == ' '; read++) {
+			found_whitespace = true;
+		}
+		if(!*read) {
+			*write = 0;
+			break;
+		}
+		if(found_whitespace) {
+			*write++ = ' ';
+		}
+		*write++ = *read++;
+	}
+}
+
+static char motd_work[sizeof(motd)];
+
+static void motd_reference(void) {
+	memcpy(motd_work, motd, sizeof(motd));
+	reference_sanitize(motd_work);
+}
+
+static void motd_library(void) {
+	memcpy(motd_work, motd, sizeof(motd));
+	ddproto_str_sanitize(motd_work);
+}
+
+static void rcon_reference(void) {
+	for(int i = 0; i < NUM_LINES; i++) {
+		memcpy(work[i], lines[i], sizeof(lines[i]));
+		reference_sanitize(work[i]);
+		reference_clean_whitespaces(work[i]);
+	}
+}
+
+static void rcon_library(void) {
+	for(int i = 0; i < NUM_LINES; i++) {
+		memcpy(work[i], lines[i], sizeof(lines[i]));
+		ddproto_str_sanitize(work[i]);
+		ddproto_str_clean_whitespaces(work[i]);
+	}
+}
+
+static volatile bool motd_valid;
+
+static void utf8_memcpy(void) {
+	memcpy(motd_work, motd, sizeof(motd));
+}
+
+static void utf8_library(void) {
+	motd_valid = ddproto_str_is_utf8(motd, sizeof(motd) - 1);
+}
+
+// time per call of `run` in nanoseconds
+static double measure(void (*run)(void)) {
+	double start = now();
+	for(int i = 0; i < ROUNDS; i++) {
+		run();
+	}
+	return (now() - start) * 1e9 / ROUNDS;
+}
+
+// the runs alternate between both functions and the best one is kept, so
+// noise from other processes affects both the same way
+static void report(const char *name, void (*reference)(void), void (*library)(void)) {
+	double reference_ns = 0;
+	double library_ns = 0;
+	for(int r = 0; r < RUNS; r++) {
+		double reference_run = measure(reference);
+		double library_run = measure(library);
+		if(r == 0 || reference_run < reference_ns) {
+			reference_ns = reference_run;
+		}
+		if(r == 0 || library_run < library_ns) {
+			library_ns = library_run;
+		}
+	}
+	printf("%-5s reference %8.1f ns  library %8.1f ns  speedup %.2fx\n", name, reference_ns, library_ns, reference_ns / library_ns);
+}
+
+int main(void) {
+	fill_strings();
+	printf("motd %zu bytes, %d rcon lines of %zu bytes\n", strlen(motd), NUM_LINES, strlen(lines[0]));
+
+	report("motd", motd_reference, motd_library);
+	report("rcon", rcon_reference, rcon_library);
+	report("utf8", utf8_memcpy, utf8_library);
+}
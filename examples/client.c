@@ -94,7 +94,7 @@ void twclient_send_packet(TwClient *client, DDProtoPacket *packet) {
 	}
 	uint8_t buf[DDPROTO_MAX_PACKET_SIZE];
 	DDProtoError err = DDPROTO_ERR_NONE;
-	size_t len = ddproto_encode_packet(packet, buf, sizeof(buf), &err);
+	size_t len = ddproto_encode_packet_with_compression(packet, buf, sizeof(buf), DDPROTO_COMPRESSION_AUTO, &err);
 	if(err != DDPROTO_ERR_NONE) {
 		fprintf(stderr, "encode error=%d\n", err);
 		return;
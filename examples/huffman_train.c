@@ -0,0 +1,88 @@
+// Trains a huffman frequency table on captured packet payloads and reports
+// how well the default and the trained table compress them.
+//
+// usage: huffman_train <payload file>...
+//
+// Every file contains one uncompressed packet payload. The trained table is
+// printed as a C array that can be passed to ddproto_huffman_new.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <ddnet_protocol/huffman.h>
+
+typedef struct {
+	uint8_t *data;
+	size_t len;
+} Payload;
+
+static bool read_file(const char *path, Payload *payload) {
+	FILE *file = fopen(path, "rb");
+	if(!file) {
+		perror(path);
+		return false;
+	}
+	fseek(file, 0, SEEK_END);
+	long len = ftell(file);
+	if(len < 0) {
+		len = 0;
+	}
+	fseek(file, 0, SEEK_SET);
+	payload->data = malloc(len + 1);
+	payload->len = fread(payload->data, 1, len, file);
+	fclose(file);
+	return true;
+}
+
+static void report(const char *name, const DDProtoHuffman *huffman, const Payload *payloads, int num_payloads) {
+	size_t total = 0;
+	size_t compressed = 0;
+	for(int i = 0; i < num_payloads; i++) {
+		total += payloads[i].len;
+		compressed += ddproto_huffman_compressed_size(huffman, payloads[i].data, payloads[i].len);
+	}
+	fprintf(stderr, "%-8s %zu -> %zu bytes, ratio %.3f\n", name, total, compressed, total ? (double)compressed / total : 0.0);
+}
+
+int main(int argc, char **argv) {
+	if(argc < 2) {
+		fprintf(stderr, "usage: %s <payload file>...\n", argv[0]);
+		return 1;
+	}
+
+	int num_payloads = argc - 1;
+	Payload *payloads = calloc(num_payloads, sizeof(Payload));
+
+	// start at 1 so bytes that are not in the corpus still get a usable code
+	uint32_t frequencies[256];
+	for(int i = 0; i < 256; i++) {
+		frequencies[i] = 1;
+	}
+	for(int i = 0; i < num_payloads; i++) {
+		if(!read_file(argv[i + 1], &payloads[i])) {
+			return 1;
+		}
+		ddproto_huffman_count_frequencies(frequencies, payloads[i].data, payloads[i].len);
+	}
+
+	DDProtoHuffman *trained = ddproto_huffman_new(frequencies);
+	if(!trained) {
+		fprintf(stderr, "failed to build the trained table\n");
+		return 1;
+	}
+	report("default", ddproto_huffman_default(), payloads, num_payloads);
+	report("trained", trained, payloads, num_payloads);
+
+	printf("static const uint32_t FREQUENCY_TABLE[256] = {\n");
+	for(int i = 0; i < 256; i++) {
+		printf("%s%u,%s", i % 16 == 0 ? "\t" : "", frequencies[i], i % 16 == 15 ? "\n" : " ");
+	}
+	printf("};\n");
+
+	ddproto_huffman_free(trained);
+	for(int i = 0; i < num_payloads; i++) {
+		free(payloads[i].data);
+	}
+	free(payloads);
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "common.h"
+
+/// @brief Heap allocator used by the library.
+///
+/// All memory the library allocates on the heap comes from an allocator. By
+/// default that is @ref ddproto_default_allocator which calls `malloc` and
+/// `free`. Replace it with @ref ddproto_set_allocator or pass one to a single
+/// call, for example @ref ddproto_decode_packet_with_allocator.
+///
+/// ```C
+/// static void *pool_alloc(void *ctx, size_t size) {
+/// 	return pool_get(ctx, size);
+/// }
+///
+/// static void pool_free(void *ctx, void *ptr) {
+/// 	pool_put(ctx, ptr);
+/// }
+///
+/// DDProtoAllocator allocator = {
+/// 	.alloc = pool_alloc,
+/// 	.free = pool_free,
+/// 	.ctx = &pool,
+/// };
+/// ddproto_set_allocator(&allocator);
+/// ```
+///
+/// The counters are updated by @ref ddproto_alloc and @ref ddproto_free. They
+/// are not atomic, use one allocator per thread if the counters matter.
+typedef struct DDProtoAllocator {
+	/// Returns `size` bytes of memory or `NULL` if there is not enough.
+	void *(*alloc)(void *ctx, size_t size);
+
+	/// Frees memory returned by `alloc`. Never called with `NULL`.
+	void (*free)(void *ctx, void *ptr);
+
+	/// Passed to `alloc` and `free`.
+	void *ctx;
+
+	/// Amount of successful allocations.
+	size_t alloc_calls;
+
+	/// Sum of the sizes of all successful allocations in bytes.
+	size_t alloc_bytes;
+
+	/// Amount of freed allocations.
+	size_t free_calls;
+} DDProtoAllocator;
+
+/// Returns the allocator that calls `malloc` and `free`.
+DDProtoAllocator *ddproto_default_allocator(void);
+
+/// Returns the allocator used if no other one is passed.
+DDProtoAllocator *ddproto_allocator(void);
+
+/// @brief Replaces the allocator used if no other one is passed.
+///
+/// `NULL` restores @ref ddproto_default_allocator. Memory has to be freed by
+/// the allocator it was allocated by, so set it before anything is allocated
+/// or after everything is freed.
+void ddproto_set_allocator(DDProtoAllocator *allocator);
+
+/// Allocates `size` bytes from `allocator` or from @ref ddproto_allocator if it
+/// is `NULL`. Returns `NULL` if the allocation failed.
+void *ddproto_alloc(DDProtoAllocator *allocator, size_t size);
+
+/// Frees `ptr` which has to be allocated by @ref ddproto_alloc with the same
+/// `allocator`. Does nothing if `ptr` is `NULL`.
+void ddproto_free(DDProtoAllocator *allocator, void *ptr);
+
+#ifdef __cplusplus
+}
+#endif
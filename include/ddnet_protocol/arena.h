@@ -0,0 +1,81 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "common.h"
+
+/// Alignment in bytes of all memory returned by @ref ddproto_arena_alloc.
+#define DDPROTO_ARENA_ALIGNMENT 16
+
+/// Size in bytes of the first block of an arena if @ref ddproto_arena_init is
+/// called with a block size of 0.
+#define DDPROTO_ARENA_DEFAULT_BLOCK_SIZE (64 * 1024)
+
+/// One block of memory of a @ref DDProtoArena. The fields are internal. The
+/// memory handed out follows right after the block header.
+typedef struct DDProtoArenaBlock {
+	struct DDProtoArenaBlock *next;
+	size_t size;
+	size_t used;
+} DDProtoArenaBlock;
+
+/// @brief Bump allocator for decoded data.
+///
+/// Memory is handed out from big blocks and never freed on its own. Instead
+/// everything is released at once with @ref ddproto_arena_reset, for example
+/// after every tick. The blocks are kept so decoding the next tick does not
+/// allocate again.
+///
+/// ```C
+/// DDProtoArena arena;
+/// ddproto_arena_init(&arena, 0);
+/// while(running) {
+/// 	DDProtoPacket packet = ddproto_decode_packet_arena(buf, len, &arena, &err);
+/// 	// ...
+/// 	ddproto_arena_reset(&arena);
+/// }
+/// ddproto_arena_free(&arena);
+/// ```
+///
+/// Set the `arena` field of a @ref DDProtoUnpacker to decode snapshots into
+/// an arena.
+typedef struct DDProtoArena {
+	/// The block that is allocated from. It links to the older blocks which
+	/// are full.
+	DDProtoArenaBlock *blocks;
+
+	/// Size of the next block that is allocated.
+	size_t block_size;
+} DDProtoArena;
+
+/// Initializes an empty arena. It does not allocate until the first
+/// allocation. If `block_size` is 0 @ref DDPROTO_ARENA_DEFAULT_BLOCK_SIZE is
+/// used.
+void ddproto_arena_init(DDProtoArena *arena, size_t block_size);
+
+/// Frees all blocks of the arena. All memory allocated from it becomes
+/// invalid.
+void ddproto_arena_free(DDProtoArena *arena);
+
+/// @brief Returns `size` bytes of memory owned by the arena.
+///
+/// The memory is aligned to @ref DDPROTO_ARENA_ALIGNMENT. If the current block
+/// is full a new one is allocated that is big enough. Returns `NULL` if no
+/// memory could be allocated.
+void *ddproto_arena_alloc(DDProtoArena *arena, size_t size);
+
+/// @brief Releases all memory allocated from the arena at once.
+///
+/// The capacity is kept. If the arena grew to multiple blocks they are
+/// replaced by a single block of their combined size, so the same amount of
+/// allocations fits without allocating again.
+void ddproto_arena_reset(DDProtoArena *arena);
+
+/// Returns the combined size in bytes of all blocks of the arena.
+size_t ddproto_arena_capacity(const DDProtoArena *arena);
+
+#ifdef __cplusplus
+}
+#endif
@@ -105,6 +105,15 @@ typedef enum {
 	DDPROTO_MSG_KIND_CL_STARTINFO,
 } DDProtoMessageKind;
 
+/// @brief Bit of `kind` in a mask of message kinds.
+///
+/// Used for @ref DDProtoDecodeOptions.kinds to only decode some messages.
+///
+/// ```C
+/// options.kinds = DDPROTO_MSG_KIND_BIT(DDPROTO_MSG_KIND_SV_CHAT) | DDPROTO_MSG_KIND_BIT(DDPROTO_MSG_KIND_SV_KILLMSG);
+/// ```
+#define DDPROTO_MSG_KIND_BIT(kind) ((uint64_t)1 << (kind))
+
 /// Union abstracting away any kind of game or system message. Check the
 /// @ref DDProtoMessageKind to know which one to use.
 typedef union {
@@ -116,7 +125,10 @@ typedef union {
 	DDProtoMsgInfo info;
 	DDProtoMsgMapChange map_change;
 	DDProtoMsgMapData map_data;
+	DDProtoMsgSnap snap;
+	DDProtoMsgSnapEmpty snap_empty;
 	DDProtoMsgSnapSingle snap_single;
+	DDProtoMsgSnapSmall snap_small;
 	DDProtoMsgInputTiming input_timing;
 	DDProtoMsgRconAuthStatus rcon_auth_status;
 	DDProtoMsgRconLine rcon_line;
@@ -159,6 +171,25 @@ typedef struct {
 	DDProtoMessage payload;
 } DDProtoChunk;
 
+/// @brief A chunk whose message is not decoded yet.
+///
+/// Produced by @ref ddproto_index_chunks. Check the message with @ref
+/// ddproto_lazy_chunk_message_id and decode only the ones that are needed with
+/// @ref ddproto_decode_lazy_chunk.
+typedef struct {
+	DDProtoChunkHeader header;
+
+	/// Chunk payload of @ref DDProtoChunkHeader.size bytes starting with the
+	/// message id.
+	const uint8_t *payload;
+
+	/// Where the strings that have to be sanitized are copied to if the
+	/// options have no string buffer of their own, see @ref
+	/// DDProtoDecodeOptions.strings. Set by @ref ddproto_decode_packet_lazy,
+	/// `NULL` otherwise.
+	struct DDProtoStringBuffer *strings;
+} DDProtoLazyChunk;
+
 /// Returns true if the passed in message kind is a vital message.
 /// Vital messages are reliable and should be resend if they are not
 /// acknowledged by the peer. Not all messages are vital to improve performance
@@ -21,7 +21,10 @@ extern "C" {
 	X(DDPROTO_ERR_MISSING_DDNET_SECURITY_TOKEN) \
 	X(DDPROTO_ERR_HUFFMAN_NODE_NULL) \
 	X(DDPROTO_ERR_MESSAGE_ID_OUT_OF_BOUNDS) \
-	X(DDPROTO_ERR_ACK_OUT_OF_BOUNDS)
+	X(DDPROTO_ERR_ACK_OUT_OF_BOUNDS) \
+	X(DDPROTO_ERR_INVALID_UTF8) \
+	X(DDPROTO_ERR_OUT_OF_MEMORY) \
+	X(DDPROTO_ERR_STRING_TABLE_FULL)
 
 /// Generic error enum, holds all kinds of errors returned by different
 /// functions.
@@ -7,15 +7,89 @@ extern "C" {
 #include "chunk.h"
 #include "common.h"
 #include "errors.h"
+#include "packer.h"
 #include "packet.h"
 
 typedef void (*OnDDProtoChunk)(void *ctx, DDProtoChunk *chunk);
 
+/// @brief Walks over the chunks of a packet payload one by one.
+///
+/// Every call of @ref ddproto_chunk_iterator_next decodes the next chunk
+/// straight into the chunk passed in. Nothing is copied or allocated except
+/// the snapshots of the messages.
+///
+/// ```C
+/// DDProtoChunkIterator iter;
+/// ddproto_chunk_iterator_init(&iter, payload, payload_len, &header);
+/// DDProtoChunk chunk;
+/// while(ddproto_chunk_iterator_next(&iter, &chunk)) {
+/// 	// use chunk, iter.raw and iter.raw_len
+/// }
+/// if(iter.err != DDPROTO_ERR_NONE) {
+/// 	// broken payload
+/// }
+/// ```
+typedef struct {
+	/// Set if a chunk could not be read or decoded. The iterator stops then.
+	DDProtoError err;
+
+	/// Options every message is unpacked with. `NULL` for the defaults, set it
+	/// after @ref ddproto_chunk_iterator_init.
+	const DDProtoDecodeOptions *options;
+
+	/// The last chunk returned including its chunk header as it is in the
+	/// payload. It can be copied into another payload without decoding it.
+	const uint8_t *raw;
+	size_t raw_len;
+
+	// remaining payload
+	const uint8_t *start;
+	const uint8_t *buf;
+	const uint8_t *end;
+
+	uint8_t num_chunks;
+	uint8_t chunk;
+} DDProtoChunkIterator;
+
+/// Initializes an iterator over the `header->num_chunks` chunks at the start of
+/// `buf`, a packet payload without packet header.
+void ddproto_chunk_iterator_init(DDProtoChunkIterator *iter, const uint8_t *buf, size_t len, const DDProtoPacketHeader *header);
+
+/// @brief Decodes the next chunk into `chunk`.
+///
+/// Returns false if there are no chunks left or if the chunk could not be
+/// decoded, check @ref DDProtoChunkIterator.err to tell them apart. Unknown
+/// messages are no error, their chunks have the kind @ref
+/// DDPROTO_MSG_KIND_UNKNOWN.
+bool ddproto_chunk_iterator_next(DDProtoChunkIterator *iter, DDProtoChunk *chunk);
+
+/// Same as @ref ddproto_chunk_iterator_next but only the chunk header is read.
+/// The message is skipped without decoding it.
+bool ddproto_chunk_iterator_skip(DDProtoChunkIterator *iter, DDProtoChunkHeader *header);
+
+/// Returns the amount of payload bytes read so far. After the last chunk the
+/// ddnet security token follows.
+size_t ddproto_chunk_iterator_offset(const DDProtoChunkIterator *iter);
+
 /// Given a buffer containing the packet payload without packet header. It will
 /// extract all system and game messages and store them in the given packet
 /// struct. And it returns the amount of bytes read.
 size_t ddproto_fetch_chunks(const uint8_t *buf, size_t len, DDProtoPacketHeader *header, OnDDProtoChunk callback, void *ctx, DDProtoError *err);
 
+/// Same as @ref ddproto_fetch_chunks but every message is unpacked with
+/// `options`, see @ref DDProtoDecodeOptions.
+size_t ddproto_fetch_chunks_into(const uint8_t *buf, size_t len, DDProtoPacketHeader *header, const DDProtoDecodeOptions *options, OnDDProtoChunk callback, void *ctx, DDProtoError *err);
+
+/// @brief Validates the chunk headers of the payload without decoding any
+/// message.
+///
+/// Stores the `header->num_chunks` chunks in `chunks` which can hold
+/// `capacity` of them. The messages are decoded later with @ref
+/// ddproto_decode_lazy_chunk, chunks nobody reads cost only their header.
+/// `buf` has to outlive the chunks. Returns the amount of bytes read like
+/// @ref ddproto_fetch_chunks.
+size_t ddproto_index_chunks(const uint8_t *buf, size_t len, const DDProtoPacketHeader *header, DDProtoLazyChunk *chunks, size_t capacity, DDProtoError *err);
+
 #ifdef __cplusplus
 }
 #endif
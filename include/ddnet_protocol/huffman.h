@@ -7,6 +7,73 @@ extern "C" {
 #include "common.h"
 #include "errors.h"
 
+/// Huffman codec built from a table of byte frequencies. Teeworlds and DDNet
+/// use the table returned by @ref ddproto_huffman_default_frequencies, a
+/// codec for it is returned by @ref ddproto_huffman_default.
+///
+/// Custom tables only make sense if both sides of the connection use the same
+/// one. See @ref ddproto_huffman_new.
+typedef struct DDProtoHuffman DDProtoHuffman;
+
+/// One independent input and output buffer pair for @ref
+/// ddproto_huffman_compress_batch and @ref ddproto_huffman_decompress_batch.
+typedef struct {
+	const uint8_t *input;
+	size_t input_len;
+	uint8_t *output;
+	size_t output_len;
+
+	/// Set by the batch functions. Same as the return value of the single
+	/// buffer function.
+	size_t result_len;
+
+	/// Set by the batch functions. @ref DDPROTO_ERR_NONE on success.
+	DDProtoError err;
+} DDProtoHuffmanBuffer;
+
+/// Returns the codec used by Teeworlds and DDNet. It is used by all functions
+/// that do not take a @ref DDProtoHuffman and must not be freed.
+const DDProtoHuffman *ddproto_huffman_default(void);
+
+/// Returns the 256 byte frequencies the default codec is built from.
+const uint32_t *ddproto_huffman_default_frequencies(void);
+
+/// Builds a codec from the frequency of every byte value. The EOF symbol
+/// always has a frequency of 1. The same table always results in the same
+/// codes and the default table results in the default codec.
+///
+/// Codes are limited to 16 bits. If a table results in longer codes, for
+/// example because it contains a lot of zeros, all frequencies are halved
+/// until they fit.
+///
+/// Returns `NULL` if the allocation failed. Has to be freed with @ref
+/// ddproto_huffman_free.
+DDProtoHuffman *ddproto_huffman_new(const uint32_t frequencies[256]);
+
+/// Frees a codec returned by @ref ddproto_huffman_new.
+void ddproto_huffman_free(DDProtoHuffman *huffman);
+
+/// Adds the amount of times every byte value appears in `input` to
+/// `frequencies`. Call it for every payload of a captured corpus to train a
+/// table for @ref ddproto_huffman_new. Start with all frequencies set to 1 so
+/// bytes that are not part of the corpus still get a code of reasonable
+/// length.
+void ddproto_huffman_count_frequencies(uint32_t frequencies[256], const uint8_t *input, size_t input_len);
+
+/// Returns the exact size @ref ddproto_huffman_compress_with would produce for
+/// `input` without writing the output. Useful to compare how well different
+/// tables fit a corpus.
+size_t ddproto_huffman_compressed_size(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len);
+
+/// Returns the biggest size @ref ddproto_huffman_compress can produce for
+/// `input_len` bytes. An `output` of this size never results in @ref
+/// DDPROTO_ERR_BUFFER_FULL. The bound is reached if every byte has the longest
+/// code of the table.
+size_t ddproto_huffman_compress_bound(size_t input_len);
+
+/// Same as @ref ddproto_huffman_compress_bound but for the given codec.
+size_t ddproto_huffman_compress_bound_with(const DDProtoHuffman *huffman, size_t input_len);
+
 /// Applies huffman compression to the given `input` and stores the compressed
 /// result in `output`. This should be applied to the teeworlds packet payload
 /// if the @ref DDPROTO_PACKET_FLAG_COMPRESSION is set. Returns the size of the
@@ -15,14 +82,51 @@ extern "C" {
 /// See also https://chillerdragon.github.io/teeworlds-protocol/06/fundamentals.html#huffman.
 size_t ddproto_huffman_compress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
 
+/// Same as @ref ddproto_huffman_compress but uses the given codec instead of
+/// the default one.
+size_t ddproto_huffman_compress_with(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
+
+/// Same as @ref ddproto_huffman_compress but writes the output byte by byte.
+/// This is a port of the reference implementation and is kept to verify the
+/// faster encoder. Both produce the exact same output.
+size_t ddproto_huffman_compress_reference(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
+
 /// Applies huffman decompression to the given `input` and stores the result in
 /// `output`. This should be applied to the teeworlds packet payload if the @ref
 /// DDPROTO_PACKET_FLAG_COMPRESSION is set. Returns the size of the decompressed
 /// `output`.
 ///
+/// Uses a lookup table that resolves multiple short codes per lookup and every
+/// long code in at most two lookups. Fails with @ref DDPROTO_ERR_END_OF_BUFFER
+/// if `input` ends before the EOF symbol.
+///
 /// See also https://chillerdragon.github.io/teeworlds-protocol/06/fundamentals.html#huffman.
 size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
 
+/// Same as @ref ddproto_huffman_decompress but uses the given codec instead of
+/// the default one.
+size_t ddproto_huffman_decompress_with(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
+
+/// Same as @ref ddproto_huffman_decompress but decodes one symbol per lookup
+/// and walks the tree bit by bit for long codes. This is a port of the
+/// reference implementation and is kept to verify the faster decoder.
+size_t ddproto_huffman_decompress_reference(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err);
+
+/// Applies @ref ddproto_huffman_compress_with to every buffer in `buffers`.
+///
+/// Several buffers are encoded at the same time which is faster than calling
+/// @ref ddproto_huffman_compress_with in a loop when there are many packets to
+/// send, for example one snapshot per client. The output and error of every
+/// buffer are the exact same as the ones of the single buffer function. A
+/// failing buffer does not affect the other ones.
+void ddproto_huffman_compress_batch(const DDProtoHuffman *huffman, DDProtoHuffmanBuffer *buffers, size_t num_buffers);
+
+/// Applies @ref ddproto_huffman_decompress_with to every buffer in `buffers`.
+///
+/// Same as @ref ddproto_huffman_compress_batch but for the decoding side, for
+/// example all packets received in one network tick.
+void ddproto_huffman_decompress_batch(const DDProtoHuffman *huffman, DDProtoHuffmanBuffer *buffers, size_t num_buffers);
+
 #ifdef __cplusplus
 }
 #endif
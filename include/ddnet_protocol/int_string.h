@@ -6,16 +6,37 @@ extern "C" {
 
 #include "common.h"
 #include "errors.h"
+#include "packer.h"
 
 /// Get the length of a string in bytes.
 size_t ddproto_str_length(const char *str);
 
+/// @brief Check if the first `len` bytes of `str` are valid UTF-8.
+///
+/// Overlong encodings, surrogates and code points above U+10FFFF are
+/// rejected. Plain ASCII is checked many bytes at a time so the check costs
+/// about as much as copying the string.
+bool ddproto_str_is_utf8(const char *str, size_t len);
+
 /// @brief Convert list of integers into a string.
 ///
 /// Used by the snapshot which technically only consists of integers, but also
-/// holds strings.
+/// holds strings. The string is not validated, see @ref
+/// ddproto_ints_to_str_utf8.
 DDProtoError ddproto_ints_to_str(const uint32_t *ints, size_t num_ints, char *str, size_t str_len);
 
+/// Same as @ref ddproto_ints_to_str but returns @ref DDPROTO_ERR_INVALID_UTF8
+/// if the string is not valid UTF-8.
+DDProtoError ddproto_ints_to_str_utf8(const uint32_t *ints, size_t num_ints, char *str, size_t str_len);
+
+/// @brief Unpacks `num_ints` integers and converts them into a string.
+///
+/// Same as @ref ddproto_unpacker_get_ints followed by @ref
+/// ddproto_ints_to_str without the intermediate array. The string is checked
+/// to be valid UTF-8 if @ref DDProtoDecodeOptions.validate_utf8 is set. On
+/// errors `str` is set to an empty string.
+DDProtoError ddproto_unpacker_get_int_string(DDProtoUnpacker *unpacker, size_t num_ints, char *str, size_t str_len);
+
 /// @brief Convert string to a list of integers.
 ///
 /// Used by the snapshot which technically only consists of integers, but also
@@ -67,26 +67,76 @@ typedef enum {
 	DDPROTO_SYSTEM = 1,
 } DDProtoMessageCategory;
 
+/// Returns the kind of the message with the id `msg_id` or @ref
+/// DDPROTO_MSG_KIND_UNKNOWN if there is none.
+DDProtoMessageKind ddproto_message_kind(DDProtoMessageCategory category, DDProtoMessageId msg_id);
+
 /// The given chunk has to have a correct header set and its `msg` will be
 /// filled based on the content of `buf` which has to point to the beginning of
 /// the chunk payload.
+///
+/// `buf` is not modified. Strings that have to be sanitized are copied into
+/// the scratch buffer of the thread, see @ref DDProtoDecodeOptions.strings. Use
+/// @ref ddproto_unpack_message to provide memory for them.
 DDProtoError ddproto_decode_message(DDProtoChunk *chunk, const uint8_t *buf);
 
+/// Same as @ref ddproto_decode_message but the chunk payload is read from
+/// `unpacker` which has to be initialized with the size of the payload. Its
+/// options like `strings` or `arena` apply to the message.
+DDProtoError ddproto_unpack_message(DDProtoChunk *chunk, DDProtoUnpacker *unpacker);
+
+/// Reads only the message id of `chunk` and stores whether it is a system or
+/// game message in `category`. The rest of the message is not touched.
+DDProtoMessageId ddproto_lazy_chunk_message_id(const DDProtoLazyChunk *chunk, DDProtoMessageCategory *category);
+
+/// @brief Decodes the message of a chunk indexed by @ref ddproto_index_chunks.
+///
+/// The message is unpacked with `options`, see @ref ddproto_fetch_chunks_into.
+/// Pass `NULL` for the defaults. Returns the same errors as @ref
+/// ddproto_decode_message.
+DDProtoError ddproto_decode_lazy_chunk(const DDProtoLazyChunk *lazy, const DDProtoDecodeOptions *options, DDProtoChunk *chunk);
+
+/// @brief Amount of bytes @ref ddproto_encode_message writes for `message`.
+///
+/// Computed without packing anything. Sets `err` to @ref
+/// DDPROTO_ERR_UNKNOWN_MESSAGE and returns 0 for kinds that can not be
+/// encoded.
+size_t ddproto_message_encoded_size(const DDProtoMessage *message, DDProtoError *err);
+
+/// @brief Upper bound of the bytes @ref ddproto_encode_message writes for a
+/// message of `kind`.
+///
+/// Known at compile time. Messages with strings or raw data are only bounded
+/// by @ref DDPROTO_MAX_PACKET_SIZE, which is also returned for unknown
+/// messages.
+size_t ddproto_message_max_size(DDProtoMessageKind kind);
+
+/// Packs the message of `chunk` into `buf` which has to fit @ref
+/// DDPROTO_PACKER_BUFFER_SIZE bytes. Returns the amount of bytes written.
 size_t ddproto_encode_message(DDProtoChunk *chunk, uint8_t *buf, DDProtoError *err);
 
+/// Same as @ref ddproto_encode_message but at most `len` bytes are written.
+/// Messages that do not fit set `err` to @ref DDPROTO_ERR_BUFFER_FULL and
+/// return 0.
+size_t ddproto_encode_message_buf(const DDProtoChunk *chunk, uint8_t *buf, size_t len, DDProtoError *err);
+
 DDProtoMessage ddproto_build_msg_info(const char *password);
 
-/// Initializes a new packer struct. And already packs the message id and
-/// message kind flag.
+/// Initializes the packer of `buffer` and returns it. And already packs the
+/// message id and message kind flag.
 ///
 /// See also @ref ddproto_packer_init if you need an empty packer.
 ///
 /// ```C
-/// DDProtoPacker packer;
-/// ddproto_packer_init_msg(&packer, DDPROTO_MSG_KIND_RCON_CMD);
-/// ddproto_packer_add_string(&packer, "say hello");
+/// DDProtoPackerBuffer buffer;
+/// DDProtoPacker *packer = ddproto_packer_init_msg(&buffer, DDPROTO_MSG_KIND_RCON_CMD);
+/// ddproto_packer_add_string(packer, "say hello");
 /// ```
-void ddproto_packer_init_msg(DDProtoPacker *packer, DDProtoMessageKind kind);
+DDProtoPacker *ddproto_packer_init_msg(DDProtoPackerBuffer *buffer, DDProtoMessageKind kind);
+
+/// Same as @ref ddproto_packer_init_msg but the message is packed into `buf`
+/// which can hold `len` bytes. See also @ref ddproto_packer_init_buf.
+void ddproto_packer_init_msg_buf(DDProtoPacker *packer, DDProtoMessageKind kind, uint8_t *buf, size_t len);
 
 #ifdef __cplusplus
 }
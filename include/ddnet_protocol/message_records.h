@@ -0,0 +1,115 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "chunk.h"
+#include "common.h"
+#include "errors.h"
+
+/// Records and the messages in them start at multiples of this many bytes.
+#define DDPROTO_RECORD_ALIGNMENT 8
+
+/// @brief Compact copy of a decoded chunk.
+///
+/// A @ref DDProtoChunk is as big as the biggest message. A record only takes
+/// the header, the struct of its message kind and the strings, raw data and
+/// snapshot arrays the message points to. Records are packed back to back in
+/// @ref DDProtoMessageRecords.
+///
+/// The message follows the header, access it with @ref
+/// ddproto_message_record_msg.
+typedef struct {
+	DDProtoChunkHeader header;
+
+	/// @ref DDProtoMessageKind of the message.
+	uint8_t kind;
+
+	/// Size of the whole record in bytes, a multiple of @ref
+	/// DDPROTO_RECORD_ALIGNMENT.
+	uint32_t record_size;
+} DDProtoMessageRecord;
+
+/// @brief Caller owned buffer of message records.
+///
+/// Unlike an array of @ref DDProtoChunk every record only takes as much
+/// memory as its message needs, which keeps many buffered packets small.
+/// Records own copies of everything their messages point to, so they stay
+/// valid after the packet they came from is gone. Those pointers point into
+/// `buf` which therefore must not be moved while the records are used.
+///
+/// ```C
+/// static uint64_t buf[4096];
+/// DDProtoMessageRecords records;
+/// ddproto_message_records_init(&records, buf, sizeof(buf));
+///
+/// // every packet of this tick
+/// ddproto_decode_packet_records(datagram, len, &records, &err);
+///
+/// for(const DDProtoMessageRecord *record = ddproto_message_records_first(&records); record; record = ddproto_message_records_next(&records, record)) {
+/// 	if(record->kind == DDPROTO_MSG_KIND_SV_CHAT) {
+/// 		puts(ddproto_message_record_msg(record)->chat.message);
+/// 	}
+/// }
+/// ddproto_message_records_reset(&records);
+/// ```
+typedef struct {
+	/// Memory aligned to @ref DDPROTO_RECORD_ALIGNMENT.
+	uint8_t *buf;
+	size_t capacity;
+
+	/// Bytes of `buf` taken by records.
+	size_t len;
+
+	/// Amount of records.
+	size_t count;
+} DDProtoMessageRecords;
+
+/// Uses the `capacity` bytes of `buf` for records. `buf` has to be aligned to
+/// @ref DDPROTO_RECORD_ALIGNMENT.
+void ddproto_message_records_init(DDProtoMessageRecords *records, void *buf, size_t capacity);
+
+/// Removes all records but keeps the buffer.
+void ddproto_message_records_reset(DDProtoMessageRecords *records);
+
+/// @brief Size of the record of `chunk` in bytes.
+///
+/// Sets `err` to @ref DDPROTO_ERR_UNKNOWN_MESSAGE and returns 0 if the kind
+/// of the chunk is invalid.
+size_t ddproto_message_record_size(const DDProtoChunk *chunk, DDProtoError *err);
+
+/// @brief Appends a compact copy of `chunk`.
+///
+/// Strings, raw data and snapshot arrays of the message are copied too. Fails
+/// with @ref DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL if the record does not fit, the
+/// records are left as they were then.
+DDProtoError ddproto_message_records_push(DDProtoMessageRecords *records, const DDProtoChunk *chunk);
+
+/// Returns the first record or `NULL` if there is none.
+const DDProtoMessageRecord *ddproto_message_records_first(const DDProtoMessageRecords *records);
+
+/// Returns the record after `record` or `NULL` if it was the last one.
+const DDProtoMessageRecord *ddproto_message_records_next(const DDProtoMessageRecords *records, const DDProtoMessageRecord *record);
+
+/// @brief Message of `record`.
+///
+/// Only the member of the union that matches @ref DDProtoMessageRecord.kind
+/// is stored, the union as a whole must not be copied. Use @ref
+/// ddproto_message_record_load for a full @ref DDProtoChunk.
+///
+/// ```C
+/// if(record->kind == DDPROTO_MSG_KIND_SV_KILLMSG) {
+/// 	int32_t victim_id = ddproto_message_record_msg(record)->kill_msg.victim_id;
+/// }
+/// ```
+const DDProtoGenericMessage *ddproto_message_record_msg(const DDProtoMessageRecord *record);
+
+/// Fills `chunk` with the header and message of `record`. Strings, raw data
+/// and snapshots of the message still point into the record. The snapshot
+/// must not be freed with @ref ddproto_free_snapshot.
+void ddproto_message_record_load(const DDProtoMessageRecord *record, DDProtoChunk *chunk);
+
+#ifdef __cplusplus
+}
+#endif
@@ -82,11 +82,17 @@ typedef enum {
 /// screen with transparent background on the client side.
 typedef struct {
 	const char *message;
+
+	/// Length of `message` without the null terminator. Only set when decoding.
+	size_t message_len;
 } DDProtoMsgSvMotd;
 
 /// Sent by the server and displayed in the middle of the screen as white text.
 typedef struct {
 	const char *message;
+
+	/// Length of `message` without the null terminator. Only set when decoding.
+	size_t message_len;
 } DDProtoMsgSvBroadcast;
 
 // sent by the server
@@ -100,6 +106,9 @@ typedef struct {
 
 	/// Chat message.
 	const char *message;
+
+	/// Length of `message` without the null terminator. Only set when decoding.
+	size_t message_len;
 } DDProtoMsgSvChat;
 
 // sent by the server
@@ -207,6 +216,9 @@ typedef struct {
 typedef struct {
 	DDProtoChatTeam team;
 	const char *message;
+
+	/// Length of `message` without the null terminator. Only set when decoding.
+	size_t message_len;
 } DDProtoMsgClSay;
 
 // sent by the client
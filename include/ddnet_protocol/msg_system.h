@@ -36,6 +36,29 @@ typedef struct {
 	const uint8_t *data;
 } DDProtoMsgMapData;
 
+// sent by the server
+/// One part of a snapshot that did not fit into a single message. The parts
+/// have to be joined before the snapshot can be decoded with @ref
+/// ddproto_decode_snapshot.
+typedef struct {
+	int32_t game_tick;
+	int32_t delta_tick;
+	int32_t num_parts;
+	int32_t part;
+	int32_t crc;
+	int32_t part_size;
+
+	/// The @ref DDProtoMsgSnap.part_size bytes of this part.
+	const uint8_t *data;
+} DDProtoMsgSnap;
+
+// sent by the server
+/// Sent instead of a snapshot if nothing changed since the delta tick.
+typedef struct {
+	int32_t game_tick;
+	int32_t delta_tick;
+} DDProtoMsgSnapEmpty;
+
 // sent by the server
 typedef struct {
 	int32_t game_tick;
@@ -45,6 +68,17 @@ typedef struct {
 	DDProtoSnapshot snapshot;
 } DDProtoMsgSnapSingle;
 
+// sent by the server
+typedef struct {
+	int32_t game_tick;
+	int32_t delta_tick;
+	int32_t crc;
+	int32_t part_size;
+
+	/// The @ref DDProtoMsgSnapSmall.part_size bytes of the snapshot delta.
+	const uint8_t *data;
+} DDProtoMsgSnapSmall;
+
 // sent by the client
 typedef struct {
 	/// Command which will be executed in the server console.
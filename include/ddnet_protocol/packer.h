@@ -10,12 +10,26 @@ extern "C" {
 /// Replaces all characters below ASCII 32 with whitespace.
 void ddproto_str_sanitize_cc(char *string);
 
+/// Same as @ref ddproto_str_sanitize_cc but only the first `len` bytes are
+/// read and written. The string does not need a null terminator.
+void ddproto_str_sanitize_cc_len(char *string, size_t len);
+
 /// Replaces all characters below ASCII 32 except \\r, \\n and \\t with
 /// whitespace.
 void ddproto_str_sanitize(char *string);
 
+/// Same as @ref ddproto_str_sanitize but only the first `len` bytes are read
+/// and written. The string does not need a null terminator.
+void ddproto_str_sanitize_len(char *string, size_t len);
+
 /// Removes leading and trailing spaces and limits the use of multiple spaces.
-void ddproto_str_clean_whitespaces(char *string);
+/// Returns the new length of the string.
+size_t ddproto_str_clean_whitespaces(char *string);
+
+/// Same as @ref ddproto_str_clean_whitespaces but only the first `len` bytes
+/// are read. The null terminator is written at the new end of the string so
+/// `string` has to have room for `len + 1` bytes.
+size_t ddproto_str_clean_whitespaces_len(char *string, size_t len);
 
 /// Used by @ref ddproto_unpacker_get_string_sanitized to strip unwanted
 /// characters from the strings received from the peer.
@@ -24,8 +38,108 @@ typedef enum {
 	DDPROTO_STRING_SANITIZE = 1 << 0,
 	DDPROTO_STRING_SANITIZE_CC = 1 << 1,
 	DDPROTO_STRING_SKIP_START_WHITESPACES = 1 << 2,
+	/// Only used by the unpacker. Fails with @ref DDPROTO_ERR_INVALID_UTF8
+	/// if the string is not valid UTF-8.
+	DDPROTO_STRING_VALIDATE_UTF8 = 1 << 3,
 } DDProtoStringSanitize;
 
+/// @brief A string that points into the unpacked data.
+///
+/// `str` is null terminated and `len` is its length without the terminator.
+/// The string is exactly what the peer sent so it still has to be sanitized
+/// before it is displayed. See @ref ddproto_string_view_sanitize.
+typedef struct {
+	const char *str;
+	size_t len;
+} DDProtoStringView;
+
+/// Returns `true` if sanitizing `view` with `sanitize` would not change it. In
+/// that case `view.str` can be used as is without copying it.
+bool ddproto_string_view_is_sanitized(DDProtoStringView view, DDProtoStringSanitize sanitize);
+
+/// @brief Copies `view` into `buf` and sanitizes the copy.
+///
+/// The copy is truncated to fit into `buf_len` bytes including the null
+/// terminator. Returns the length of the copy without the terminator.
+///
+/// ```C
+/// DDProtoStringView view = ddproto_unpacker_get_string_view(&unpacker);
+/// char name[16];
+/// ddproto_string_view_sanitize(view, DDPROTO_STRING_SANITIZE_CC, name, sizeof(name));
+/// ```
+size_t ddproto_string_view_sanitize(DDProtoStringView view, DDProtoStringSanitize sanitize, char *buf, size_t buf_len);
+
+/// @brief Owned memory for the sanitized copies of unpacked strings.
+///
+/// The unpacker never modifies the data it unpacks. Strings that are already
+/// clean point right into the data, the others are copied into `buf` and
+/// sanitized there. Strings that already lie inside of `buf` belong to the
+/// decoder and are sanitized where they are.
+///
+/// ```C
+/// uint8_t buf[DDPROTO_MAX_PACKET_SIZE];
+/// DDProtoStringBuffer strings = {.buf = buf, .capacity = sizeof(buf)};
+/// DDProtoDecodeOptions options = {.strings = &strings};
+/// ```
+typedef struct DDProtoStringBuffer {
+	uint8_t *buf;
+
+	/// Amount of bytes of `buf` that are used.
+	size_t len;
+	size_t capacity;
+} DDProtoStringBuffer;
+
+/// @brief Settings of the decoders.
+///
+/// An unpacker reads its settings from @ref DDProtoUnpacker.options. The
+/// decode functions that take options pass them on to every unpacker they
+/// create. The same options can be shared by any number of unpackers. All
+/// fields are off if the struct is zero initialized.
+///
+/// ```C
+/// DDProtoDecodeOptions options = {.validate_utf8 = true};
+/// DDProtoUnpacker unpacker;
+/// ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+/// unpacker.options = &options;
+/// ```
+typedef struct DDProtoDecodeOptions {
+	/// If set every string that is unpacked is checked to be valid UTF-8.
+	/// Invalid strings set `err` of the unpacker to @ref
+	/// DDPROTO_ERR_INVALID_UTF8.
+	bool validate_utf8;
+
+	/// Where strings that have to be sanitized are copied to. If it is `NULL`
+	/// or full they are copied into `arena`. Without either of them they are
+	/// copied into a scratch buffer of the calling thread that is reused. Such
+	/// a string is only overwritten after at least @ref
+	/// DDPROTO_MAX_PACKET_SIZE bytes of other strings were copied there. In
+	/// kernel space there is no scratch buffer and those strings fail with
+	/// @ref DDPROTO_ERR_BUFFER_FULL.
+	struct DDProtoStringBuffer *strings;
+
+	/// If set the strings of snap items are added to this table instead of
+	/// being copied into every item. See @ref DDProtoStringTable.
+	struct DDProtoStringTable *string_table;
+
+	/// If set snapshots take their items and removed keys from this storage
+	/// instead of allocating them. See @ref DDProtoSnapshotStorage.
+	struct DDProtoSnapshotStorage *snap_storage;
+
+	/// If set snapshots allocate their items and removed keys from this arena
+	/// instead of the heap. See @ref DDProtoArena.
+	struct DDProtoArena *arena;
+
+	/// Allocator for the snapshots if there is neither a snapshot storage nor
+	/// an arena. `NULL` uses @ref ddproto_allocator.
+	struct DDProtoAllocator *allocator;
+
+	/// Mask of the message kinds @ref ddproto_unpack_message decodes, see
+	/// @ref DDPROTO_MSG_KIND_BIT. Other messages are not decoded and end up
+	/// as @ref DDPROTO_MSG_KIND_UNKNOWN with their raw payload. 0 decodes
+	/// every kind.
+	uint64_t kinds;
+} DDProtoDecodeOptions;
+
 /// @brief State for the unpacker.
 ///
 /// Holds the data to be unpacked and keeps track of how much data was unpacked
@@ -36,6 +150,10 @@ typedef struct {
 	DDProtoError err;
 	const uint8_t *buf_end;
 	const uint8_t *buf;
+
+	/// How the data is decoded. Never `NULL`, @ref ddproto_unpacker_init
+	/// points it to options with every setting off.
+	const DDProtoDecodeOptions *options;
 } DDProtoUnpacker;
 
 /// Maximum output and storage size in bytes used by the `DDProtoPacker`.
@@ -43,18 +161,52 @@ typedef struct {
 
 /// @brief State for the packer.
 ///
-/// Holds the currently packed data and also tracks errors.
+/// Tracks where the next value is packed and also tracks errors. The packed
+/// data lives in the memory passed to @ref ddproto_packer_init_buf or in a
+/// @ref DDProtoPackerBuffer.
 typedef struct {
 	DDProtoError err;
+
+	/// Start of the packed data.
+	uint8_t *start;
 	uint8_t *current;
 	uint8_t *end;
-	uint8_t buf[DDPROTO_PACKER_BUFFER_SIZE];
 } DDProtoPacker;
 
-/// @brief Initializes a new packer struct.
+/// @brief A packer together with its own buffer.
+///
+/// Only needed if the data is not packed straight into memory of the caller,
+/// see @ref ddproto_packer_init.
+typedef struct {
+	DDProtoPacker packer;
+	uint8_t buf[DDPROTO_PACKER_BUFFER_SIZE];
+} DDProtoPackerBuffer;
+
+/// @brief Initializes the packer of `buffer` and returns it.
+///
+/// It packs into `buffer->buf`. See also @ref ddproto_packer_init_msg if you
+/// want to send a net message.
+///
+/// ```C
+/// DDProtoPackerBuffer buffer;
+/// DDProtoPacker *packer = ddproto_packer_init(&buffer);
+/// ddproto_packer_add_int(packer, 5);
+/// ```
+DDProtoPacker *ddproto_packer_init(DDProtoPackerBuffer *buffer);
+
+/// @brief Initializes a packer that packs into `buf`.
 ///
-/// See also @ref ddproto_packer_init_msg if you want to send a net message.
-void ddproto_packer_init(DDProtoPacker *packer);
+/// At most `len` bytes are written. Lets you pack straight into the final
+/// datagram without copying the data out of the packer afterwards.
+///
+/// ```C
+/// uint8_t buf[DDPROTO_MAX_PACKET_SIZE];
+/// DDProtoPacker packer;
+/// ddproto_packer_init_buf(&packer, buf, sizeof(buf));
+/// ddproto_packer_add_int(&packer, 5);
+/// ddproto_packer_data(&packer); // => buf
+/// ```
+void ddproto_packer_init_buf(DDProtoPacker *packer, uint8_t *buf, size_t len);
 
 /// @brief Get the size in bytes of the currently packed data.
 ///
@@ -63,7 +215,8 @@ size_t ddproto_packer_size(DDProtoPacker *packer);
 
 /// @brief Amount of free bytes in the output buffer.
 ///
-/// The packer can pack a maximum of @ref DDPROTO_PACKER_BUFFER_SIZE bytes.
+/// The packer of a @ref DDProtoPackerBuffer can pack a maximum of @ref
+/// DDPROTO_PACKER_BUFFER_SIZE bytes.
 size_t ddproto_packer_remaining_size(DDProtoPacker *packer);
 
 /// Use in combination with @ref ddproto_packer_size.
@@ -74,11 +227,35 @@ uint8_t *ddproto_packer_data(DDProtoPacker *packer);
 /// Call @ref ddproto_packer_data to receive the full packed data.
 DDProtoError ddproto_packer_add_int(DDProtoPacker *packer, int32_t value);
 
+/// @brief Packs the `num` integers in `values` as teeworlds varints.
+///
+/// Unlike calling @ref ddproto_packer_add_int in a loop nothing is packed if
+/// not all integers fit into the remaining space.
+///
+/// ```C
+/// int32_t values[] = {1, 64, -1};
+/// DDProtoPackerBuffer buffer;
+/// DDProtoPacker *packer = ddproto_packer_init(&buffer);
+/// ddproto_packer_add_ints(packer, values, 3);
+/// ddproto_packer_size(packer); // => 4
+/// ```
+DDProtoError ddproto_packer_add_ints(DDProtoPacker *packer, const int32_t *values, size_t num);
+
+/// Amount of bytes the `num` integers in `values` take up once packed.
+size_t ddproto_packer_ints_size(const int32_t *values, size_t num);
+
 /// @brief Packs `value` as plain null terminated C string.
 ///
 /// Call @ref ddproto_packer_data to receive the full packed data.
 DDProtoError ddproto_packer_add_string(DDProtoPacker *packer, const char *value);
 
+/// @brief Packs the first `len` bytes of `value` as null terminated C string.
+///
+/// Same as @ref ddproto_packer_add_string but the length does not have to be
+/// computed if you already know it. `value` must not contain a null byte in
+/// its first `len` bytes.
+DDProtoError ddproto_packer_add_string_len(DDProtoPacker *packer, const char *value, size_t len);
+
 /// @brief Packs `data` as raw data.
 ///
 /// Call @ref ddproto_packer_data to receive the full packed data.
@@ -98,6 +275,10 @@ DDProtoError ddproto_packer_add_raw(DDProtoPacker *packer, const uint8_t *data,
 /// ```
 void ddproto_unpacker_init(DDProtoUnpacker *unpacker, const uint8_t *buf, size_t len);
 
+/// Points an initialized unpacker to new data and clears its error. The
+/// options are kept.
+void ddproto_unpacker_reset(DDProtoUnpacker *unpacker, const uint8_t *buf, size_t len);
+
 /// @brief Amount of bytes that have not yet been unpacked.
 size_t ddproto_unpacker_remaining_size(DDProtoUnpacker *unpacker);
 
@@ -115,13 +296,31 @@ size_t ddproto_unpacker_remaining_size(DDProtoUnpacker *unpacker);
 /// ```
 int32_t ddproto_unpacker_get_int(DDProtoUnpacker *unpacker);
 
+/// Unpacks the next `num` integers into `values`. Faster than calling @ref
+/// ddproto_unpacker_get_int in a loop because the remaining space is only
+/// checked close to the end of the data.
+///
+/// If the data ends early the missing values are set to 0 and the error is
+/// returned. It is also stored in `unpacker->err`.
+///
+/// ```C
+/// uint8_t bytes[] = {0x05, 0x80, 0x01};
+/// DDProtoUnpacker unpacker;
+/// ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+/// int32_t values[2];
+/// ddproto_unpacker_get_ints(&unpacker, values, 2); // => DDPROTO_ERR_NONE
+/// values[1]; // => 64
+/// ```
+DDProtoError ddproto_unpacker_get_ints(DDProtoUnpacker *unpacker, int32_t *values, size_t num);
+
 /// Use @ref ddproto_unpacker_init to get the value for
 /// `DDProtoUnpacker *unpacker`. It returns the next null terminated string in
 /// the unpacker data and also progresses the internal unpacker state to point
 /// to the next element.
 ///
-/// Applies @ref DDPROTO_STRING_SANITIZE by default. If you want a string
-/// without sanitization use:
+/// Applies @ref DDPROTO_STRING_SANITIZE by default. The unpacked data is not
+/// modified, strings that need sanitizing are copied as described at @ref
+/// DDProtoDecodeOptions.strings. If you want a string without sanitization use:
 ///
 /// ```C
 /// uint8_t bytes[] = {'f', 'o', 0x03, 'o', 0x00};
@@ -146,6 +345,30 @@ const char *ddproto_unpacker_get_string(DDProtoUnpacker *unpacker);
 /// ```
 const char *ddproto_unpacker_get_string_sanitized(DDProtoUnpacker *unpacker, DDProtoStringSanitize sanitize);
 
+/// Same as @ref ddproto_unpacker_get_string_sanitized but the length of the
+/// sanitized string is also written to `len`.
+const char *ddproto_unpacker_get_string_sanitized_len(DDProtoUnpacker *unpacker, DDProtoStringSanitize sanitize, size_t *len);
+
+/// Same as @ref ddproto_unpacker_get_string but the length of the string is
+/// also written to `len`.
+const char *ddproto_unpacker_get_string_len(DDProtoUnpacker *unpacker, size_t *len);
+
+/// @brief Returns the next string as it was sent.
+///
+/// Unlike @ref ddproto_unpacker_get_string the string is not sanitized and
+/// never copied. Use @ref ddproto_string_view_sanitize to get a sanitized
+/// copy.
+///
+/// ```C
+/// uint8_t bytes[] = {'f', 'o', 0x03, 'o', 0x00};
+/// DDProtoUnpacker unpacker;
+/// ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+/// DDProtoStringView view = ddproto_unpacker_get_string_view(&unpacker);
+/// view.len; // => 4
+/// ddproto_string_view_is_sanitized(view, DDPROTO_STRING_SANITIZE); // => false
+/// ```
+DDProtoStringView ddproto_unpacker_get_string_view(DDProtoUnpacker *unpacker);
+
 /// Use @ref ddproto_unpacker_init to get the value for
 /// `DDProtoUnpacker *unpacker`. It returns the next boolean in the unpacker
 /// data and also progresses the internal unpacker state to point to the next
@@ -179,6 +402,34 @@ bool ddproto_unpacker_get_bool(DDProtoUnpacker *unpacker);
 /// ```
 const uint8_t *ddproto_unpacker_get_raw(DDProtoUnpacker *unpacker, size_t len);
 
+/// @brief Skips the next `num` integers without unpacking their values.
+///
+/// Faster than calling @ref ddproto_unpacker_get_int `num` times because the
+/// ends of the packed integers are counted a word at a time. Sets the same
+/// errors as @ref ddproto_unpacker_get_int if the data ends early.
+///
+/// ```C
+/// uint8_t bytes[] = {0x05, 0x80, 0x01, 0x02};
+/// DDProtoUnpacker unpacker;
+/// ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+/// ddproto_unpacker_skip_ints(&unpacker, 2);
+/// ddproto_unpacker_get_int(&unpacker); // => 2
+/// ```
+DDProtoError ddproto_unpacker_skip_ints(DDProtoUnpacker *unpacker, size_t num);
+
+/// Skips the next `num` integers without unpacking their values and returns a
+/// pointer to their packed bytes. The amount of bytes is written to `size`.
+///
+/// ```C
+/// uint8_t bytes[] = {0x05, 0x80, 0x01};
+/// DDProtoUnpacker unpacker;
+/// ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+/// size_t size;
+/// ddproto_unpacker_get_raw_ints(&unpacker, 2, &size); // => bytes
+/// size; // => 3
+/// ```
+const uint8_t *ddproto_unpacker_get_raw_ints(DDProtoUnpacker *unpacker, size_t num, size_t *size);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,10 +4,14 @@
 extern "C" {
 #endif
 
+#include "allocator.h"
+#include "arena.h"
 #include "chunk.h"
 #include "common.h"
 #include "errors.h"
+#include "message_records.h"
 #include "session.h"
+#include "snapshot.h"
 #include "token.h"
 
 /// Minimum size in bytes required for a valid packet header.
@@ -115,7 +119,8 @@ typedef struct {
 	DDProtoPacketKind kind;
 	DDProtoPacketHeader header;
 
-	uint8_t *payload;
+	/// The raw packet payload. Compressed payloads are already decompressed.
+	const uint8_t *payload;
 	size_t payload_len;
 
 	/// @brief The parsed packet payload.
@@ -138,6 +143,10 @@ typedef struct {
 			size_t len;
 		} chunks;
 	};
+
+	/// Allocator the payload and chunks were allocated with. `NULL` for @ref
+	/// ddproto_allocator.
+	DDProtoAllocator *allocator;
 } DDProtoPacket;
 
 /// @brief Unpacks packet header and fills the @ref DDProtoPacketHeader struct.
@@ -165,11 +174,172 @@ size_t ddproto_get_packet_payload(DDProtoPacketHeader *header, const uint8_t *fu
 /// your responsibility to free it using @ref ddproto_free_packet.
 DDProtoPacket ddproto_decode_packet(const uint8_t *buf, size_t len, DDProtoError *err);
 
+/// Same as @ref ddproto_decode_packet but all memory is allocated with
+/// `allocator` instead of @ref ddproto_allocator. @ref ddproto_free_packet
+/// frees it with the same allocator.
+DDProtoPacket ddproto_decode_packet_with_allocator(const uint8_t *buf, size_t len, DDProtoAllocator *allocator, DDProtoError *err);
+
+/// Same as @ref ddproto_decode_packet but the payload, the chunks and the
+/// snapshots are allocated from `arena`. They are released with @ref
+/// ddproto_arena_reset, the packet must not be freed with @ref
+/// ddproto_free_packet.
+DDProtoPacket ddproto_decode_packet_arena(const uint8_t *buf, size_t len, DDProtoArena *arena, DDProtoError *err);
+
+/// @brief Caller owned memory for @ref ddproto_decode_packet_into.
+///
+/// Lets a receive loop decode packets without any heap allocations. The
+/// storage is reused for every packet, everything decoded into it is only
+/// valid until the next packet is decoded.
+///
+/// ```C
+/// DDProtoChunk chunks[64];
+/// DDProtoPacketStorage storage = {
+/// 	.chunks = chunks,
+/// 	.chunks_capacity = 64,
+/// };
+/// DDProtoPacket packet = ddproto_decode_packet_into(buf, len, &storage, &err);
+/// ```
+typedef struct {
+	/// Decompressed payload. Uncompressed payloads are borrowed from the
+	/// decoded datagram, then the strings that have to be sanitized are
+	/// copied into it instead.
+	uint8_t payload[DDPROTO_MAX_PACKET_SIZE];
+
+	/// Chunks of normal packets. Packets with more than `chunks_capacity`
+	/// chunks fail with @ref DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL.
+	DDProtoChunk *chunks;
+	size_t chunks_capacity;
+
+	/// Optional storage for the snapshots of the chunks. If it is `NULL`
+	/// snapshots are allocated as in @ref ddproto_decode_packet and have to
+	/// be freed with @ref ddproto_free_snapshot. It is emptied before every
+	/// packet.
+	DDProtoSnapshotStorage *snapshots;
+
+	/// Mask of the message kinds that are decoded, see @ref
+	/// DDProtoDecodeOptions.kinds. Other messages are not decoded and their
+	/// chunks hold the raw payload as @ref DDPROTO_MSG_KIND_UNKNOWN. 0 decodes
+	/// every kind.
+	uint64_t kinds;
+} DDProtoPacketStorage;
+
+/// @brief Same as @ref ddproto_decode_packet but does not allocate.
+///
+/// The chunks and decompressed payload are written into `storage`. If the
+/// payload is not compressed @ref DDProtoPacket.payload and all strings and
+/// raw data of the chunks point into `buf` instead, so `buf` has to outlive
+/// the packet too. Strings that have to be sanitized are copied into the
+/// payload of `storage` instead, `buf` is never modified.
+///
+/// The packet must not be freed with @ref ddproto_free_packet.
+DDProtoPacket ddproto_decode_packet_into(const uint8_t *buf, size_t len, DDProtoPacketStorage *storage, DDProtoError *err);
+
+/// @brief Packet whose messages are decoded on demand.
+///
+/// Filled by @ref ddproto_decode_packet_lazy. Same as @ref DDProtoPacket but
+/// the chunks of normal packets are only indexed.
+typedef struct {
+	DDProtoPacketKind kind;
+	DDProtoPacketHeader header;
+
+	/// The uncompressed packet payload the chunks point into.
+	const uint8_t *payload;
+	size_t payload_len;
+
+	union {
+		DDProtoControlMessage control;
+		struct {
+			DDProtoLazyChunk *data;
+			size_t len;
+		} chunks;
+	};
+} DDProtoLazyPacket;
+
+/// Caller owned memory for @ref ddproto_decode_packet_lazy. Works like @ref
+/// DDProtoPacketStorage.
+typedef struct {
+	/// Decompressed payload. For uncompressed packets the strings that have
+	/// to be sanitized are copied into it instead.
+	uint8_t payload[DDPROTO_MAX_PACKET_SIZE];
+
+	/// Used by @ref ddproto_decode_lazy_chunk to sanitize the strings of the
+	/// chunks. Set up by @ref ddproto_decode_packet_lazy.
+	DDProtoStringBuffer strings;
+
+	/// Packets with more than `chunks_capacity` chunks fail with @ref
+	/// DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL.
+	DDProtoLazyChunk *chunks;
+	size_t chunks_capacity;
+} DDProtoLazyPacketStorage;
+
+/// @brief Decodes the packet header and indexes the chunks of normal packets
+/// without decoding their messages.
+///
+/// Compressed payloads are decompressed into `storage` as a whole, otherwise
+/// the payload is borrowed from `buf` like in @ref ddproto_decode_packet_into.
+/// Pick the messages of interest with @ref ddproto_lazy_chunk_message_id and
+/// decode them with @ref ddproto_decode_lazy_chunk.
+///
+/// ```C
+/// DDProtoLazyChunk chunks[64];
+/// DDProtoLazyPacketStorage storage = {.chunks = chunks, .chunks_capacity = 64};
+/// DDProtoLazyPacket packet = ddproto_decode_packet_lazy(buf, len, &storage, &err);
+/// for(size_t i = 0; i < packet.chunks.len; i++) {
+/// 	DDProtoMessageCategory category;
+/// 	DDProtoMessageId id = ddproto_lazy_chunk_message_id(&packet.chunks.data[i], &category);
+/// 	if(category == DDPROTO_GAME && id == DDPROTO_MSG_SV_CHAT) {
+/// 		DDProtoChunk chunk;
+/// 		ddproto_decode_lazy_chunk(&packet.chunks.data[i], NULL, &chunk);
+/// 	}
+/// }
+/// ```
+DDProtoLazyPacket ddproto_decode_packet_lazy(const uint8_t *buf, size_t len, DDProtoLazyPacketStorage *storage, DDProtoError *err);
+
+/// @brief Decodes the chunks of a normal packet into compact records.
+///
+/// Appends one record per chunk to `records` instead of filling an array of
+/// @ref DDProtoChunk. Compressed payloads are decompressed while the chunks
+/// are unpacked. The records own copies of their strings, raw data and
+/// snapshots, so `buf` can be reused right away.
+///
+/// Returns the packet header. Control packets add no records. If the packet is
+/// invalid or does not fit into `records` none of its records are kept.
+DDProtoPacketHeader ddproto_decode_packet_records(const uint8_t *buf, size_t len, DDProtoMessageRecords *records, DDProtoError *err);
+
 /// Given a @ref DDProtoPacket struct it will encode a full udp payload the
 /// output is written into `buf` which has to be at least `len` big. And
 /// returns the amount of written bytes.
+///
+/// Returns 0 and sets `err` to @ref DDPROTO_ERR_BUFFER_FULL if `buf` is too
+/// small, or to the error of a message that can not be encoded.
+///
+/// The payload of normal packets is compressed if the header has the @ref
+/// DDPROTO_PACKET_FLAG_COMPRESSION flag set. Use @ref
+/// ddproto_encode_packet_with_compression to let the encoder decide.
 size_t ddproto_encode_packet(const DDProtoPacket *packet, uint8_t *buf, size_t len, DDProtoError *err);
 
+/// Decides if the payload of a normal packet gets huffman compressed. Control
+/// packets are never compressed.
+typedef enum {
+	/// Send the payload as is and clear the @ref
+	/// DDPROTO_PACKET_FLAG_COMPRESSION flag.
+	DDPROTO_COMPRESSION_NEVER,
+
+	/// Compress the payload and set the @ref DDPROTO_PACKET_FLAG_COMPRESSION
+	/// flag, even if the compressed payload is bigger.
+	DDPROTO_COMPRESSION_ALWAYS,
+
+	/// Compress the payload only if it gets smaller. The compressed size is
+	/// calculated with @ref ddproto_huffman_compressed_size first, so payloads
+	/// that do not shrink are not compressed at all.
+	DDPROTO_COMPRESSION_AUTO,
+} DDProtoCompression;
+
+/// Same as @ref ddproto_encode_packet but `compression` decides if the payload
+/// is compressed instead of the flags of the header. The flags written into
+/// `buf` always match the payload.
+size_t ddproto_encode_packet_with_compression(const DDProtoPacket *packet, uint8_t *buf, size_t len, DDProtoCompression compression, DDProtoError *err);
+
 /// @brief Convenience function to initialize a `packet` struct.
 ///
 /// Creates a normal ddnet packet. If you need a connless or control packet. You
@@ -182,6 +352,10 @@ size_t ddproto_encode_packet(const DDProtoPacket *packet, uint8_t *buf, size_t l
 /// @ref ddproto_free_packet.
 DDProtoError ddproto_build_packet(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session);
 
+/// Same as @ref ddproto_build_packet but the chunks are allocated from
+/// `arena`. The packet must not be freed with @ref ddproto_free_packet.
+DDProtoError ddproto_build_packet_arena(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session, DDProtoArena *arena);
+
 /// Frees a packet struct and all of its fields.
 DDProtoError ddproto_free_packet(DDProtoPacket *packet);
 
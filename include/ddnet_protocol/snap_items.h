@@ -266,16 +266,35 @@ typedef struct
 } DDProtoObjPlayerInfo;
 
 /// Skin, name, clan and country info.
+///
+/// If the unpacker options have a @ref DDProtoStringTable the strings are only
+/// stored in the table and the item holds their ids instead, see `interned`.
 typedef struct
 {
 	int32_t type_id;
 	int32_t id;
 
-	char name[DDPROTO_MAX_SKIN_LENGTH];
-	char clan[DDPROTO_MAX_CLAN_LENGTH];
+	union {
+		char name[DDPROTO_MAX_SKIN_LENGTH];
+		/// Id of the name in the string table if `interned` is set.
+		uint32_t name_id;
+	};
+	union {
+		char clan[DDPROTO_MAX_CLAN_LENGTH];
+		/// Id of the clan in the string table if `interned` is set.
+		uint32_t clan_id;
+	};
 	int32_t country;
-	char skin[DDPROTO_MAX_SKIN_LENGTH];
+	union {
+		char skin[DDPROTO_MAX_SKIN_LENGTH];
+		/// Id of the skin in the string table if `interned` is set.
+		uint32_t skin_id;
+	};
 	bool use_custom_color;
+
+	/// Set if `name_id`, `clan_id` and `skin_id` are valid instead of the
+	/// strings.
+	bool interned;
 	int32_t color_body;
 	int32_t color_feet;
 } DDProtoObjClientInfo;
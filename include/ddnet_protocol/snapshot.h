@@ -4,6 +4,8 @@
 extern "C" {
 #endif
 
+#include "allocator.h"
+#include "arena.h"
 #include "common.h"
 #include "errors.h"
 #include "packer.h"
@@ -115,8 +117,48 @@ typedef struct {
 		// `sizeof(DDProtoSnapItem)` otherwise you might run into segfaults
 		size_t len;
 	} items;
+
+	/// Allocator the items and removed keys were allocated with. `NULL` for
+	/// @ref ddproto_allocator.
+	DDProtoAllocator *allocator;
 } DDProtoSnapshot;
 
+/// @brief Caller owned memory for the items and removed keys of snapshots.
+///
+/// If the unpacker options have a snapshot storage @ref
+/// ddproto_decode_snapshot takes the items and removed keys from it instead of
+/// allocating them. Every snapshot takes the next free part of the arrays. If
+/// the remaining capacity is too small the unpacker fails with @ref
+/// DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL.
+///
+/// ```C
+/// DDProtoSnapItem items[1024];
+/// int32_t removed_keys[1024];
+/// DDProtoSnapshotStorage storage = {
+/// 	.items = items,
+/// 	.items_capacity = 1024,
+/// 	.removed_keys = removed_keys,
+/// 	.removed_keys_capacity = 1024,
+/// };
+/// DDProtoDecodeOptions options = {.snap_storage = &storage};
+/// unpacker.options = &options;
+/// ```
+///
+/// Snapshots decoded into the storage must not be freed with @ref
+/// ddproto_free_snapshot. Set `items_len` and `removed_keys_len` back to 0 to
+/// reuse the storage once the snapshots are no longer needed.
+typedef struct DDProtoSnapshotStorage {
+	DDProtoSnapItem *items;
+	size_t items_capacity;
+	/// Amount of items already used by snapshots.
+	size_t items_len;
+
+	int32_t *removed_keys;
+	size_t removed_keys_capacity;
+	/// Amount of removed keys already used by snapshots.
+	size_t removed_keys_len;
+} DDProtoSnapshotStorage;
+
 /// Consumes data from the unpacker and writes the parsed item to the output
 /// parameter `item`.
 DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem *item);
@@ -136,6 +178,9 @@ void ddproto_free_snapshot(DDProtoSnapshot *snap);
 /// This function allocates memory for the snap items. You need to free it by
 /// calling @ref ddproto_free_snapshot. You do not need to free it if the
 /// snapshot is part of a packet and you already call @ref ddproto_free_packet.
+/// If the unpacker options have a @ref DDProtoSnapshotStorage nothing is
+/// allocated. If they have a @ref DDProtoArena the memory is allocated from
+/// the arena and is released by resetting the arena instead.
 DDProtoError ddproto_decode_snapshot(DDProtoUnpacker *unpacker, DDProtoSnapshot *snap);
 
 #ifdef __cplusplus
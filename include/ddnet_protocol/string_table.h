@@ -0,0 +1,92 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "common.h"
+#include "errors.h"
+
+/// Maximum amount of integers a string in a @ref DDProtoStringTable can be
+/// packed into. That is the size of the skin in @ref DDProtoObjClientInfo.
+#define DDPROTO_STRING_TABLE_MAX_INTS 6
+
+/// Default for @ref DDProtoStringTable.max_len. Enough for the names, clans
+/// and skins of a few thousand players.
+#define DDPROTO_STRING_TABLE_MAX_LEN 4096
+
+/// One string of a @ref DDProtoStringTable. The fields are internal, use @ref
+/// ddproto_string_table_str to get the string.
+typedef struct {
+	uint32_t ints[DDPROTO_STRING_TABLE_MAX_INTS];
+	uint8_t num_ints;
+	bool valid_utf8;
+	char str[DDPROTO_STRING_TABLE_MAX_INTS * sizeof(uint32_t)];
+} DDProtoStringTableEntry;
+
+/// @brief Deduplicates the strings of snap items.
+///
+/// The names, clans and skins of the @ref DDProtoObjClientInfo items are sent
+/// in every snapshot but almost never change. If the unpacker options have a
+/// string table they are looked up by their packed integers and only converted the
+/// first time they are seen. The items then hold ids of the strings instead.
+/// Equal strings have the same id so they can be compared without `strcmp`.
+///
+/// ```C
+/// DDProtoStringTable table;
+/// ddproto_string_table_init(&table);
+/// DDProtoDecodeOptions options = {.string_table = &table};
+/// unpacker.options = &options;
+/// // decode snapshots ...
+/// const char *name = ddproto_string_table_str(&table, client_info->name_id);
+/// ddproto_string_table_free(&table);
+/// ```
+///
+/// The table holds at most `max_len` strings. Once it is full new strings fail
+/// with @ref DDPROTO_ERR_STRING_TABLE_FULL. Call @ref
+/// ddproto_string_table_clear to drop the strings that are no longer used,
+/// for example on map change.
+typedef struct DDProtoStringTable {
+	/// The string with the id `n` is at index `n - 1`.
+	DDProtoStringTableEntry *entries;
+	size_t len;
+	size_t capacity;
+
+	/// Maximum amount of strings. Set to @ref DDPROTO_STRING_TABLE_MAX_LEN by
+	/// @ref ddproto_string_table_init and can be changed before the first
+	/// string is added.
+	size_t max_len;
+
+	// open addressing hash map from the packed integers to the ids. 0 marks
+	// an empty slot
+	uint32_t *slots;
+	size_t num_slots;
+} DDProtoStringTable;
+
+/// Initializes an empty table. It does not allocate until the first string is
+/// added.
+void ddproto_string_table_init(DDProtoStringTable *table);
+
+/// Frees all strings of the table. All ids become invalid.
+void ddproto_string_table_free(DDProtoStringTable *table);
+
+/// Removes all strings of the table but keeps its memory for the next ones.
+/// All ids become invalid.
+void ddproto_string_table_clear(DDProtoStringTable *table);
+
+/// @brief Returns the id of the string packed into `ints`.
+///
+/// The string is converted with @ref ddproto_ints_to_str and added to the table
+/// if it is not in there yet. Ids start at 1. Returns 0 and sets `err` if
+/// `num_ints` is bigger than @ref DDPROTO_STRING_TABLE_MAX_INTS, if
+/// `validate_utf8` is set and the string is not valid UTF-8, if the table
+/// already holds `max_len` strings or if no memory could be allocated.
+uint32_t ddproto_string_table_intern(DDProtoStringTable *table, const uint32_t *ints, size_t num_ints, bool validate_utf8, DDProtoError *err);
+
+/// Returns the string with the id `id` or an empty string if the id is 0. The
+/// pointer is only valid until the next string is added to the table.
+const char *ddproto_string_table_str(const DDProtoStringTable *table, uint32_t id);
+
+#ifdef __cplusplus
+}
+#endif
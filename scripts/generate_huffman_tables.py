@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+
+"""
+Generates src/huffman_tables.h from the teeworlds huffman frequency table.
+
+The tree is built exactly like in the reference implementation so the
+resulting codes are compatible with every teeworlds and ddnet peer.
+
+Usage: ./scripts/generate_huffman_tables.py > src/huffman_tables.h
+"""
+
+FREQUENCY_TABLE = [
+	1 << 30, 4545, 2657, 431, 1950, 919, 444, 482, 2244, 617, 838, 542, 715, 1814, 304, 240, 754, 212, 647, 186,
+	283, 131, 146, 166, 543, 164, 167, 136, 179, 859, 363, 113, 157, 154, 204, 108, 137, 180, 202, 176,
+	872, 404, 168, 134, 151, 111, 113, 109, 120, 126, 129, 100, 41, 20, 16, 22, 18, 18, 17, 19,
+	16, 37, 13, 21, 362, 166, 99, 78, 95, 88, 81, 70, 83, 284, 91, 187, 77, 68, 52, 68,
+	59, 66, 61, 638, 71, 157, 50, 46, 69, 43, 11, 24, 13, 19, 10, 12, 12, 20, 14, 9,
+	20, 20, 10, 10, 15, 15, 12, 12, 7, 19, 15, 14, 13, 18, 35, 19, 17, 14, 8, 5,
+	15, 17, 9, 15, 14, 18, 8, 10, 2173, 134, 157, 68, 188, 60, 170, 60, 194, 62, 175, 71,
+	148, 67, 167, 78, 211, 67, 156, 69, 1674, 90, 174, 53, 147, 89, 181, 51, 174, 63, 163, 80,
+	167, 94, 128, 122, 223, 153, 218, 77, 200, 110, 190, 73, 174, 69, 145, 66, 277, 143, 141, 60,
+	136, 53, 180, 57, 142, 57, 158, 61, 166, 112, 152, 92, 26, 22, 21, 28, 20, 26, 30, 21,
+	32, 27, 20, 17, 23, 21, 30, 22, 22, 21, 27, 25, 17, 27, 23, 18, 39, 26, 15, 21,
+	12, 18, 18, 27, 20, 18, 15, 19, 11, 17, 33, 12, 18, 15, 19, 18, 16, 26, 17, 18,
+	9, 10, 25, 22, 22, 17, 20, 16, 6, 16, 15, 20, 14, 18, 24, 335, 1517,
+]
+
+# keep in sync with the enum in src/huffman.c
+HUFFMAN_EOF_SYMBOL = 256
+HUFFMAN_MAX_SYMBOLS = HUFFMAN_EOF_SYMBOL + 1
+HUFFMAN_LUTBITS = 10
+HUFFMAN_MULTI_LUTBITS = 12
+HUFFMAN_MULTI_SYMBOLS = 4
+
+HUFFMAN_ENTRY_EOF = 1 << 0
+HUFFMAN_ENTRY_SUBTABLE = 1 << 1
+
+NO_LEAF = 0xffff
+
+
+class Node:
+	def __init__(self, symbol):
+		self.bits = 0
+		self.num_bits = 0
+		self.leaves = [NO_LEAF, NO_LEAF]
+		self.symbol = symbol & 0xff
+
+	def is_leaf(self):
+		return self.num_bits != 0
+
+
+def bubble_sort_nodes(nodes_left, size):
+	# we can't rely on any other sort for this, it has to produce exactly the
+	# same order as the reference implementation
+	changed = True
+	while changed:
+		changed = False
+		for i in range(size - 1):
+			if nodes_left[i]['frequency'] < nodes_left[i + 1]['frequency']:
+				nodes_left[i], nodes_left[i + 1] = nodes_left[i + 1], nodes_left[i]
+				changed = True
+		size -= 1
+
+
+def construct_tree(frequencies):
+	nodes = []
+	nodes_left = []
+	for i in range(HUFFMAN_MAX_SYMBOLS):
+		node = Node(i)
+		node.num_bits = 0xffffffff
+		nodes.append(node)
+		frequency = 1 if i == HUFFMAN_EOF_SYMBOL else frequencies[i]
+		nodes_left.append({'node_id': i, 'frequency': frequency})
+
+	num_nodes_left = HUFFMAN_MAX_SYMBOLS
+	while num_nodes_left > 1:
+		bubble_sort_nodes(nodes_left, num_nodes_left)
+
+		node = Node(0)
+		node.leaves[0] = nodes_left[num_nodes_left - 1]['node_id']
+		node.leaves[1] = nodes_left[num_nodes_left - 2]['node_id']
+		nodes.append(node)
+		nodes_left[num_nodes_left - 2]['node_id'] = len(nodes) - 1
+		nodes_left[num_nodes_left - 2]['frequency'] += nodes_left[num_nodes_left - 1]['frequency']
+		num_nodes_left -= 1
+
+	def setbits_r(node_id, bits, depth):
+		node = nodes[node_id]
+		if node.leaves[1] != NO_LEAF:
+			setbits_r(node.leaves[1], bits | (1 << depth), depth + 1)
+		if node.leaves[0] != NO_LEAF:
+			setbits_r(node.leaves[0], bits, depth + 1)
+		if node.num_bits:
+			node.bits = bits
+			node.num_bits = depth
+
+	start_node = len(nodes) - 1
+	setbits_r(start_node, 0, 0)
+	return nodes, start_node
+
+
+def walk_tree(nodes, node_id, bits, max_bits):
+	"""Returns (node_id, used_bits). used_bits is 0 if no leaf was reached."""
+	for depth in range(max_bits):
+		node_id = nodes[node_id].leaves[bits & 1]
+		bits >>= 1
+		if nodes[node_id].is_leaf():
+			return node_id, depth + 1
+	return node_id, 0
+
+
+def max_depth(nodes, node_id):
+	node = nodes[node_id]
+	if node.is_leaf():
+		return 0
+	return max(max_depth(nodes, node.leaves[0]), max_depth(nodes, node.leaves[1])) + 1
+
+
+def build_decode_luts(nodes, start_node):
+	luts = []
+	for i in range(1 << HUFFMAN_LUTBITS):
+		node_id, _ = walk_tree(nodes, start_node, i, HUFFMAN_LUTBITS)
+		luts.append(node_id)
+	return luts
+
+
+def build_multi_luts(nodes, start_node):
+	luts = []
+	subtables = []
+	for i in range(1 << HUFFMAN_MULTI_LUTBITS):
+		entry = {'symbols': [], 'num_bits': 0, 'flags': 0}
+		pos = 0
+		while len(entry['symbols']) < HUFFMAN_MULTI_SYMBOLS:
+			node_id, length = walk_tree(nodes, start_node, i >> pos, HUFFMAN_MULTI_LUTBITS - pos)
+			if not length:
+				if not entry['symbols']:
+					# the first code does not fit, use a subtable
+					sub_bits = max_depth(nodes, node_id)
+					entry['flags'] = HUFFMAN_ENTRY_SUBTABLE
+					entry['subtable'] = (len(subtables), sub_bits)
+					for sub in range(1 << sub_bits):
+						sub_node, sub_len = walk_tree(nodes, node_id, sub, sub_bits)
+						subtables.append((sub_node, HUFFMAN_MULTI_LUTBITS + sub_len))
+				break
+
+			pos += length
+			entry['num_bits'] = pos
+			if node_id == HUFFMAN_EOF_SYMBOL:
+				entry['flags'] = HUFFMAN_ENTRY_EOF
+				break
+			entry['symbols'].append(nodes[node_id].symbol)
+		luts.append(entry)
+	return luts, subtables
+
+
+def print_array(declaration, values, per_line):
+	print(f'{declaration} = {{')
+	for i in range(0, len(values), per_line):
+		print('\t' + ' '.join(f'{value},' for value in values[i:i + per_line]))
+	print('};')
+
+
+def format_node(node):
+	return f'{{0x{node.bits:x}, {node.num_bits}, {{0x{node.leaves[0]:x}, 0x{node.leaves[1]:x}}}, {node.symbol}}}'
+
+
+def format_multi_entry(entry):
+	if entry['flags'] & HUFFMAN_ENTRY_SUBTABLE:
+		offset, num_bits = entry['subtable']
+		return f'{{.subtable = {{{offset}, {num_bits}}}, .flags = HUFFMAN_ENTRY_SUBTABLE}}'
+	symbols = entry['symbols'] + [0] * (HUFFMAN_MULTI_SYMBOLS - len(entry['symbols']))
+	flags = 'HUFFMAN_ENTRY_EOF' if entry['flags'] & HUFFMAN_ENTRY_EOF else '0'
+	return f'{{{{{{{", ".join(str(symbol) for symbol in symbols)}}}}}, {len(entry["symbols"])}, {entry["num_bits"]}, {flags}}}'
+
+
+def main():
+	nodes, start_node = construct_tree(FREQUENCY_TABLE)
+	# the encoder packs a code and its length into one 32 bit integer
+	assert max(node.num_bits for node in nodes[:HUFFMAN_MAX_SYMBOLS]) <= 16
+	decode_luts = build_decode_luts(nodes, start_node)
+	multi_luts, multi_subtables = build_multi_luts(nodes, start_node)
+
+	print('// This file is generated by scripts/generate_huffman_tables.py')
+	print('// do not edit it by hand.')
+	print('')
+	print('#pragma once')
+	print('')
+	print('// clang-format off')
+	print('')
+	print('// frequency of every byte, the tables below are built from it. The last entry\n// is not used, EOF always has a frequency of 1')
+	print_array('static const uint32_t FREQUENCY_TABLE[HUFFMAN_MAX_SYMBOLS]', FREQUENCY_TABLE, 20)
+	print('')
+	print('// huffman tree, the first HUFFMAN_MAX_SYMBOLS nodes are the leaves')
+	print_array('static const Node NODES[HUFFMAN_MAX_NODES]', [format_node(node) for node in nodes], 1)
+	print('')
+	print('// longest code of a byte, used to calculate the compress bound')
+	print(f'#define HUFFMAN_DEFAULT_MAX_CODE_BITS {max(node.num_bits for node in nodes[:HUFFMAN_EOF_SYMBOL])}')
+	print('')
+	print('// code of every symbol in the lower 16 bits and its length in the upper 16 bits')
+	print_array('static const uint32_t ENCODE_TABLE[HUFFMAN_MAX_SYMBOLS]', [f'0x{(node.num_bits << 16) | node.bits:x}' for node in nodes[:HUFFMAN_MAX_SYMBOLS]], 8)
+	print('')
+	print('// index into NODES for every HUFFMAN_LUTBITS bit pattern')
+	print_array('static const uint16_t DECODE_LUTS[HUFFMAN_LUTSIZE]', decode_luts, 16)
+	print('')
+	print_array('static const HuffmanMultiEntry MULTI_LUTS[HUFFMAN_MULTI_LUTSIZE]', [format_multi_entry(entry) for entry in multi_luts], 4)
+	print('')
+	print_array('static const HuffmanSubEntry MULTI_SUBTABLES[]', [f'{{{symbol}, {num_bits}}}' for symbol, num_bits in multi_subtables], 8)
+
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,56 @@
+#include <ddnet_protocol/allocator.h>
+
+#include <ddnet_protocol/common.h>
+
+static void *default_alloc(void *ctx, size_t size) {
+	(void)ctx;
+	return malloc(size);
+}
+
+static void default_free(void *ctx, void *ptr) {
+	(void)ctx;
+	free(ptr);
+}
+
+static DDProtoAllocator default_allocator = {
+	.alloc = default_alloc,
+	.free = default_free,
+	.ctx = NULL,
+};
+
+static DDProtoAllocator *global_allocator = &default_allocator;
+
+DDProtoAllocator *ddproto_default_allocator(void) {
+	return &default_allocator;
+}
+
+DDProtoAllocator *ddproto_allocator(void) {
+	return global_allocator;
+}
+
+void ddproto_set_allocator(DDProtoAllocator *allocator) {
+	global_allocator = allocator ? allocator : &default_allocator;
+}
+
+void *ddproto_alloc(DDProtoAllocator *allocator, size_t size) {
+	if(!allocator) {
+		allocator = global_allocator;
+	}
+	void *ptr = allocator->alloc(allocator->ctx, size);
+	if(ptr) {
+		allocator->alloc_calls++;
+		allocator->alloc_bytes += size;
+	}
+	return ptr;
+}
+
+void ddproto_free(DDProtoAllocator *allocator, void *ptr) {
+	if(!ptr) {
+		return;
+	}
+	if(!allocator) {
+		allocator = global_allocator;
+	}
+	allocator->free(allocator->ctx, ptr);
+	allocator->free_calls++;
+}
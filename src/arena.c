@@ -0,0 +1,88 @@
+#include <ddnet_protocol/arena.h>
+
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/common.h>
+
+// rounds `size` up to the next multiple of the arena alignment
+static size_t arena_align(size_t size) {
+	return (size + DDPROTO_ARENA_ALIGNMENT - 1) & ~(size_t)(DDPROTO_ARENA_ALIGNMENT - 1);
+}
+
+// the memory of a block starts after its header
+static uint8_t *arena_block_data(DDProtoArenaBlock *block) {
+	return (uint8_t *)block + arena_align(sizeof(DDProtoArenaBlock));
+}
+
+static DDProtoArenaBlock *arena_block_new(size_t size, DDProtoArenaBlock *next) {
+	DDProtoArenaBlock *block = ddproto_alloc(NULL, arena_align(sizeof(DDProtoArenaBlock)) + size);
+	if(!block) {
+		return NULL;
+	}
+	block->next = next;
+	block->size = size;
+	block->used = 0;
+	return block;
+}
+
+static void arena_blocks_free(DDProtoArenaBlock *block) {
+	while(block) {
+		DDProtoArenaBlock *next = block->next;
+		ddproto_free(NULL, block);
+		block = next;
+	}
+}
+
+void ddproto_arena_init(DDProtoArena *arena, size_t block_size) {
+	arena->blocks = NULL;
+	arena->block_size = block_size ? arena_align(block_size) : DDPROTO_ARENA_DEFAULT_BLOCK_SIZE;
+}
+
+void ddproto_arena_free(DDProtoArena *arena) {
+	arena_blocks_free(arena->blocks);
+	arena->blocks = NULL;
+}
+
+void *ddproto_arena_alloc(DDProtoArena *arena, size_t size) {
+	size = arena_align(size);
+	DDProtoArenaBlock *block = arena->blocks;
+	if(!block || block->size - block->used < size) {
+		// allocations bigger than a block get a block of their own
+		block = arena_block_new(size > arena->block_size ? size : arena->block_size, arena->blocks);
+		if(!block) {
+			return NULL;
+		}
+		arena->blocks = block;
+	}
+
+	void *ptr = arena_block_data(block) + block->used;
+	block->used += size;
+	return ptr;
+}
+
+void ddproto_arena_reset(DDProtoArena *arena) {
+	DDProtoArenaBlock *block = arena->blocks;
+	if(!block) {
+		return;
+	}
+	if(!block->next) {
+		block->used = 0;
+		return;
+	}
+
+	// the arena grew during the last round. One block of the combined size
+	// fits all of it next time
+	size_t capacity = ddproto_arena_capacity(arena);
+	arena_blocks_free(arena->blocks);
+	arena->blocks = arena_block_new(capacity, NULL);
+	if(capacity > arena->block_size) {
+		arena->block_size = capacity;
+	}
+}
+
+size_t ddproto_arena_capacity(const DDProtoArena *arena) {
+	size_t capacity = 0;
+	for(const DDProtoArenaBlock *block = arena->blocks; block; block = block->next) {
+		capacity += block->size;
+	}
+	return capacity;
+}
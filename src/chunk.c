@@ -3,6 +3,9 @@
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/message.h>
 #include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/version.h>
+
+#include "message_schema.h"
 
 size_t ddproto_decode_chunk_header(const uint8_t *buf, DDProtoChunkHeader *header) {
 	header->flags = buf[0] & 0b11000000;
@@ -31,20 +34,22 @@ size_t ddproto_encode_chunk_header(const DDProtoChunkHeader *header, uint8_t *bu
 	return 2;
 }
 
+#define MSG(NAME, CATEGORY, VITAL, ...) [DDPROTO_MSG_KIND_##NAME] = SCHEMA_##VITAL,
+// indexed by DDProtoMessageKind, unknown messages are sent as vital ones
+static const bool VITAL_KINDS[] = {
+	[DDPROTO_MSG_KIND_UNKNOWN] = true,
+	DDPROTO_MESSAGES(MSG, MSG, MSG)};
+#undef MSG
+
 bool ddproto_is_vital_msg(DDProtoMessageKind kind) {
-	return kind != DDPROTO_MSG_KIND_INPUT &&
-	       kind != DDPROTO_MSG_KIND_SNAP &&
-	       kind != DDPROTO_MSG_KIND_SNAPEMPTY &&
-	       kind != DDPROTO_MSG_KIND_SNAPSINGLE &&
-	       kind != DDPROTO_MSG_KIND_SNAPSMALL;
+	return (size_t)kind >= sizeof(VITAL_KINDS) / sizeof(VITAL_KINDS[0]) || VITAL_KINDS[kind];
 }
 
 DDProtoError ddproto_fill_chunk_header(DDProtoChunk *chunk) {
-	uint8_t chunk_payload[DDPROTO_MAX_PACKET_SIZE];
-	DDProtoError encode_err = DDPROTO_ERR_NONE;
-	size_t chunk_payload_len = ddproto_encode_message(chunk, chunk_payload, &encode_err);
-	if(encode_err != DDPROTO_ERR_NONE) {
-		return encode_err;
+	DDProtoError size_err = DDPROTO_ERR_NONE;
+	size_t chunk_payload_len = ddproto_message_encoded_size(&chunk->payload, &size_err);
+	if(size_err != DDPROTO_ERR_NONE) {
+		return size_err;
 	}
 	chunk->header.size = chunk_payload_len;
 	chunk->header.flags = ddproto_is_vital_msg(chunk->payload.kind) ? DDPROTO_CHUNK_FLAG_VITAL : 0;
@@ -47,7 +47,7 @@ size_t ddproto_decode_control(const uint8_t *buf, size_t len, DDProtoControlMess
 
 size_t ddproto_encode_control(const DDProtoControlMessage *msg, uint8_t *buf, DDProtoError *err) {
 	DDProtoPacker packer;
-	ddproto_packer_init(&packer);
+	ddproto_packer_init_buf(&packer, buf + 1, DDPROTO_PACKER_BUFFER_SIZE);
 	buf[0] = msg->kind;
 
 	switch(msg->kind) {
@@ -69,8 +69,5 @@ size_t ddproto_encode_control(const DDProtoControlMessage *msg, uint8_t *buf, DD
 		}
 		break;
 	};
-	if(ddproto_packer_size(&packer) > 0) {
-		memcpy(buf + 1, ddproto_packer_data(&packer), ddproto_packer_size(&packer));
-	}
 	return ddproto_packer_size(&packer) + 1;
 }
@@ -2,69 +2,138 @@
 
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/message.h>
+#include <ddnet_protocol/packer.h>
 #include <ddnet_protocol/packet.h>
 
-size_t ddproto_fetch_chunks(const uint8_t *buf, size_t len, DDProtoPacketHeader *header, OnDDProtoChunk callback, void *ctx, DDProtoError *err) {
-	const uint8_t *start = buf;
-	const uint8_t *end = buf + len;
-	uint8_t num_chunks = 0;
+// stops the iterator
+static bool iterator_fail(DDProtoChunkIterator *iter, DDProtoError err) {
+	iter->err = err;
+	return false;
+}
 
-	while(true) {
-		if(num_chunks == header->num_chunks) {
-			break;
-		}
+void ddproto_chunk_iterator_init(DDProtoChunkIterator *iter, const uint8_t *buf, size_t len, const DDProtoPacketHeader *header) {
+	iter->err = DDPROTO_ERR_NONE;
+	iter->options = NULL;
+	iter->raw = NULL;
+	iter->raw_len = 0;
+	iter->start = buf;
+	iter->buf = buf;
+	iter->end = buf + len;
+	iter->num_chunks = header->num_chunks;
+	iter->chunk = 0;
+}
 
-		size_t space = end - buf;
-		// technically there could be a non vital
-		// chunk that holds a net message without payload
-		// that would be 3 bytes long
-		// 2 bytes chunk header and 1 byte message id
-		//
-		// but in the ddnet, 0.6 and 0.7 protocol no such message exists
-		// so we can assume that it is an invalid message
-		if(space < 4) {
-			if(err) {
-				*err = DDPROTO_ERR_END_OF_BUFFER;
-			}
-
-			return 0;
-		}
+// reads the header of the next chunk and makes sure its payload is there
+static bool iterator_read_header(DDProtoChunkIterator *iter, DDProtoChunkHeader *header) {
+	if(iter->err != DDPROTO_ERR_NONE || iter->chunk == iter->num_chunks) {
+		return false;
+	}
+	iter->chunk++;
 
-		DDProtoChunkHeader chunk_header;
-		buf += ddproto_decode_chunk_header(buf, &chunk_header);
+	size_t space = iter->end - iter->buf;
+	// technically there could be a non vital
+	// chunk that holds a net message without payload
+	// that would be 3 bytes long
+	// 2 bytes chunk header and 1 byte message id
+	//
+	// but in the ddnet, 0.6 and 0.7 protocol no such message exists
+	// so we can assume that it is an invalid message
+	if(space < 4) {
+		return iterator_fail(iter, DDPROTO_ERR_END_OF_BUFFER);
+	}
 
-		space = end - buf;
-		if(space < chunk_header.size) {
-			if(err) {
-				*err = DDPROTO_ERR_END_OF_BUFFER;
-			}
+	size_t header_size = ddproto_decode_chunk_header(iter->buf, header);
+	if(space - header_size < header->size) {
+		return iterator_fail(iter, DDPROTO_ERR_END_OF_BUFFER);
+	}
 
-			return 0;
-		}
+	iter->raw = iter->buf;
+	iter->raw_len = header_size + header->size;
+	iter->buf += iter->raw_len;
+	return true;
+}
+
+bool ddproto_chunk_iterator_next(DDProtoChunkIterator *iter, DDProtoChunk *chunk) {
+	if(!iterator_read_header(iter, &chunk->header)) {
+		return false;
+	}
+
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, iter->buf - chunk->header.size, chunk->header.size);
+	if(iter->options) {
+		unpacker.options = iter->options;
+	}
+	DDProtoError chunk_err = ddproto_unpack_message(chunk, &unpacker);
+
+	// unknown message ids are not a fatal error in teeworlds
+	if(chunk_err != DDPROTO_ERR_NONE && chunk_err != DDPROTO_ERR_UNKNOWN_MESSAGE) {
+		return iterator_fail(iter, chunk_err);
+	}
+	return true;
+}
+
+bool ddproto_chunk_iterator_skip(DDProtoChunkIterator *iter, DDProtoChunkHeader *header) {
+	return iterator_read_header(iter, header);
+}
+
+size_t ddproto_chunk_iterator_offset(const DDProtoChunkIterator *iter) {
+	return iter->buf - iter->start;
+}
 
-		DDProtoChunk chunk;
-		chunk.header = chunk_header;
-		DDProtoError chunk_err = ddproto_decode_message(&chunk, buf);
+// passes every chunk of the iterator to `callback`
+static size_t fetch_chunks(DDProtoChunkIterator *iter, OnDDProtoChunk callback, void *ctx, DDProtoError *err) {
+	DDProtoChunk chunk;
+	while(ddproto_chunk_iterator_next(iter, &chunk)) {
 		callback(ctx, &chunk);
-		num_chunks++;
-		// unknown message ids are not a fatal error in teeworlds
-		if(chunk_err != DDPROTO_ERR_NONE && chunk_err != DDPROTO_ERR_UNKNOWN_MESSAGE) {
-			if(err) {
-				*err = chunk_err;
-			}
-
-			return 0;
+	}
+
+	if(iter->err != DDPROTO_ERR_NONE) {
+		if(err) {
+			*err = iter->err;
+		}
+
+		return 0;
+	}
+
+	return ddproto_chunk_iterator_offset(iter);
+}
+
+size_t ddproto_fetch_chunks(const uint8_t *buf, size_t len, DDProtoPacketHeader *header, OnDDProtoChunk callback, void *ctx, DDProtoError *err) {
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, buf, len, header);
+	return fetch_chunks(&iter, callback, ctx, err);
+}
+
+size_t ddproto_fetch_chunks_into(const uint8_t *buf, size_t len, DDProtoPacketHeader *header, const DDProtoDecodeOptions *options, OnDDProtoChunk callback, void *ctx, DDProtoError *err) {
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, buf, len, header);
+	iter.options = options;
+	return fetch_chunks(&iter, callback, ctx, err);
+}
+
+size_t ddproto_index_chunks(const uint8_t *buf, size_t len, const DDProtoPacketHeader *header, DDProtoLazyChunk *chunks, size_t capacity, DDProtoError *err) {
+	if(header->num_chunks > capacity) {
+		if(err) {
+			*err = DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
 		}
-		buf += chunk_header.size;
+
+		return 0;
+	}
+
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, buf, len, header);
+	for(size_t i = 0; i < header->num_chunks && ddproto_chunk_iterator_skip(&iter, &chunks[i].header); i++) {
+		chunks[i].payload = iter.raw + iter.raw_len - chunks[i].header.size;
+		chunks[i].strings = NULL;
 	}
 
-	if(num_chunks < header->num_chunks) {
+	if(iter.err != DDPROTO_ERR_NONE) {
 		if(err) {
-			*err = DDPROTO_ERR_END_OF_BUFFER;
+			*err = iter.err;
 		}
 
 		return 0;
 	}
 
-	return buf - start;
+	return ddproto_chunk_iterator_offset(&iter);
 }
@@ -1,27 +1,8 @@
 #include <ddnet_protocol/huffman.h>
 
+#include <ddnet_protocol/allocator.h>
 #include <ddnet_protocol/errors.h>
 
-static const uint32_t FREQUENCY_TABLE[256 + 1] = {
-	1 << 30, 4545, 2657, 431, 1950, 919, 444, 482, 2244, 617, 838, 542, 715, 1814, 304, 240, 754, 212, 647, 186,
-	283, 131, 146, 166, 543, 164, 167, 136, 179, 859, 363, 113, 157, 154, 204, 108, 137, 180, 202, 176,
-	872, 404, 168, 134, 151, 111, 113, 109, 120, 126, 129, 100, 41, 20, 16, 22, 18, 18, 17, 19,
-	16, 37, 13, 21, 362, 166, 99, 78, 95, 88, 81, 70, 83, 284, 91, 187, 77, 68, 52, 68,
-	59, 66, 61, 638, 71, 157, 50, 46, 69, 43, 11, 24, 13, 19, 10, 12, 12, 20, 14, 9,
-	20, 20, 10, 10, 15, 15, 12, 12, 7, 19, 15, 14, 13, 18, 35, 19, 17, 14, 8, 5,
-	15, 17, 9, 15, 14, 18, 8, 10, 2173, 134, 157, 68, 188, 60, 170, 60, 194, 62, 175, 71,
-	148, 67, 167, 78, 211, 67, 156, 69, 1674, 90, 174, 53, 147, 89, 181, 51, 174, 63, 163, 80,
-	167, 94, 128, 122, 223, 153, 218, 77, 200, 110, 190, 73, 174, 69, 145, 66, 277, 143, 141, 60,
-	136, 53, 180, 57, 142, 57, 158, 61, 166, 112, 152, 92, 26, 22, 21, 28, 20, 26, 30, 21,
-	32, 27, 20, 17, 23, 21, 30, 22, 22, 21, 27, 25, 17, 27, 23, 18, 39, 26, 15, 21,
-	12, 18, 18, 27, 20, 18, 15, 19, 11, 17, 33, 12, 18, 15, 19, 18, 16, 26, 17, 18,
-	9, 10, 25, 22, 22, 17, 20, 16, 6, 16, 15, 20, 14, 18, 24, 335, 1517};
-
-typedef struct HuffmanConstructNode {
-	uint16_t node_id;
-	uint32_t frequency;
-} HuffmanConstructNode;
-
 typedef struct Node {
 	// symbol
 	uint32_t bits;
@@ -34,147 +15,209 @@ typedef struct Node {
 	uint8_t symbol;
 } Node;
 
+// keep in sync with scripts/generate_huffman_tables.py
 enum {
 	HUFFMAN_EOF_SYMBOL = 256,
 
 	HUFFMAN_MAX_SYMBOLS = HUFFMAN_EOF_SYMBOL + 1,
 	HUFFMAN_MAX_NODES = (HUFFMAN_MAX_SYMBOLS * 2) - 1,
+	HUFFMAN_NO_LEAF = 0xffff,
 
 	HUFFMAN_LUTBITS = 10,
 	HUFFMAN_LUTSIZE = (1 << HUFFMAN_LUTBITS),
-	HUFFMAN_LUTMASK = (HUFFMAN_LUTSIZE - 1)
+	HUFFMAN_LUTMASK = (HUFFMAN_LUTSIZE - 1),
+
+	// the multi symbol decoder resolves up to HUFFMAN_MULTI_SYMBOLS bytes per
+	// lookup. Codes that do not fit into HUFFMAN_MULTI_LUTBITS are resolved
+	// by a second lookup in a subtable
+	HUFFMAN_MULTI_LUTBITS = 12,
+	HUFFMAN_MULTI_LUTSIZE = (1 << HUFFMAN_MULTI_LUTBITS),
+	HUFFMAN_MULTI_LUTMASK = (HUFFMAN_MULTI_LUTSIZE - 1),
+	HUFFMAN_MULTI_SYMBOLS = 4,
+
+	// the code and its length share one 32 bit integer in the encode table.
+	// Custom frequency tables are flattened until all codes fit
+	HUFFMAN_MAX_CODE_BITS = 16,
+
+	// codes take at most HUFFMAN_MAX_CODE_BITS bits and at most 7 bits are
+	// left over after flushing a word so 3 codes always fit into the 64 bit
+	// buffer
+	HUFFMAN_ENCODE_SYMBOLS_PER_WORD = 3,
+
+	// amount of streams the batch functions work on at the same time
+	HUFFMAN_BATCH_LANES = 4,
 };
 
-static Node nodes[HUFFMAN_MAX_NODES];
-static Node *decode_luts[HUFFMAN_LUTSIZE];
-static Node *start_node;
-static int32_t num_nodes;
-bool huffman_initialized = false;
+typedef enum {
+	// the entry ends with the EOF symbol
+	HUFFMAN_ENTRY_EOF = 1 << 0,
+
+	// the code is longer than HUFFMAN_MULTI_LUTBITS bits and has to be looked
+	// up in the subtable
+	HUFFMAN_ENTRY_SUBTABLE = 1 << 1,
+} HuffmanEntryFlag;
+
+// first level entry of the multi symbol decode table
+typedef struct HuffmanMultiEntry {
+	union {
+		// the decoded bytes, only the first `num_symbols` are valid
+		uint8_t symbols[HUFFMAN_MULTI_SYMBOLS];
+
+		// set if flags has HUFFMAN_ENTRY_SUBTABLE
+		struct {
+			uint16_t offset;
+			uint8_t num_bits;
+		} subtable;
+	};
+	uint8_t num_symbols;
+
+	// amount of bits consumed by all symbols in this entry
+	uint8_t num_bits;
+	uint8_t flags;
+} HuffmanMultiEntry;
+
+// second level entry of the multi symbol decode table
+typedef struct HuffmanSubEntry {
+	// can be HUFFMAN_EOF_SYMBOL
+	uint16_t symbol;
+
+	// full length of the code including the first level bits
+	uint8_t num_bits;
+} HuffmanSubEntry;
+
+#include "huffman_tables.h"
+
+struct DDProtoHuffman {
+	// code of every symbol in the lower 16 bits and its length in the upper
+	// 16 bits
+	const uint32_t *encode_table;
+	const HuffmanMultiEntry *multi_luts;
+	const HuffmanSubEntry *subtables;
+
+	// length of the longest code of a byte, EOF is not included
+	uint32_t max_code_bits;
+};
 
-static void bubble_sort_nodes(HuffmanConstructNode **list, int32_t size) {
-	uint8_t changed = 1;
-	HuffmanConstructNode *temp;
+static const DDProtoHuffman HUFFMAN_DEFAULT = {
+	.encode_table = ENCODE_TABLE,
+	.multi_luts = MULTI_LUTS,
+	.subtables = MULTI_SUBTABLES,
+	.max_code_bits = HUFFMAN_DEFAULT_MAX_CODE_BITS,
+};
 
-	while(changed) {
-		changed = 0;
-		for(int32_t i = 0; i < size - 1; i++) {
-			if(list[i]->frequency < list[i + 1]->frequency) {
-				temp = list[i];
-				list[i] = list[i + 1];
-				list[i + 1] = temp;
-				changed = 1;
-			}
-		}
-		size--;
-	}
+const DDProtoHuffman *ddproto_huffman_default(void) {
+	return &HUFFMAN_DEFAULT;
 }
 
-static void setbits_r(Node *node, int32_t bits, uint32_t depth) {
-	if(node->leaves[1] != 0xffff) {
-		setbits_r(&nodes[node->leaves[1]], bits | (1 << depth), depth + 1);
-	}
-	if(node->leaves[0] != 0xffff) {
-		setbits_r(&nodes[node->leaves[0]], bits, depth + 1);
-	}
-
-	if(node->num_bits) {
-		node->bits = bits;
-		node->num_bits = depth;
-	}
+static uint64_t read_le64(const uint8_t *buf) {
+	uint64_t value;
+	memcpy(&value, buf, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap64(value);
+#endif
+	return value;
 }
 
-static void construct_tree(const uint32_t *frequencies) {
-	HuffmanConstructNode nodes_left_storage[HUFFMAN_MAX_SYMBOLS];
-	HuffmanConstructNode *nodes_left[HUFFMAN_MAX_SYMBOLS];
-	int32_t num_nodes_left = HUFFMAN_MAX_SYMBOLS;
+static void write_le64(uint8_t *buf, uint64_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap64(value);
+#endif
+	memcpy(buf, &value, sizeof(value));
+}
 
-	// add the symbols
-	for(int32_t i = 0; i < HUFFMAN_MAX_SYMBOLS; i++) {
-		nodes[i].num_bits = 0xffffffff;
-		nodes[i].symbol = i;
-		nodes[i].leaves[0] = 0xffff;
-		nodes[i].leaves[1] = 0xffff;
+// state of one bitstream, shared by the encoder and the decoder
+typedef struct HuffmanStream {
+	const uint8_t *src;
+	const uint8_t *srcend;
+	uint8_t *dst;
+	uint8_t *dstend;
+	uint64_t bits;
+	uint32_t bitcount;
+} HuffmanStream;
+
+static void huffman_stream_init(HuffmanStream *stream, const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len) {
+	stream->src = input;
+	stream->srcend = input + input_len;
+	stream->dst = output;
+	stream->dstend = output + output_len;
+	stream->bits = 0;
+	stream->bitcount = 0;
+}
 
-		if(i == HUFFMAN_EOF_SYMBOL) {
-			nodes_left_storage[i].frequency = 1;
-		} else {
-			nodes_left_storage[i].frequency = frequencies[i];
+// encodes the rest of the stream and returns the size of the output
+static size_t huffman_encode_finish(const DDProtoHuffman *huffman, HuffmanStream *stream, const uint8_t *output, DDProtoError *err) {
+	const uint32_t *encode_table = huffman->encode_table;
+	const uint8_t *src = stream->src;
+	const uint8_t *srcend = stream->srcend;
+	uint8_t *dst = stream->dst;
+	uint8_t *dstend = stream->dstend;
+	uint64_t bits = stream->bits;
+	uint32_t bitcount = stream->bitcount;
+
+	// every word store writes 8 bytes but only advances by the full bytes
+	// in the buffer. So the bounds are checked once per word instead of once
+	// per byte
+	while(srcend - src >= HUFFMAN_ENCODE_SYMBOLS_PER_WORD && dstend - dst >= 8) {
+		for(uint32_t i = 0; i < HUFFMAN_ENCODE_SYMBOLS_PER_WORD; i++) {
+			const uint32_t code = encode_table[*src++];
+			bits |= (uint64_t)(code & 0xffff) << bitcount;
+			bitcount += code >> 16;
 		}
-		nodes_left_storage[i].node_id = i;
-		nodes_left[i] = &nodes_left_storage[i];
-	}
-
-	num_nodes = HUFFMAN_MAX_SYMBOLS;
-
-	// construct the table
-	while(num_nodes_left > 1) {
-		// we can't rely on stdlib's qsort for this, it can generate different results on different implementations
-		bubble_sort_nodes(nodes_left, num_nodes_left);
 
-		nodes[num_nodes].num_bits = 0;
-		nodes[num_nodes].leaves[0] = nodes_left[num_nodes_left - 1]->node_id;
-		nodes[num_nodes].leaves[1] = nodes_left[num_nodes_left - 2]->node_id;
-		nodes_left[num_nodes_left - 2]->node_id = num_nodes;
-
-		nodes_left[num_nodes_left - 2]->frequency = nodes_left[num_nodes_left - 1]->frequency + nodes_left[num_nodes_left - 2]->frequency;
-		num_nodes++;
-		num_nodes_left--;
+		write_le64(dst, bits);
+		dst += bitcount >> 3;
+		bits >>= bitcount & ~7u;
+		bitcount &= 7;
 	}
 
-	start_node = &nodes[num_nodes - 1];
+	// the remaining symbols and EOF are written byte by byte
+	while(true) {
+		const uint32_t code = encode_table[src == srcend ? HUFFMAN_EOF_SYMBOL : *src];
+		bits |= (uint64_t)(code & 0xffff) << bitcount;
+		bitcount += code >> 16;
 
-	// build symbol bits
-	setbits_r(start_node, 0, 0);
-}
-
-static void huffman_init(void) {
-	if(huffman_initialized) {
-		return;
-	}
-	huffman_initialized = 1;
-	const uint32_t *frequencies = FREQUENCY_TABLE;
-
-	// make sure to cleanout every thing
-	memset(nodes, 0, sizeof(nodes));
-	memset((void *)decode_luts, 0, sizeof(decode_luts));
-
-	start_node = NULL;
-	num_nodes = 0;
-
-	// construct the tree
-	construct_tree(frequencies);
-
-	// build decode LUT
-	for(int32_t i = 0; i < HUFFMAN_LUTSIZE; i++) {
-		uint32_t bits = i;
-		int32_t counter;
-		Node *node = start_node;
-		for(counter = 0; counter < HUFFMAN_LUTBITS; counter++) {
-			node = &nodes[node->leaves[bits & 1]];
-			bits >>= 1;
-
-			if(!node) {
-				break;
-			}
-
-			if(node->num_bits) {
-				decode_luts[i] = node;
-				break;
+		while(bitcount >= 8) {
+			if(dst == dstend) {
+				*err = DDPROTO_ERR_BUFFER_FULL;
+				return -1;
 			}
+			*dst++ = (uint8_t)(bits & 0xff);
+			bits >>= 8;
+			bitcount -= 8;
 		}
 
-		if(counter == HUFFMAN_LUTBITS) {
-			decode_luts[i] = node;
+		if(src == srcend) {
+			break;
 		}
+		src++;
 	}
+
+	// write out the last bits
+	if(dst == dstend) {
+		*err = DDPROTO_ERR_BUFFER_FULL;
+		return -1;
+	}
+	*dst++ = (uint8_t)bits;
+
+	// return the size of the output
+	return (dst - output);
+}
+
+size_t ddproto_huffman_compress_with(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
+	HuffmanStream stream;
+	huffman_stream_init(&stream, input, input_len, output, output_len);
+	return huffman_encode_finish(huffman, &stream, output, err);
 }
 
 size_t ddproto_huffman_compress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
-	huffman_init();
+	return ddproto_huffman_compress_with(&HUFFMAN_DEFAULT, input, input_len, output, output_len, err);
+}
+
+size_t ddproto_huffman_compress_reference(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
 	// this macro loads a symbol for a byte into bits and bitcount
 #define HUFFMAN_MACRO_LOADSYMBOL(sym) \
-	bits |= nodes[sym].bits << bitcount; \
-	bitcount += nodes[sym].num_bits;
+	bits |= NODES[sym].bits << bitcount; \
+	bitcount += NODES[sym].num_bits;
 
 	// this macro writes the symbol stored in bits and bitcount to the dst pointer
 #define HUFFMAN_MACRO_WRITE() \
@@ -234,8 +277,321 @@ size_t ddproto_huffman_compress(const uint8_t *input, size_t input_len, uint8_t
 #undef HUFFMAN_MACRO_WRITE
 }
 
+// decodes the rest of the stream and returns the size of the output
+static size_t huffman_decode_finish(const DDProtoHuffman *huffman, HuffmanStream *stream, const uint8_t *output, DDProtoError *err) {
+	const HuffmanMultiEntry *multi_luts = huffman->multi_luts;
+	const HuffmanSubEntry *subtables = huffman->subtables;
+	const uint8_t *src = stream->src;
+	const uint8_t *srcend = stream->srcend;
+	uint8_t *dst = stream->dst;
+	uint8_t *dstend = stream->dstend;
+	uint64_t bits = stream->bits;
+	uint32_t bitcount = stream->bitcount;
+
+	while(true) {
+		// fast path: decode as many entries as possible without checking the
+		// input bounds per entry
+		bool fast = true;
+		while(fast) {
+			if(srcend - src >= 8) {
+				// refill to at least 56 bits. The bytes above bitcount are
+				// read again on the next refill, or-ing them in twice is
+				// harmless
+				bits |= read_le64(src) << bitcount;
+				src += (63 - bitcount) >> 3;
+				bitcount |= 56;
+			} else {
+				while(bitcount <= 56 && src != srcend) {
+					bits |= (uint64_t)(*src++) << bitcount;
+					bitcount += 8;
+				}
+				if(bitcount < HUFFMAN_MULTI_LUTBITS) {
+					break;
+				}
+			}
+
+			while(bitcount >= HUFFMAN_MULTI_LUTBITS) {
+				if(dstend - dst < HUFFMAN_MULTI_SYMBOLS) {
+					fast = false;
+					break;
+				}
+				const HuffmanMultiEntry *entry = &multi_luts[bits & HUFFMAN_MULTI_LUTMASK];
+				if(entry->flags & HUFFMAN_ENTRY_SUBTABLE) {
+					const uint32_t sub_mask = (1u << entry->subtable.num_bits) - 1;
+					const HuffmanSubEntry *sub = &subtables[entry->subtable.offset + ((bits >> HUFFMAN_MULTI_LUTBITS) & sub_mask)];
+					if(sub->num_bits > bitcount || sub->symbol == HUFFMAN_EOF_SYMBOL) {
+						fast = false;
+						break;
+					}
+					*dst++ = sub->symbol;
+					bits >>= sub->num_bits;
+					bitcount -= sub->num_bits;
+					continue;
+				}
+				if(entry->flags) {
+					// EOF, let the slow path handle it
+					fast = false;
+					break;
+				}
+				memcpy(dst, entry->symbols, HUFFMAN_MULTI_SYMBOLS);
+				dst += entry->num_symbols;
+				bits >>= entry->num_bits;
+				bitcount -= entry->num_bits;
+			}
+		}
+
+		// slow path: decode exactly one entry with all bounds checked
+		while(bitcount <= 56 && src != srcend) {
+			bits |= (uint64_t)(*src++) << bitcount;
+			bitcount += 8;
+		}
+
+		const HuffmanMultiEntry *entry = &multi_luts[bits & HUFFMAN_MULTI_LUTMASK];
+		if(entry->flags & HUFFMAN_ENTRY_SUBTABLE) {
+			const uint32_t sub_mask = (1u << entry->subtable.num_bits) - 1;
+			const HuffmanSubEntry *sub = &subtables[entry->subtable.offset + ((bits >> HUFFMAN_MULTI_LUTBITS) & sub_mask)];
+			if(sub->num_bits > bitcount) {
+				*err = DDPROTO_ERR_END_OF_BUFFER;
+				return -1;
+			}
+			bits >>= sub->num_bits;
+			bitcount -= sub->num_bits;
+
+			if(sub->symbol == HUFFMAN_EOF_SYMBOL) {
+				break;
+			}
+			if(dst == dstend) {
+				*err = DDPROTO_ERR_BUFFER_FULL;
+				return -1;
+			}
+			*dst++ = sub->symbol;
+			continue;
+		}
+
+		if(entry->num_bits > bitcount) {
+			*err = DDPROTO_ERR_END_OF_BUFFER;
+			return -1;
+		}
+		if((size_t)(dstend - dst) < entry->num_symbols) {
+			*err = DDPROTO_ERR_BUFFER_FULL;
+			return -1;
+		}
+		memcpy(dst, entry->symbols, entry->num_symbols);
+		dst += entry->num_symbols;
+		bits >>= entry->num_bits;
+		bitcount -= entry->num_bits;
+
+		if(entry->flags & HUFFMAN_ENTRY_EOF) {
+			break;
+		}
+	}
+
+	// return the size of the decompressed buffer
+	return (dst - output);
+}
+
+size_t ddproto_huffman_decompress_with(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
+	HuffmanStream stream;
+	huffman_stream_init(&stream, input, input_len, output, output_len);
+	return huffman_decode_finish(huffman, &stream, output, err);
+}
+
 size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
-	huffman_init();
+	return ddproto_huffman_decompress_with(&HUFFMAN_DEFAULT, input, input_len, output, output_len, err);
+}
+
+// Encodes all HUFFMAN_BATCH_LANES streams in lockstep. Every stream on its
+// own is a chain of dependent shifts, running several of them at once lets
+// the cpu overlap the chains. The bounds are checked once per block of
+// rounds instead of once per word. Returns the index of a lane that is too
+// close to the end of its input or output for another round.
+static uint32_t huffman_encode_lanes(const DDProtoHuffman *huffman, HuffmanStream *lanes) {
+	const uint32_t *encode_table = huffman->encode_table;
+	const uint8_t *src[HUFFMAN_BATCH_LANES];
+	uint8_t *dst[HUFFMAN_BATCH_LANES];
+	uint64_t bits[HUFFMAN_BATCH_LANES];
+	uint32_t bitcount[HUFFMAN_BATCH_LANES];
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+		src[lane] = lanes[lane].src;
+		dst[lane] = lanes[lane].dst;
+		bits[lane] = lanes[lane].bits;
+		bitcount[lane] = lanes[lane].bitcount;
+	}
+
+	uint32_t stopped = 0;
+	while(true) {
+		// a word consumes HUFFMAN_ENCODE_SYMBOLS_PER_WORD input bytes and
+		// stores 8 output bytes but advances by at most 6
+		size_t rounds = 0;
+		for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+			size_t input_rounds = (lanes[lane].srcend - src[lane]) / HUFFMAN_ENCODE_SYMBOLS_PER_WORD;
+			size_t output_rounds = (lanes[lane].dstend - dst[lane]) / 8;
+			size_t lane_rounds = input_rounds < output_rounds ? input_rounds : output_rounds;
+			if(lane == 0 || lane_rounds < rounds) {
+				rounds = lane_rounds;
+				stopped = lane;
+			}
+		}
+		if(rounds == 0) {
+			break;
+		}
+
+		for(; rounds; rounds--) {
+			for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+				for(uint32_t i = 0; i < HUFFMAN_ENCODE_SYMBOLS_PER_WORD; i++) {
+					const uint32_t code = encode_table[src[lane][i]];
+					bits[lane] |= (uint64_t)(code & 0xffff) << bitcount[lane];
+					bitcount[lane] += code >> 16;
+				}
+				src[lane] += HUFFMAN_ENCODE_SYMBOLS_PER_WORD;
+
+				write_le64(dst[lane], bits[lane]);
+				dst[lane] += bitcount[lane] >> 3;
+				bits[lane] >>= bitcount[lane] & ~7u;
+				bitcount[lane] &= 7;
+			}
+		}
+	}
+
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+		lanes[lane].src = src[lane];
+		lanes[lane].dst = dst[lane];
+		lanes[lane].bits = bits[lane];
+		lanes[lane].bitcount = bitcount[lane];
+	}
+	return stopped;
+}
+
+// Decodes all HUFFMAN_BATCH_LANES streams in lockstep, one table entry per
+// lane and round. Same idea as huffman_encode_lanes, the lookup of the next
+// entry depends on the previous one so a single stream mostly waits on
+// memory. Returns the index of a lane that is too close to the end of its
+// input or output or that reached its EOF symbol.
+static uint32_t huffman_decode_lanes(const DDProtoHuffman *huffman, HuffmanStream *lanes) {
+	const HuffmanMultiEntry *multi_luts = huffman->multi_luts;
+	const HuffmanSubEntry *subtables = huffman->subtables;
+	const uint8_t *src[HUFFMAN_BATCH_LANES];
+	uint8_t *dst[HUFFMAN_BATCH_LANES];
+	uint64_t bits[HUFFMAN_BATCH_LANES];
+	uint32_t bitcount[HUFFMAN_BATCH_LANES];
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+		src[lane] = lanes[lane].src;
+		dst[lane] = lanes[lane].dst;
+		bits[lane] = lanes[lane].bits;
+		bitcount[lane] = lanes[lane].bitcount;
+	}
+
+	uint32_t stopped = 0;
+	while(true) {
+		// every round refills 8 bytes and advances by at most 2 bytes plus
+		// the 8 bytes that can be buffered in bits. An entry writes
+		// HUFFMAN_MULTI_SYMBOLS bytes
+		size_t rounds = 0;
+		for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+			size_t input_left = lanes[lane].srcend - src[lane];
+			size_t input_rounds = input_left >= 16 ? (input_left - 16) / 2 : 0;
+			size_t output_rounds = (lanes[lane].dstend - dst[lane]) / HUFFMAN_MULTI_SYMBOLS;
+			size_t lane_rounds = input_rounds < output_rounds ? input_rounds : output_rounds;
+			if(lane == 0 || lane_rounds < rounds) {
+				rounds = lane_rounds;
+				stopped = lane;
+			}
+		}
+		if(rounds == 0) {
+			break;
+		}
+
+		for(; rounds; rounds--) {
+			for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+				// refill to at least 56 bits which is enough for any code
+				bits[lane] |= read_le64(src[lane]) << bitcount[lane];
+				src[lane] += (63 - bitcount[lane]) >> 3;
+				bitcount[lane] |= 56;
+
+				const HuffmanMultiEntry *entry = &multi_luts[bits[lane] & HUFFMAN_MULTI_LUTMASK];
+				if(entry->flags & HUFFMAN_ENTRY_SUBTABLE) {
+					const uint32_t sub_mask = (1u << entry->subtable.num_bits) - 1;
+					const HuffmanSubEntry *sub = &subtables[entry->subtable.offset + ((bits[lane] >> HUFFMAN_MULTI_LUTBITS) & sub_mask)];
+					if(sub->symbol == HUFFMAN_EOF_SYMBOL) {
+						stopped = lane;
+						goto done;
+					}
+					*dst[lane]++ = sub->symbol;
+					bits[lane] >>= sub->num_bits;
+					bitcount[lane] -= sub->num_bits;
+					continue;
+				}
+				if(entry->flags) {
+					stopped = lane;
+					goto done;
+				}
+				memcpy(dst[lane], entry->symbols, HUFFMAN_MULTI_SYMBOLS);
+				dst[lane] += entry->num_symbols;
+				bits[lane] >>= entry->num_bits;
+				bitcount[lane] -= entry->num_bits;
+			}
+		}
+	}
+
+done:
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+		lanes[lane].src = src[lane];
+		lanes[lane].dst = dst[lane];
+		lanes[lane].bits = bits[lane];
+		lanes[lane].bitcount = bitcount[lane];
+	}
+	return stopped;
+}
+
+typedef uint32_t (*HuffmanLanesFunc)(const DDProtoHuffman *huffman, HuffmanStream *lanes);
+typedef size_t (*HuffmanFinishFunc)(const DDProtoHuffman *huffman, HuffmanStream *stream, const uint8_t *output, DDProtoError *err);
+
+static void huffman_finish_buffer(const DDProtoHuffman *huffman, HuffmanStream *stream, DDProtoHuffmanBuffer *buffer, HuffmanFinishFunc finish) {
+	buffer->err = DDPROTO_ERR_NONE;
+	buffer->result_len = finish(huffman, stream, buffer->output, &buffer->err);
+}
+
+// A lane that stops is finished on its own and then picks up the next
+// buffer. Once there are no buffers left the remaining lanes are finished
+// one after another.
+static inline void huffman_batch(const DDProtoHuffman *huffman, DDProtoHuffmanBuffer *buffers, size_t num_buffers, HuffmanLanesFunc run_lanes, HuffmanFinishFunc finish) {
+	HuffmanStream lanes[HUFFMAN_BATCH_LANES];
+	DDProtoHuffmanBuffer *lane_buffers[HUFFMAN_BATCH_LANES] = {NULL};
+	size_t next = 0;
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES && next < num_buffers; lane++) {
+		DDProtoHuffmanBuffer *buffer = lane_buffers[lane] = &buffers[next++];
+		huffman_stream_init(&lanes[lane], buffer->input, buffer->input_len, buffer->output, buffer->output_len);
+	}
+
+	if(num_buffers >= HUFFMAN_BATCH_LANES) {
+		while(true) {
+			uint32_t lane = run_lanes(huffman, lanes);
+			huffman_finish_buffer(huffman, &lanes[lane], lane_buffers[lane], finish);
+			if(next == num_buffers) {
+				lane_buffers[lane] = NULL;
+				break;
+			}
+			DDProtoHuffmanBuffer *buffer = lane_buffers[lane] = &buffers[next++];
+			huffman_stream_init(&lanes[lane], buffer->input, buffer->input_len, buffer->output, buffer->output_len);
+		}
+	}
+
+	for(uint32_t lane = 0; lane < HUFFMAN_BATCH_LANES; lane++) {
+		if(lane_buffers[lane]) {
+			huffman_finish_buffer(huffman, &lanes[lane], lane_buffers[lane], finish);
+		}
+	}
+}
+
+void ddproto_huffman_compress_batch(const DDProtoHuffman *huffman, DDProtoHuffmanBuffer *buffers, size_t num_buffers) {
+	huffman_batch(huffman, buffers, num_buffers, huffman_encode_lanes, huffman_encode_finish);
+}
+
+void ddproto_huffman_decompress_batch(const DDProtoHuffman *huffman, DDProtoHuffmanBuffer *buffers, size_t num_buffers) {
+	huffman_batch(huffman, buffers, num_buffers, huffman_decode_lanes, huffman_decode_finish);
+}
+
+size_t ddproto_huffman_decompress_reference(const uint8_t *input, size_t input_len, uint8_t *output, size_t output_len, DDProtoError *err) {
 	// setup buffer pointers
 	uint8_t *dst = output;
 	const uint8_t *src = input;
@@ -245,14 +601,14 @@ size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_
 	uint32_t bits = 0;
 	uint32_t bitcount = 0;
 
-	Node *eof = &nodes[HUFFMAN_EOF_SYMBOL];
-	Node *node = 0;
+	const Node *eof = &NODES[HUFFMAN_EOF_SYMBOL];
+	const Node *node = 0;
 
 	while(1) {
 		// {a} try to load a node now, this will reduce dependency at location {d}
 		node = 0;
 		if(bitcount >= HUFFMAN_LUTBITS) {
-			node = decode_luts[bits & HUFFMAN_LUTMASK];
+			node = &NODES[DECODE_LUTS[bits & HUFFMAN_LUTMASK]];
 		}
 
 		// {b} fill with new bits
@@ -263,12 +619,7 @@ size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_
 
 		// {C} load symbol now if we didn't that earlier at location {A}
 		if(!node) {
-			node = decode_luts[bits & HUFFMAN_LUTMASK];
-		}
-
-		if(!node) {
-			*err = DDPROTO_ERR_HUFFMAN_NODE_NULL;
-			return -1;
+			node = &NODES[DECODE_LUTS[bits & HUFFMAN_LUTMASK]];
 		}
 
 		// {d} check if we hit a symbol already
@@ -284,7 +635,7 @@ size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_
 			// walk the tree bit by bit
 			while(1) {
 				// traverse tree
-				node = &nodes[node->leaves[bits & 1]];
+				node = &NODES[node->leaves[bits & 1]];
 
 				// remove bit
 				bitcount--;
@@ -319,3 +670,247 @@ size_t ddproto_huffman_decompress(const uint8_t *input, size_t input_len, uint8_
 	// return the size of the decompressed buffer
 	return (dst - (const uint8_t *)output);
 }
+
+// node that still has to be merged while building a tree
+typedef struct HuffmanConstructNode {
+	uint16_t node_id;
+	uint64_t frequency;
+} HuffmanConstructNode;
+
+// scratch space of ddproto_huffman_new, too big for a kernel stack
+typedef struct HuffmanBuilder {
+	Node nodes[HUFFMAN_MAX_NODES];
+	HuffmanConstructNode nodes_left[HUFFMAN_MAX_SYMBOLS];
+	uint64_t frequencies[HUFFMAN_MAX_SYMBOLS];
+} HuffmanBuilder;
+
+// a codec built from a custom frequency table, all tables live in the same
+// allocation
+typedef struct HuffmanCustom {
+	DDProtoHuffman huffman;
+	uint32_t encode_table[HUFFMAN_MAX_SYMBOLS];
+	HuffmanMultiEntry multi_luts[HUFFMAN_MULTI_LUTSIZE];
+	HuffmanSubEntry subtables[];
+} HuffmanCustom;
+
+static void huffman_bubble_sort(HuffmanConstructNode *nodes_left, uint32_t size) {
+	// we can't rely on any other sort for this, it has to produce exactly the
+	// same order as the reference implementation
+	bool changed = true;
+	while(changed) {
+		changed = false;
+		for(uint32_t i = 0; i + 1 < size; i++) {
+			if(nodes_left[i].frequency < nodes_left[i + 1].frequency) {
+				HuffmanConstructNode tmp = nodes_left[i];
+				nodes_left[i] = nodes_left[i + 1];
+				nodes_left[i + 1] = tmp;
+				changed = true;
+			}
+		}
+		size--;
+	}
+}
+
+static void huffman_set_bits(Node *nodes, uint16_t node_id, uint32_t bits, uint32_t depth) {
+	Node *node = &nodes[node_id];
+	// codes that do not fit into 32 bits are rejected by the caller anyways
+	const uint32_t bit = depth < 32 ? 1u << depth : 0;
+	if(node->leaves[1] != HUFFMAN_NO_LEAF) {
+		huffman_set_bits(nodes, node->leaves[1], bits | bit, depth + 1);
+	}
+	if(node->leaves[0] != HUFFMAN_NO_LEAF) {
+		huffman_set_bits(nodes, node->leaves[0], bits, depth + 1);
+	}
+	if(node->num_bits) {
+		node->bits = bits;
+		node->num_bits = depth;
+	}
+}
+
+// same algorithm as the reference implementation, so the default frequency
+// table results in the exact same tree. Returns the length of the longest code
+static uint32_t huffman_construct_tree(HuffmanBuilder *builder) {
+	Node *nodes = builder->nodes;
+	HuffmanConstructNode *nodes_left = builder->nodes_left;
+	for(uint16_t i = 0; i < HUFFMAN_MAX_SYMBOLS; i++) {
+		nodes[i] = (Node){
+			.num_bits = 0xffffffff,
+			.leaves = {HUFFMAN_NO_LEAF, HUFFMAN_NO_LEAF},
+			.symbol = (uint8_t)i,
+		};
+		nodes_left[i].node_id = i;
+		nodes_left[i].frequency = builder->frequencies[i];
+	}
+
+	uint16_t num_nodes = HUFFMAN_MAX_SYMBOLS;
+	for(uint32_t num_nodes_left = HUFFMAN_MAX_SYMBOLS; num_nodes_left > 1; num_nodes_left--) {
+		huffman_bubble_sort(nodes_left, num_nodes_left);
+
+		nodes[num_nodes] = (Node){
+			.leaves = {nodes_left[num_nodes_left - 1].node_id, nodes_left[num_nodes_left - 2].node_id},
+		};
+		nodes_left[num_nodes_left - 2].node_id = num_nodes;
+		nodes_left[num_nodes_left - 2].frequency += nodes_left[num_nodes_left - 1].frequency;
+		num_nodes++;
+	}
+
+	huffman_set_bits(nodes, HUFFMAN_MAX_NODES - 1, 0, 0);
+
+	uint32_t max_bits = 0;
+	for(uint32_t i = 0; i < HUFFMAN_MAX_SYMBOLS; i++) {
+		if(nodes[i].num_bits > max_bits) {
+			max_bits = nodes[i].num_bits;
+		}
+	}
+	return max_bits;
+}
+
+// follows at most `max_bits` bits starting at `node_id`. Returns the amount of
+// bits used to reach a leaf or 0 if no leaf was reached
+static uint32_t huffman_walk_tree(const Node *nodes, uint16_t *node_id, uint32_t bits, uint32_t max_bits) {
+	for(uint32_t depth = 0; depth < max_bits; depth++) {
+		*node_id = nodes[*node_id].leaves[bits & 1];
+		bits >>= 1;
+		if(nodes[*node_id].num_bits) {
+			return depth + 1;
+		}
+	}
+	return 0;
+}
+
+static uint32_t huffman_max_depth(const Node *nodes, uint16_t node_id) {
+	const Node *node = &nodes[node_id];
+	if(node->num_bits) {
+		return 0;
+	}
+	const uint32_t left = huffman_max_depth(nodes, node->leaves[0]);
+	const uint32_t right = huffman_max_depth(nodes, node->leaves[1]);
+	return (left > right ? left : right) + 1;
+}
+
+// fills the multi symbol decode tables and returns the amount of subtable
+// entries. If `subtables` is NULL the entries are only counted
+static uint32_t huffman_build_multi_luts(const Node *nodes, HuffmanMultiEntry *luts, HuffmanSubEntry *subtables) {
+	const uint16_t start_node = HUFFMAN_MAX_NODES - 1;
+	uint32_t num_subtables = 0;
+	for(uint32_t i = 0; i < HUFFMAN_MULTI_LUTSIZE; i++) {
+		HuffmanMultiEntry entry = {0};
+		uint32_t pos = 0;
+		while(entry.num_symbols < HUFFMAN_MULTI_SYMBOLS) {
+			uint16_t node_id = start_node;
+			const uint32_t length = huffman_walk_tree(nodes, &node_id, i >> pos, HUFFMAN_MULTI_LUTBITS - pos);
+			if(!length) {
+				if(!entry.num_symbols) {
+					// the first code does not fit, use a subtable
+					const uint32_t sub_bits = huffman_max_depth(nodes, node_id);
+					entry.flags = HUFFMAN_ENTRY_SUBTABLE;
+					entry.subtable.offset = num_subtables;
+					entry.subtable.num_bits = sub_bits;
+					for(uint32_t sub = 0; sub < (1u << sub_bits); sub++) {
+						uint16_t sub_node = node_id;
+						const uint32_t sub_length = huffman_walk_tree(nodes, &sub_node, sub, sub_bits);
+						if(subtables) {
+							subtables[num_subtables] = (HuffmanSubEntry){
+								.symbol = sub_node,
+								.num_bits = HUFFMAN_MULTI_LUTBITS + sub_length,
+							};
+						}
+						num_subtables++;
+					}
+				}
+				break;
+			}
+
+			pos += length;
+			entry.num_bits = pos;
+			if(node_id == HUFFMAN_EOF_SYMBOL) {
+				entry.flags = HUFFMAN_ENTRY_EOF;
+				break;
+			}
+			entry.symbols[entry.num_symbols++] = nodes[node_id].symbol;
+		}
+		if(luts) {
+			luts[i] = entry;
+		}
+	}
+	return num_subtables;
+}
+
+DDProtoHuffman *ddproto_huffman_new(const uint32_t frequencies[256]) {
+	HuffmanBuilder *builder = ddproto_alloc(NULL, sizeof(HuffmanBuilder));
+	if(!builder) {
+		return NULL;
+	}
+
+	for(uint32_t i = 0; i < HUFFMAN_MAX_SYMBOLS - 1; i++) {
+		builder->frequencies[i] = frequencies[i];
+	}
+	builder->frequencies[HUFFMAN_EOF_SYMBOL] = 1;
+
+	// very uneven or missing frequencies result in huge code lengths. Flatten the
+	// table until they fit, this ends at the latest when all frequencies are
+	// 1 which results in a balanced tree
+	while(huffman_construct_tree(builder) > HUFFMAN_MAX_CODE_BITS) {
+		for(uint32_t i = 0; i < HUFFMAN_MAX_SYMBOLS; i++) {
+			builder->frequencies[i] = (builder->frequencies[i] >> 1) | 1;
+		}
+	}
+
+	const uint32_t num_subtables = huffman_build_multi_luts(builder->nodes, NULL, NULL);
+	HuffmanCustom *custom = ddproto_alloc(NULL, sizeof(HuffmanCustom) + sizeof(HuffmanSubEntry) * num_subtables);
+	if(!custom) {
+		ddproto_free(NULL, builder);
+		return NULL;
+	}
+
+	for(uint32_t i = 0; i < HUFFMAN_MAX_SYMBOLS; i++) {
+		custom->encode_table[i] = (builder->nodes[i].num_bits << 16) | builder->nodes[i].bits;
+	}
+	huffman_build_multi_luts(builder->nodes, custom->multi_luts, custom->subtables);
+
+	custom->huffman = (DDProtoHuffman){
+		.encode_table = custom->encode_table,
+		.multi_luts = custom->multi_luts,
+		.subtables = custom->subtables,
+	};
+	for(uint32_t i = 0; i < HUFFMAN_EOF_SYMBOL; i++) {
+		if(builder->nodes[i].num_bits > custom->huffman.max_code_bits) {
+			custom->huffman.max_code_bits = builder->nodes[i].num_bits;
+		}
+	}
+	ddproto_free(NULL, builder);
+	return &custom->huffman;
+}
+
+void ddproto_huffman_free(DDProtoHuffman *huffman) {
+	ddproto_free(NULL, huffman);
+}
+
+const uint32_t *ddproto_huffman_default_frequencies(void) {
+	return FREQUENCY_TABLE;
+}
+
+void ddproto_huffman_count_frequencies(uint32_t frequencies[256], const uint8_t *input, size_t input_len) {
+	for(size_t i = 0; i < input_len; i++) {
+		frequencies[input[i]]++;
+	}
+}
+
+size_t ddproto_huffman_compressed_size(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len) {
+	uint64_t num_bits = huffman->encode_table[HUFFMAN_EOF_SYMBOL] >> 16;
+	for(size_t i = 0; i < input_len; i++) {
+		num_bits += huffman->encode_table[input[i]] >> 16;
+	}
+
+	// the encoder always writes a last byte, even if no bits are left
+	return (num_bits / 8) + 1;
+}
+
+size_t ddproto_huffman_compress_bound_with(const DDProtoHuffman *huffman, size_t input_len) {
+	const uint64_t num_bits = (uint64_t)huffman->max_code_bits * input_len + (huffman->encode_table[HUFFMAN_EOF_SYMBOL] >> 16);
+	return (num_bits / 8) + 1;
+}
+
+size_t ddproto_huffman_compress_bound(size_t input_len) {
+	return ddproto_huffman_compress_bound_with(&HUFFMAN_DEFAULT, input_len);
+}
@@ -0,0 +1,1686 @@
+// This file is generated by scripts/generate_huffman_tables.py
+// do not edit it by hand.
+
+#pragma once
+
+// clang-format off
+
+// frequency of every byte, the tables below are built from it. The last entry
+// is not used, EOF always has a frequency of 1
+static const uint32_t FREQUENCY_TABLE[HUFFMAN_MAX_SYMBOLS] = {
+	1073741824, 4545, 2657, 431, 1950, 919, 444, 482, 2244, 617, 838, 542, 715, 1814, 304, 240, 754, 212, 647, 186,
+	283, 131, 146, 166, 543, 164, 167, 136, 179, 859, 363, 113, 157, 154, 204, 108, 137, 180, 202, 176,
+	872, 404, 168, 134, 151, 111, 113, 109, 120, 126, 129, 100, 41, 20, 16, 22, 18, 18, 17, 19,
+	16, 37, 13, 21, 362, 166, 99, 78, 95, 88, 81, 70, 83, 284, 91, 187, 77, 68, 52, 68,
+	59, 66, 61, 638, 71, 157, 50, 46, 69, 43, 11, 24, 13, 19, 10, 12, 12, 20, 14, 9,
+	20, 20, 10, 10, 15, 15, 12, 12, 7, 19, 15, 14, 13, 18, 35, 19, 17, 14, 8, 5,
+	15, 17, 9, 15, 14, 18, 8, 10, 2173, 134, 157, 68, 188, 60, 170, 60, 194, 62, 175, 71,
+	148, 67, 167, 78, 211, 67, 156, 69, 1674, 90, 174, 53, 147, 89, 181, 51, 174, 63, 163, 80,
+	167, 94, 128, 122, 223, 153, 218, 77, 200, 110, 190, 73, 174, 69, 145, 66, 277, 143, 141, 60,
+	136, 53, 180, 57, 142, 57, 158, 61, 166, 112, 152, 92, 26, 22, 21, 28, 20, 26, 30, 21,
+	32, 27, 20, 17, 23, 21, 30, 22, 22, 21, 27, 25, 17, 27, 23, 18, 39, 26, 15, 21,
+	12, 18, 18, 27, 20, 18, 15, 19, 11, 17, 33, 12, 18, 15, 19, 18, 16, 26, 17, 18,
+	9, 10, 25, 22, 22, 17, 20, 16, 6, 16, 15, 20, 14, 18, 24, 335, 1517,
+};
+
+// huffman tree, the first HUFFMAN_MAX_SYMBOLS nodes are the leaves
+static const Node NODES[HUFFMAN_MAX_NODES] = {
+	{0x1, 1, {0xffff, 0xffff}, 0},
+	{0x8, 4, {0xffff, 0xffff}, 1},
+	{0x2, 5, {0xffff, 0xffff}, 2},
+	{0x16, 8, {0xffff, 0xffff}, 3},
+	{0x1e, 6, {0xffff, 0xffff}, 4},
+	{0x76, 7, {0xffff, 0xffff}, 5},
+	{0x36, 8, {0xffff, 0xffff}, 6},
+	{0x6e, 8, {0xffff, 0xffff}, 7},
+	{0x4, 5, {0xffff, 0xffff}, 8},
+	{0x4c, 7, {0xffff, 0xffff}, 9},
+	{0x7a, 7, {0xffff, 0xffff}, 10},
+	{0xfe, 8, {0xffff, 0xffff}, 11},
+	{0x72, 7, {0xffff, 0xffff}, 12},
+	{0xe, 6, {0xffff, 0xffff}, 13},
+	{0xf4, 8, {0xffff, 0xffff}, 14},
+	{0xee, 9, {0xffff, 0xffff}, 15},
+	{0x6a, 7, {0xffff, 0xffff}, 16},
+	{0xa6, 9, {0xffff, 0xffff}, 17},
+	{0x5c, 7, {0xffff, 0xffff}, 18},
+	{0xaa, 9, {0xffff, 0xffff}, 19},
+	{0xf0, 8, {0xffff, 0xffff}, 20},
+	{0x1be, 10, {0xffff, 0xffff}, 21},
+	{0x34, 9, {0xffff, 0xffff}, 22},
+	{0x7c, 9, {0xffff, 0xffff}, 23},
+	{0x10, 7, {0xffff, 0xffff}, 24},
+	{0x13c, 9, {0xffff, 0xffff}, 25},
+	{0x12, 9, {0xffff, 0xffff}, 26},
+	{0xd0, 9, {0xffff, 0xffff}, 27},
+	{0xa, 9, {0xffff, 0xffff}, 28},
+	{0x66, 7, {0xffff, 0xffff}, 29},
+	{0xca, 8, {0xffff, 0xffff}, 30},
+	{0x12e, 10, {0xffff, 0xffff}, 31},
+	{0x1ac, 9, {0xffff, 0xffff}, 32},
+	{0x8c, 9, {0xffff, 0xffff}, 33},
+	{0x1ba, 9, {0xffff, 0xffff}, 34},
+	{0x3a6, 10, {0xffff, 0xffff}, 35},
+	{0x30, 9, {0xffff, 0xffff}, 36},
+	{0x8a, 9, {0xffff, 0xffff}, 37},
+	{0x1da, 9, {0xffff, 0xffff}, 38},
+	{0xb2, 9, {0xffff, 0xffff}, 39},
+	{0x56, 7, {0xffff, 0xffff}, 40},
+	{0x3a, 8, {0xffff, 0xffff}, 41},
+	{0x112, 9, {0xffff, 0xffff}, 42},
+	{0x17e, 10, {0xffff, 0xffff}, 43},
+	{0x1b4, 9, {0xffff, 0xffff}, 44},
+	{0x2b6, 10, {0xffff, 0xffff}, 45},
+	{0x22e, 10, {0xffff, 0xffff}, 46},
+	{0x196, 10, {0xffff, 0xffff}, 47},
+	{0x3ae, 10, {0xffff, 0xffff}, 48},
+	{0x13e, 10, {0xffff, 0xffff}, 49},
+	{0xbe, 10, {0xffff, 0xffff}, 50},
+	{0x35a, 10, {0xffff, 0xffff}, 51},
+	{0x23c, 11, {0xffff, 0xffff}, 52},
+	{0xd1c, 12, {0xffff, 0xffff}, 53},
+	{0x6be, 13, {0xffff, 0xffff}, 54},
+	{0x38a, 12, {0xffff, 0xffff}, 55},
+	{0x5d4, 12, {0xffff, 0xffff}, 56},
+	{0xe70, 12, {0xffff, 0xffff}, 57},
+	{0xa50, 12, {0xffff, 0xffff}, 58},
+	{0x674, 12, {0xffff, 0xffff}, 59},
+	{0x1c3e, 13, {0xffff, 0xffff}, 60},
+	{0x74, 11, {0xffff, 0xffff}, 61},
+	{0x5a6, 13, {0xffff, 0xffff}, 62},
+	{0x152, 12, {0xffff, 0xffff}, 63},
+	{0x4a, 8, {0xffff, 0xffff}, 64},
+	{0x1bc, 9, {0xffff, 0xffff}, 65},
+	{0x15a, 10, {0xffff, 0xffff}, 66},
+	{0x38c, 10, {0xffff, 0xffff}, 67},
+	{0x19a, 10, {0xffff, 0xffff}, 68},
+	{0x1b2, 10, {0xffff, 0xffff}, 69},
+	{0x3c, 10, {0xffff, 0xffff}, 70},
+	{0x70, 10, {0xffff, 0xffff}, 71},
+	{0x17c, 10, {0xffff, 0xffff}, 72},
+	{0x94, 8, {0xffff, 0xffff}, 73},
+	{0x12a, 10, {0xffff, 0xffff}, 74},
+	{0x1aa, 9, {0xffff, 0xffff}, 75},
+	{0x30c, 10, {0xffff, 0xffff}, 76},
+	{0x1d0, 10, {0xffff, 0xffff}, 77},
+	{0x426, 11, {0xffff, 0xffff}, 78},
+	{0x77e, 11, {0xffff, 0xffff}, 79},
+	{0xae, 11, {0xffff, 0xffff}, 80},
+	{0x7be, 11, {0xffff, 0xffff}, 81},
+	{0x3e, 11, {0xffff, 0xffff}, 82},
+	{0x6c, 7, {0xffff, 0xffff}, 83},
+	{0x214, 10, {0xffff, 0xffff}, 84},
+	{0xac, 9, {0xffff, 0xffff}, 85},
+	{0xba, 11, {0xffff, 0xffff}, 86},
+	{0x1a, 11, {0xffff, 0xffff}, 87},
+	{0x330, 10, {0xffff, 0xffff}, 88},
+	{0x552, 11, {0xffff, 0xffff}, 89},
+	{0xb8a, 13, {0xffff, 0xffff}, 90},
+	{0x79a, 12, {0xffff, 0xffff}, 91},
+	{0x1cba, 13, {0xffff, 0xffff}, 92},
+	{0xc74, 12, {0xffff, 0xffff}, 93},
+	{0x77c, 13, {0xffff, 0xffff}, 94},
+	{0x139a, 13, {0xffff, 0xffff}, 95},
+	{0x39a, 13, {0xffff, 0xffff}, 96},
+	{0x51c, 12, {0xffff, 0xffff}, 97},
+	{0x18b6, 13, {0xffff, 0xffff}, 98},
+	{0x11d4, 13, {0xffff, 0xffff}, 99},
+	{0x89c, 12, {0xffff, 0xffff}, 100},
+	{0x9c, 12, {0xffff, 0xffff}, 101},
+	{0x1e74, 13, {0xffff, 0xffff}, 102},
+	{0xe74, 13, {0xffff, 0xffff}, 103},
+	{0x15ae, 13, {0xffff, 0xffff}, 104},
+	{0x5ae, 13, {0xffff, 0xffff}, 105},
+	{0x1b9a, 13, {0xffff, 0xffff}, 106},
+	{0xb9a, 13, {0xffff, 0xffff}, 107},
+	{0x4ae, 14, {0xffff, 0xffff}, 108},
+	{0x474, 12, {0xffff, 0xffff}, 109},
+	{0x1dae, 13, {0xffff, 0xffff}, 110},
+	{0x8b6, 13, {0xffff, 0xffff}, 111},
+	{0xcba, 13, {0xffff, 0xffff}, 112},
+	{0x670, 12, {0xffff, 0xffff}, 113},
+	{0x270, 11, {0xffff, 0xffff}, 114},
+	{0xa74, 12, {0xffff, 0xffff}, 115},
+	{0x250, 12, {0xffff, 0xffff}, 116},
+	{0x14b6, 13, {0xffff, 0xffff}, 117},
+	{0x16be, 14, {0xffff, 0xffff}, 118},
+	{0x5b8a, 15, {0xffff, 0xffff}, 119},
+	{0xdae, 13, {0xffff, 0xffff}, 120},
+	{0xe50, 12, {0xffff, 0xffff}, 121},
+	{0x1d4, 13, {0xffff, 0xffff}, 122},
+	{0x11ae, 13, {0xffff, 0xffff}, 123},
+	{0x4b6, 13, {0xffff, 0xffff}, 124},
+	{0xb54, 12, {0xffff, 0xffff}, 125},
+	{0x24ae, 14, {0xffff, 0xffff}, 126},
+	{0x171c, 13, {0xffff, 0xffff}, 127},
+	{0x0, 5, {0xffff, 0xffff}, 128},
+	{0x27e, 10, {0xffff, 0xffff}, 129},
+	{0x12c, 9, {0xffff, 0xffff}, 130},
+	{0x37e, 11, {0xffff, 0xffff}, 131},
+	{0x11a, 9, {0xffff, 0xffff}, 132},
+	{0x1ee, 11, {0xffff, 0xffff}, 133},
+	{0x52, 9, {0xffff, 0xffff}, 134},
+	{0x6ae, 11, {0xffff, 0xffff}, 135},
+	{0x5a, 9, {0xffff, 0xffff}, 136},
+	{0x23e, 11, {0xffff, 0xffff}, 137},
+	{0x132, 9, {0xffff, 0xffff}, 138},
+	{0x14, 10, {0xffff, 0xffff}, 139},
+	{0xb4, 9, {0xffff, 0xffff}, 140},
+	{0x47e, 11, {0xffff, 0xffff}, 141},
+	{0x1fc, 9, {0xffff, 0xffff}, 142},
+	{0x18c, 10, {0xffff, 0xffff}, 143},
+	{0x126, 9, {0xffff, 0xffff}, 144},
+	{0x7e, 11, {0xffff, 0xffff}, 145},
+	{0x2c, 9, {0xffff, 0xffff}, 146},
+	{0x130, 10, {0xffff, 0xffff}, 147},
+	{0x6, 6, {0xffff, 0xffff}, 148},
+	{0x18a, 10, {0xffff, 0xffff}, 149},
+	{0x32, 9, {0xffff, 0xffff}, 150},
+	{0x626, 11, {0xffff, 0xffff}, 151},
+	{0x134, 9, {0xffff, 0xffff}, 152},
+	{0x3b2, 10, {0xffff, 0xffff}, 153},
+	{0x2a, 9, {0xffff, 0xffff}, 154},
+	{0x2ba, 11, {0xffff, 0xffff}, 155},
+	{0x1d2, 9, {0xffff, 0xffff}, 156},
+	{0x63e, 11, {0xffff, 0xffff}, 157},
+	{0x19c, 9, {0xffff, 0xffff}, 158},
+	{0x29c, 10, {0xffff, 0xffff}, 159},
+	{0xfc, 9, {0xffff, 0xffff}, 160},
+	{0x21a, 10, {0xffff, 0xffff}, 161},
+	{0x33e, 10, {0xffff, 0xffff}, 162},
+	{0x3ee, 10, {0xffff, 0xffff}, 163},
+	{0x1b6, 9, {0xffff, 0xffff}, 164},
+	{0xc, 9, {0xffff, 0xffff}, 165},
+	{0x96, 9, {0xffff, 0xffff}, 166},
+	{0x10c, 10, {0xffff, 0xffff}, 167},
+	{0xda, 9, {0xffff, 0xffff}, 168},
+	{0x396, 10, {0xffff, 0xffff}, 169},
+	{0x9a, 9, {0xffff, 0xffff}, 170},
+	{0x3d4, 10, {0xffff, 0xffff}, 171},
+	{0xd2, 9, {0xffff, 0xffff}, 172},
+	{0x3d0, 10, {0xffff, 0xffff}, 173},
+	{0xd4, 9, {0xffff, 0xffff}, 174},
+	{0x3be, 11, {0xffff, 0xffff}, 175},
+	{0xb0, 8, {0xffff, 0xffff}, 176},
+	{0x54, 9, {0xffff, 0xffff}, 177},
+	{0x170, 9, {0xffff, 0xffff}, 178},
+	{0x2ae, 11, {0xffff, 0xffff}, 179},
+	{0x150, 9, {0xffff, 0xffff}, 180},
+	{0x226, 11, {0xffff, 0xffff}, 181},
+	{0x10a, 9, {0xffff, 0xffff}, 182},
+	{0x72e, 11, {0xffff, 0xffff}, 183},
+	{0x114, 9, {0xffff, 0xffff}, 184},
+	{0x32e, 11, {0xffff, 0xffff}, 185},
+	{0x1c, 9, {0xffff, 0xffff}, 186},
+	{0x5ee, 11, {0xffff, 0xffff}, 187},
+	{0xbc, 9, {0xffff, 0xffff}, 188},
+	{0x2e, 10, {0xffff, 0xffff}, 189},
+	{0x174, 9, {0xffff, 0xffff}, 190},
+	{0x32a, 10, {0xffff, 0xffff}, 191},
+	{0xeba, 12, {0xffff, 0xffff}, 192},
+	{0xb52, 12, {0xffff, 0xffff}, 193},
+	{0xe3c, 12, {0xffff, 0xffff}, 194},
+	{0xcb6, 12, {0xffff, 0xffff}, 195},
+	{0xc9c, 12, {0xffff, 0xffff}, 196},
+	{0x6ba, 12, {0xffff, 0xffff}, 197},
+	{0x43e, 12, {0xffff, 0xffff}, 198},
+	{0x63c, 12, {0xffff, 0xffff}, 199},
+	{0xabe, 12, {0xffff, 0xffff}, 200},
+	{0xb6, 12, {0xffff, 0xffff}, 201},
+	{0x49c, 12, {0xffff, 0xffff}, 202},
+	{0x650, 12, {0xffff, 0xffff}, 203},
+	{0xf8a, 12, {0xffff, 0xffff}, 204},
+	{0xb7c, 12, {0xffff, 0xffff}, 205},
+	{0xcae, 12, {0xffff, 0xffff}, 206},
+	{0x352, 12, {0xffff, 0xffff}, 207},
+	{0xf52, 12, {0xffff, 0xffff}, 208},
+	{0x37c, 12, {0xffff, 0xffff}, 209},
+	{0x9a6, 12, {0xffff, 0xffff}, 210},
+	{0x4ba, 12, {0xffff, 0xffff}, 211},
+	{0x850, 12, {0xffff, 0xffff}, 212},
+	{0x1a6, 12, {0xffff, 0xffff}, 213},
+	{0x78a, 12, {0xffff, 0xffff}, 214},
+	{0x354, 12, {0xffff, 0xffff}, 215},
+	{0x11c, 11, {0xffff, 0xffff}, 216},
+	{0x826, 12, {0xffff, 0xffff}, 217},
+	{0x1ae, 13, {0xffff, 0xffff}, 218},
+	{0xf7c, 12, {0xffff, 0xffff}, 219},
+	{0x141a, 13, {0xffff, 0xffff}, 220},
+	{0xf54, 12, {0xffff, 0xffff}, 221},
+	{0x754, 12, {0xffff, 0xffff}, 222},
+	{0xda6, 12, {0xffff, 0xffff}, 223},
+	{0xb1c, 12, {0xffff, 0xffff}, 224},
+	{0x954, 12, {0xffff, 0xffff}, 225},
+	{0x19ae, 13, {0xffff, 0xffff}, 226},
+	{0x274, 12, {0xffff, 0xffff}, 227},
+	{0x177c, 13, {0xffff, 0xffff}, 228},
+	{0x50, 12, {0xffff, 0xffff}, 229},
+	{0xebe, 12, {0xffff, 0xffff}, 230},
+	{0x41a, 13, {0xffff, 0xffff}, 231},
+	{0x154, 12, {0xffff, 0xffff}, 232},
+	{0x9ae, 13, {0xffff, 0xffff}, 233},
+	{0xdd4, 12, {0xffff, 0xffff}, 234},
+	{0xd54, 12, {0xffff, 0xffff}, 235},
+	{0xc3e, 13, {0xffff, 0xffff}, 236},
+	{0x26, 12, {0xffff, 0xffff}, 237},
+	{0xc50, 12, {0xffff, 0xffff}, 238},
+	{0x554, 12, {0xffff, 0xffff}, 239},
+	{0x36be, 14, {0xffff, 0xffff}, 240},
+	{0x71c, 13, {0xffff, 0xffff}, 241},
+	{0xf9a, 12, {0xffff, 0xffff}, 242},
+	{0x752, 12, {0xffff, 0xffff}, 243},
+	{0x952, 12, {0xffff, 0xffff}, 244},
+	{0x450, 12, {0xffff, 0xffff}, 245},
+	{0x31c, 12, {0xffff, 0xffff}, 246},
+	{0x12be, 13, {0xffff, 0xffff}, 247},
+	{0x3b8a, 14, {0xffff, 0xffff}, 248},
+	{0x2be, 13, {0xffff, 0xffff}, 249},
+	{0x14ae, 13, {0xffff, 0xffff}, 250},
+	{0xf1c, 12, {0xffff, 0xffff}, 251},
+	{0x15a6, 13, {0xffff, 0xffff}, 252},
+	{0x9d4, 12, {0xffff, 0xffff}, 253},
+	{0xc1a, 12, {0xffff, 0xffff}, 254},
+	{0x92, 8, {0xffff, 0xffff}, 255},
+	{0x1b8a, 15, {0xffff, 0xffff}, 0},
+	{0x0, 0, {0x100, 0x77}, 0},
+	{0x0, 0, {0x101, 0xf8}, 0},
+	{0x0, 0, {0x6c, 0x7e}, 0},
+	{0x0, 0, {0x76, 0xf0}, 0},
+	{0x0, 0, {0x7a, 0x63}, 0},
+	{0x0, 0, {0xf1, 0x7f}, 0},
+	{0x0, 0, {0x67, 0x66}, 0},
+	{0x0, 0, {0x5e, 0xe4}, 0},
+	{0x0, 0, {0x5a, 0x102}, 0},
+	{0x0, 0, {0xe7, 0xdc}, 0},
+	{0x0, 0, {0x6b, 0x6a}, 0},
+	{0x0, 0, {0x60, 0x5f}, 0},
+	{0x0, 0, {0x70, 0x5c}, 0},
+	{0x0, 0, {0x3e, 0xfc}, 0},
+	{0x0, 0, {0x7c, 0x75}, 0},
+	{0x0, 0, {0x6f, 0x62}, 0},
+	{0x0, 0, {0x103, 0xfa}, 0},
+	{0x0, 0, {0xe9, 0xe2}, 0},
+	{0x0, 0, {0xda, 0x7b}, 0},
+	{0x0, 0, {0x78, 0x6e}, 0},
+	{0x0, 0, {0x69, 0x68}, 0},
+	{0x0, 0, {0xf9, 0xf7}, 0},
+	{0x0, 0, {0xec, 0x3c}, 0},
+	{0x0, 0, {0x36, 0x104}, 0},
+	{0x0, 0, {0xf5, 0xee}, 0},
+	{0x0, 0, {0xe5, 0xd4}, 0},
+	{0x0, 0, {0xcb, 0x79}, 0},
+	{0x0, 0, {0x74, 0x3a}, 0},
+	{0x0, 0, {0x105, 0xfd}, 0},
+	{0x0, 0, {0xef, 0xeb}, 0},
+	{0x0, 0, {0xe8, 0xe1}, 0},
+	{0x0, 0, {0xde, 0xdd}, 0},
+	{0x0, 0, {0xd7, 0x7d}, 0},
+	{0x0, 0, {0x71, 0x39}, 0},
+	{0x0, 0, {0x38, 0xea}, 0},
+	{0x0, 0, {0xe3, 0x73}, 0},
+	{0x0, 0, {0x6d, 0x5d}, 0},
+	{0x0, 0, {0x3b, 0x107}, 0},
+	{0x0, 0, {0x106, 0xfb}, 0},
+	{0x0, 0, {0xf6, 0xe0}, 0},
+	{0x0, 0, {0xca, 0xc4}, 0},
+	{0x0, 0, {0x65, 0x64}, 0},
+	{0x0, 0, {0x61, 0x35}, 0},
+	{0x0, 0, {0x108, 0xdb}, 0},
+	{0x0, 0, {0xd1, 0xcd}, 0},
+	{0x0, 0, {0xc7, 0xc2}, 0},
+	{0x0, 0, {0x3f, 0xf4}, 0},
+	{0x0, 0, {0xf3, 0xd0}, 0},
+	{0x0, 0, {0xcf, 0xc1}, 0},
+	{0x0, 0, {0x37, 0x109}, 0},
+	{0x0, 0, {0xd6, 0xcc}, 0},
+	{0x0, 0, {0x10c, 0x10b}, 0},
+	{0x0, 0, {0x10a, 0xfe}, 0},
+	{0x0, 0, {0x5b, 0xf2}, 0},
+	{0x0, 0, {0xd3, 0x10d}, 0},
+	{0x0, 0, {0xed, 0xd9}, 0},
+	{0x0, 0, {0xc5, 0xc0}, 0},
+	{0x0, 0, {0x10e, 0xdf}, 0},
+	{0x0, 0, {0xd5, 0xd2}, 0},
+	{0x0, 0, {0xc9, 0x110}, 0},
+	{0x0, 0, {0x10f, 0xc3}, 0},
+	{0x0, 0, {0x115, 0x114}, 0},
+	{0x0, 0, {0x113, 0x112}, 0},
+	{0x0, 0, {0x111, 0xce}, 0},
+	{0x0, 0, {0xc6, 0x117}, 0},
+	{0x0, 0, {0x116, 0xc8}, 0},
+	{0x0, 0, {0x118, 0xe6}, 0},
+	{0x0, 0, {0x11c, 0x11b}, 0},
+	{0x0, 0, {0x11a, 0x119}, 0},
+	{0x0, 0, {0x72, 0x122}, 0},
+	{0x0, 0, {0x121, 0x120}, 0},
+	{0x0, 0, {0x11f, 0x11e}, 0},
+	{0x0, 0, {0x11d, 0x123}, 0},
+	{0x0, 0, {0x3d, 0x125}, 0},
+	{0x0, 0, {0x124, 0x126}, 0},
+	{0x0, 0, {0xd8, 0x12b}, 0},
+	{0x0, 0, {0x12a, 0x129}, 0},
+	{0x0, 0, {0x128, 0x127}, 0},
+	{0x0, 0, {0x34, 0x12e}, 0},
+	{0x0, 0, {0x12d, 0x12c}, 0},
+	{0x0, 0, {0x12f, 0x59}, 0},
+	{0x0, 0, {0x131, 0x130}, 0},
+	{0x0, 0, {0x132, 0x133}, 0},
+	{0x0, 0, {0x57, 0x135}, 0},
+	{0x0, 0, {0x134, 0x136}, 0},
+	{0x0, 0, {0x56, 0x137}, 0},
+	{0x0, 0, {0x9b, 0x139}, 0},
+	{0x0, 0, {0x138, 0x4e}, 0},
+	{0x0, 0, {0xb5, 0x97}, 0},
+	{0x0, 0, {0x13b, 0x13a}, 0},
+	{0x0, 0, {0x13c, 0x13d}, 0},
+	{0x0, 0, {0xb9, 0xb7}, 0},
+	{0x0, 0, {0x50, 0x140}, 0},
+	{0x0, 0, {0x13f, 0x13e}, 0},
+	{0x0, 0, {0xb3, 0x87}, 0},
+	{0x0, 0, {0x85, 0xbb}, 0},
+	{0x0, 0, {0x52, 0x141}, 0},
+	{0x0, 0, {0x89, 0x9d}, 0},
+	{0x0, 0, {0x142, 0x143}, 0},
+	{0x0, 0, {0xaf, 0x51}, 0},
+	{0x0, 0, {0x91, 0x8d}, 0},
+	{0x0, 0, {0x145, 0x144}, 0},
+	{0x0, 0, {0x83, 0x4f}, 0},
+	{0x0, 0, {0x4d, 0xad}, 0},
+	{0x0, 0, {0x93, 0x58}, 0},
+	{0x0, 0, {0x47, 0x146}, 0},
+	{0x0, 0, {0x8b, 0x54}, 0},
+	{0x0, 0, {0x148, 0x147}, 0},
+	{0x0, 0, {0x149, 0xab}, 0},
+	{0x0, 0, {0x14a, 0x14b}, 0},
+	{0x0, 0, {0xa7, 0x4c}, 0},
+	{0x0, 0, {0x8f, 0x43}, 0},
+	{0x0, 0, {0x14c, 0x14e}, 0},
+	{0x0, 0, {0x14d, 0x9f}, 0},
+	{0x0, 0, {0x46, 0x14f}, 0},
+	{0x0, 0, {0x48, 0x150}, 0},
+	{0x0, 0, {0x151, 0x152}, 0},
+	{0x0, 0, {0x45, 0x99}, 0},
+	{0x0, 0, {0x95, 0x153}, 0},
+	{0x0, 0, {0x4a, 0xbf}, 0},
+	{0x0, 0, {0x154, 0xa1}, 0},
+	{0x0, 0, {0x44, 0x155}, 0},
+	{0x0, 0, {0x42, 0x33}, 0},
+	{0x0, 0, {0x156, 0x157}, 0},
+	{0x0, 0, {0x158, 0x159}, 0},
+	{0x0, 0, {0x15a, 0x23}, 0},
+	{0x0, 0, {0x2f, 0xa9}, 0},
+	{0x0, 0, {0x15b, 0x2d}, 0},
+	{0x0, 0, {0xbd, 0x2e}, 0},
+	{0x0, 0, {0x1f, 0x15c}, 0},
+	{0x0, 0, {0x15d, 0x15f}, 0},
+	{0x0, 0, {0x15e, 0x30}, 0},
+	{0x0, 0, {0x160, 0xa3}, 0},
+	{0x0, 0, {0x161, 0x162}, 0},
+	{0x0, 0, {0x31, 0xa2}, 0},
+	{0x0, 0, {0x32, 0x163}, 0},
+	{0x0, 0, {0x15, 0x164}, 0},
+	{0x0, 0, {0x165, 0x81}, 0},
+	{0x0, 0, {0x2b, 0x167}, 0},
+	{0x0, 0, {0x166, 0xb4}, 0},
+	{0x0, 0, {0x1b, 0x168}, 0},
+	{0x0, 0, {0x24, 0x169}, 0},
+	{0x0, 0, {0x16a, 0xb2}, 0},
+	{0x0, 0, {0x16b, 0xb8}, 0},
+	{0x0, 0, {0xb1, 0x16c}, 0},
+	{0x0, 0, {0xae, 0x16d}, 0},
+	{0x0, 0, {0x16, 0x98}, 0},
+	{0x0, 0, {0x8c, 0x2c}, 0},
+	{0x0, 0, {0x16e, 0xbe}, 0},
+	{0x0, 0, {0xa5, 0x16f}, 0},
+	{0x0, 0, {0x21, 0x170}, 0},
+	{0x0, 0, {0x92, 0x82}, 0},
+	{0x0, 0, {0x55, 0x20}, 0},
+	{0x0, 0, {0xba, 0x171}, 0},
+	{0x0, 0, {0x172, 0x9e}, 0},
+	{0x0, 0, {0x173, 0x19}, 0},
+	{0x0, 0, {0xbc, 0x41}, 0},
+	{0x0, 0, {0x17, 0x174}, 0},
+	{0x0, 0, {0xa0, 0x8e}, 0},
+	{0x0, 0, {0x1a, 0x2a}, 0},
+	{0x0, 0, {0x86, 0x175}, 0},
+	{0x0, 0, {0xac, 0x9c}, 0},
+	{0x0, 0, {0x96, 0x8a}, 0},
+	{0x0, 0, {0x27, 0x176}, 0},
+	{0x0, 0, {0x1c, 0xb6}, 0},
+	{0x0, 0, {0x25, 0x177}, 0},
+	{0x0, 0, {0x9a, 0x178}, 0},
+	{0x0, 0, {0x13, 0x4b}, 0},
+	{0x0, 0, {0x179, 0x84}, 0},
+	{0x0, 0, {0xaa, 0x17a}, 0},
+	{0x0, 0, {0x88, 0x17b}, 0},
+	{0x0, 0, {0xa8, 0x26}, 0},
+	{0x0, 0, {0x17c, 0x22}, 0},
+	{0x0, 0, {0x17d, 0x90}, 0},
+	{0x0, 0, {0x11, 0x17e}, 0},
+	{0x0, 0, {0xa6, 0x17f}, 0},
+	{0x0, 0, {0x180, 0xa4}, 0},
+	{0x0, 0, {0x181, 0x182}, 0},
+	{0x0, 0, {0x183, 0x184}, 0},
+	{0x0, 0, {0xf, 0x185}, 0},
+	{0x0, 0, {0x186, 0x187}, 0},
+	{0x0, 0, {0x188, 0x189}, 0},
+	{0x0, 0, {0x18a, 0x18b}, 0},
+	{0x0, 0, {0x18c, 0x18d}, 0},
+	{0x0, 0, {0x18e, 0xb0}, 0},
+	{0x0, 0, {0x18f, 0x14}, 0},
+	{0x0, 0, {0x190, 0x49}, 0},
+	{0x0, 0, {0x191, 0x192}, 0},
+	{0x0, 0, {0x193, 0x194}, 0},
+	{0x0, 0, {0x195, 0xe}, 0},
+	{0x0, 0, {0x196, 0x197}, 0},
+	{0x0, 0, {0x198, 0x199}, 0},
+	{0x0, 0, {0x19a, 0x19b}, 0},
+	{0x0, 0, {0x19c, 0x19d}, 0},
+	{0x0, 0, {0x19e, 0x19f}, 0},
+	{0x0, 0, {0x1a0, 0xff}, 0},
+	{0x0, 0, {0x1a1, 0x1a2}, 0},
+	{0x0, 0, {0x1a3, 0x1a4}, 0},
+	{0x0, 0, {0x1a5, 0x1a6}, 0},
+	{0x0, 0, {0x40, 0x1e}, 0},
+	{0x0, 0, {0x1a7, 0x1a8}, 0},
+	{0x0, 0, {0x1a9, 0x1aa}, 0},
+	{0x0, 0, {0x1ab, 0x1ac}, 0},
+	{0x0, 0, {0x29, 0x1ad}, 0},
+	{0x0, 0, {0x1ae, 0x1af}, 0},
+	{0x0, 0, {0x3, 0x1b0}, 0},
+	{0x0, 0, {0x6, 0x1b1}, 0},
+	{0x0, 0, {0x1b2, 0x1b3}, 0},
+	{0x0, 0, {0x7, 0x1b4}, 0},
+	{0x0, 0, {0x1b5, 0x1b6}, 0},
+	{0x0, 0, {0x1b7, 0xb}, 0},
+	{0x0, 0, {0x18, 0x1b8}, 0},
+	{0x0, 0, {0x1b9, 0x1ba}, 0},
+	{0x0, 0, {0x1bb, 0x1bc}, 0},
+	{0x0, 0, {0x1bd, 0x1be}, 0},
+	{0x0, 0, {0x1bf, 0x9}, 0},
+	{0x0, 0, {0x1c0, 0x53}, 0},
+	{0x0, 0, {0x1c1, 0x12}, 0},
+	{0x0, 0, {0x1c2, 0x1c3}, 0},
+	{0x0, 0, {0x1c4, 0x1c5}, 0},
+	{0x0, 0, {0x1c6, 0xc}, 0},
+	{0x0, 0, {0x1c7, 0x1c8}, 0},
+	{0x0, 0, {0x1c9, 0x10}, 0},
+	{0x0, 0, {0x1ca, 0x1cb}, 0},
+	{0x0, 0, {0x1cc, 0xa}, 0},
+	{0x0, 0, {0x1cd, 0x1d}, 0},
+	{0x0, 0, {0x1ce, 0x28}, 0},
+	{0x0, 0, {0x1cf, 0x5}, 0},
+	{0x0, 0, {0x1d0, 0x1d1}, 0},
+	{0x0, 0, {0x1d2, 0x1d3}, 0},
+	{0x0, 0, {0x1d4, 0x1d5}, 0},
+	{0x0, 0, {0x1d6, 0x1d7}, 0},
+	{0x0, 0, {0x1d8, 0x1d9}, 0},
+	{0x0, 0, {0x1da, 0x1db}, 0},
+	{0x0, 0, {0x1dc, 0x1dd}, 0},
+	{0x0, 0, {0x1de, 0x1df}, 0},
+	{0x0, 0, {0x1e0, 0x1e1}, 0},
+	{0x0, 0, {0x94, 0x1e2}, 0},
+	{0x0, 0, {0x1e3, 0x1e4}, 0},
+	{0x0, 0, {0xd, 0x1e5}, 0},
+	{0x0, 0, {0x4, 0x1e6}, 0},
+	{0x0, 0, {0x80, 0x1e7}, 0},
+	{0x0, 0, {0x8, 0x1e8}, 0},
+	{0x0, 0, {0x1e9, 0x1ea}, 0},
+	{0x0, 0, {0x2, 0x1eb}, 0},
+	{0x0, 0, {0x1ec, 0x1ed}, 0},
+	{0x0, 0, {0x1ee, 0x1ef}, 0},
+	{0x0, 0, {0x1f0, 0x1f1}, 0},
+	{0x0, 0, {0x1f2, 0x1}, 0},
+	{0x0, 0, {0x1f3, 0x1f4}, 0},
+	{0x0, 0, {0x1f5, 0x1f6}, 0},
+	{0x0, 0, {0x1f7, 0x1f8}, 0},
+	{0x0, 0, {0x1f9, 0x1fa}, 0},
+	{0x0, 0, {0x1fb, 0x1fc}, 0},
+	{0x0, 0, {0x1fd, 0x1fe}, 0},
+	{0x0, 0, {0x1ff, 0x0}, 0},
+};
+
+// longest code of a byte, used to calculate the compress bound
+#define HUFFMAN_DEFAULT_MAX_CODE_BITS 15
+
+// code of every symbol in the lower 16 bits and its length in the upper 16 bits
+static const uint32_t ENCODE_TABLE[HUFFMAN_MAX_SYMBOLS] = {
+	0x10001, 0x40008, 0x50002, 0x80016, 0x6001e, 0x70076, 0x80036, 0x8006e,
+	0x50004, 0x7004c, 0x7007a, 0x800fe, 0x70072, 0x6000e, 0x800f4, 0x900ee,
+	0x7006a, 0x900a6, 0x7005c, 0x900aa, 0x800f0, 0xa01be, 0x90034, 0x9007c,
+	0x70010, 0x9013c, 0x90012, 0x900d0, 0x9000a, 0x70066, 0x800ca, 0xa012e,
+	0x901ac, 0x9008c, 0x901ba, 0xa03a6, 0x90030, 0x9008a, 0x901da, 0x900b2,
+	0x70056, 0x8003a, 0x90112, 0xa017e, 0x901b4, 0xa02b6, 0xa022e, 0xa0196,
+	0xa03ae, 0xa013e, 0xa00be, 0xa035a, 0xb023c, 0xc0d1c, 0xd06be, 0xc038a,
+	0xc05d4, 0xc0e70, 0xc0a50, 0xc0674, 0xd1c3e, 0xb0074, 0xd05a6, 0xc0152,
+	0x8004a, 0x901bc, 0xa015a, 0xa038c, 0xa019a, 0xa01b2, 0xa003c, 0xa0070,
+	0xa017c, 0x80094, 0xa012a, 0x901aa, 0xa030c, 0xa01d0, 0xb0426, 0xb077e,
+	0xb00ae, 0xb07be, 0xb003e, 0x7006c, 0xa0214, 0x900ac, 0xb00ba, 0xb001a,
+	0xa0330, 0xb0552, 0xd0b8a, 0xc079a, 0xd1cba, 0xc0c74, 0xd077c, 0xd139a,
+	0xd039a, 0xc051c, 0xd18b6, 0xd11d4, 0xc089c, 0xc009c, 0xd1e74, 0xd0e74,
+	0xd15ae, 0xd05ae, 0xd1b9a, 0xd0b9a, 0xe04ae, 0xc0474, 0xd1dae, 0xd08b6,
+	0xd0cba, 0xc0670, 0xb0270, 0xc0a74, 0xc0250, 0xd14b6, 0xe16be, 0xf5b8a,
+	0xd0dae, 0xc0e50, 0xd01d4, 0xd11ae, 0xd04b6, 0xc0b54, 0xe24ae, 0xd171c,
+	0x50000, 0xa027e, 0x9012c, 0xb037e, 0x9011a, 0xb01ee, 0x90052, 0xb06ae,
+	0x9005a, 0xb023e, 0x90132, 0xa0014, 0x900b4, 0xb047e, 0x901fc, 0xa018c,
+	0x90126, 0xb007e, 0x9002c, 0xa0130, 0x60006, 0xa018a, 0x90032, 0xb0626,
+	0x90134, 0xa03b2, 0x9002a, 0xb02ba, 0x901d2, 0xb063e, 0x9019c, 0xa029c,
+	0x900fc, 0xa021a, 0xa033e, 0xa03ee, 0x901b6, 0x9000c, 0x90096, 0xa010c,
+	0x900da, 0xa0396, 0x9009a, 0xa03d4, 0x900d2, 0xa03d0, 0x900d4, 0xb03be,
+	0x800b0, 0x90054, 0x90170, 0xb02ae, 0x90150, 0xb0226, 0x9010a, 0xb072e,
+	0x90114, 0xb032e, 0x9001c, 0xb05ee, 0x900bc, 0xa002e, 0x90174, 0xa032a,
+	0xc0eba, 0xc0b52, 0xc0e3c, 0xc0cb6, 0xc0c9c, 0xc06ba, 0xc043e, 0xc063c,
+	0xc0abe, 0xc00b6, 0xc049c, 0xc0650, 0xc0f8a, 0xc0b7c, 0xc0cae, 0xc0352,
+	0xc0f52, 0xc037c, 0xc09a6, 0xc04ba, 0xc0850, 0xc01a6, 0xc078a, 0xc0354,
+	0xb011c, 0xc0826, 0xd01ae, 0xc0f7c, 0xd141a, 0xc0f54, 0xc0754, 0xc0da6,
+	0xc0b1c, 0xc0954, 0xd19ae, 0xc0274, 0xd177c, 0xc0050, 0xc0ebe, 0xd041a,
+	0xc0154, 0xd09ae, 0xc0dd4, 0xc0d54, 0xd0c3e, 0xc0026, 0xc0c50, 0xc0554,
+	0xe36be, 0xd071c, 0xc0f9a, 0xc0752, 0xc0952, 0xc0450, 0xc031c, 0xd12be,
+	0xe3b8a, 0xd02be, 0xd14ae, 0xc0f1c, 0xd15a6, 0xc09d4, 0xc0c1a, 0x80092,
+	0xf1b8a,
+};
+
+// index into NODES for every HUFFMAN_LUTBITS bit pattern
+static const uint16_t DECODE_LUTS[HUFFMAN_LUTSIZE] = {
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 28, 0, 165, 0, 13, 0,
+	24, 0, 26, 0, 139, 0, 3, 0, 1, 0, 340, 0, 186, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 344, 0, 1, 0, 154, 0, 146, 0, 189, 0,
+	36, 0, 150, 0, 22, 0, 6, 0, 1, 0, 41, 0, 70, 0, 353, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 64, 0, 9, 0, 13, 0,
+	325, 0, 134, 0, 177, 0, 40, 0, 1, 0, 136, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 7, 0,
+	71, 0, 12, 0, 330, 0, 5, 0, 1, 0, 10, 0, 23, 0, 357, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 37, 0, 33, 0, 13, 0,
+	24, 0, 255, 0, 73, 0, 166, 0, 1, 0, 170, 0, 333, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 17, 0, 1, 0, 19, 0, 85, 0, 349, 0,
+	176, 0, 39, 0, 140, 0, 347, 0, 1, 0, 342, 0, 188, 0, 50, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 30, 0, 9, 0, 13, 0,
+	27, 0, 172, 0, 174, 0, 40, 0, 1, 0, 168, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 15, 0,
+	20, 0, 12, 0, 14, 0, 5, 0, 1, 0, 10, 0, 160, 0, 11, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 182, 0, 167, 0, 13, 0,
+	24, 0, 42, 0, 184, 0, 3, 0, 1, 0, 132, 0, 332, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 144, 0, 1, 0, 74, 0, 130, 0, 31, 0,
+	147, 0, 138, 0, 152, 0, 6, 0, 1, 0, 41, 0, 25, 0, 49, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 64, 0, 9, 0, 13, 0,
+	180, 0, 337, 0, 328, 0, 40, 0, 1, 0, 66, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 7, 0,
+	178, 0, 12, 0, 190, 0, 5, 0, 1, 0, 10, 0, 72, 0, 43, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 149, 0, 143, 0, 13, 0,
+	24, 0, 255, 0, 73, 0, 47, 0, 1, 0, 68, 0, 158, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 346, 0, 1, 0, 75, 0, 32, 0, 350, 0,
+	176, 0, 69, 0, 44, 0, 164, 0, 1, 0, 34, 0, 65, 0, 21, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 30, 0, 9, 0, 13, 0,
+	77, 0, 156, 0, 329, 0, 40, 0, 1, 0, 38, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 352, 0,
+	20, 0, 12, 0, 14, 0, 5, 0, 1, 0, 10, 0, 142, 0, 11, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 28, 0, 165, 0, 13, 0,
+	24, 0, 26, 0, 84, 0, 3, 0, 1, 0, 161, 0, 186, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 345, 0, 1, 0, 154, 0, 146, 0, 46, 0,
+	36, 0, 150, 0, 22, 0, 6, 0, 1, 0, 41, 0, 335, 0, 354, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 64, 0, 9, 0, 13, 0,
+	324, 0, 134, 0, 177, 0, 40, 0, 1, 0, 136, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 7, 0,
+	326, 0, 12, 0, 331, 0, 5, 0, 1, 0, 10, 0, 23, 0, 129, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 37, 0, 33, 0, 13, 0,
+	24, 0, 255, 0, 73, 0, 166, 0, 1, 0, 170, 0, 159, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 17, 0, 1, 0, 19, 0, 85, 0, 351, 0,
+	176, 0, 39, 0, 140, 0, 45, 0, 1, 0, 343, 0, 188, 0, 355, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 30, 0, 9, 0, 13, 0,
+	27, 0, 172, 0, 174, 0, 40, 0, 1, 0, 168, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 15, 0,
+	20, 0, 12, 0, 14, 0, 5, 0, 1, 0, 10, 0, 160, 0, 11, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 182, 0, 76, 0, 13, 0,
+	24, 0, 42, 0, 184, 0, 3, 0, 1, 0, 132, 0, 334, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 144, 0, 1, 0, 191, 0, 130, 0, 348, 0,
+	88, 0, 138, 0, 152, 0, 6, 0, 1, 0, 41, 0, 25, 0, 162, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 64, 0, 9, 0, 13, 0,
+	180, 0, 338, 0, 327, 0, 40, 0, 1, 0, 51, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 7, 0,
+	178, 0, 12, 0, 190, 0, 5, 0, 1, 0, 10, 0, 336, 0, 359, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 339, 0, 67, 0, 13, 0,
+	24, 0, 255, 0, 73, 0, 169, 0, 1, 0, 341, 0, 158, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 35, 0, 1, 0, 75, 0, 32, 0, 48, 0,
+	176, 0, 153, 0, 44, 0, 164, 0, 1, 0, 34, 0, 65, 0, 356, 0,
+	128, 0, 2, 0, 8, 0, 148, 0, 1, 0, 30, 0, 9, 0, 13, 0,
+	173, 0, 156, 0, 171, 0, 40, 0, 1, 0, 38, 0, 18, 0, 4, 0,
+	128, 0, 2, 0, 8, 0, 29, 0, 1, 0, 16, 0, 83, 0, 163, 0,
+	20, 0, 12, 0, 14, 0, 5, 0, 1, 0, 10, 0, 142, 0, 11, 0,
+};
+
+static const HuffmanMultiEntry MULTI_LUTS[HUFFMAN_MULTI_LUTSIZE] = {
+	{{{128, 128, 0, 0}}, 2, 10, 0}, {{{0, 128, 128, 0}}, 3, 11, 0}, {{{2, 128, 0, 0}}, 2, 10, 0}, {{{0, 0, 128, 128}}, 4, 12, 0},
+	{{{8, 128, 0, 0}}, 2, 10, 0}, {{{0, 2, 128, 0}}, 3, 11, 0}, {{{148, 128, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 2, 9, 0}, {{{0, 8, 128, 0}}, 3, 11, 0}, {{{28, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 128}}, 4, 12, 0},
+	{{{165, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 128, 0}}, 3, 12, 0}, {{{13, 128, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 128, 0, 0}}, 2, 12, 0}, {{{0, 1, 128, 0}}, 3, 10, 0}, {{{26, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 128}}, 4, 12, 0},
+	{{{139, 0, 0, 0}}, 1, 10, 0}, {{{0, 28, 0, 0}}, 2, 10, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 128, 0}}, 3, 10, 0}, {{{0, 165, 0, 0}}, 2, 10, 0}, {{{87, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 128, 0}}, 3, 12, 0}, {{{4, 128, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 128, 0}}, 3, 11, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 128, 0}}, 3, 11, 0}, {{{0, 0, 1, 128}}, 4, 11, 0},
+	{{{8, 0, 128, 0}}, 3, 11, 0}, {{{0, 26, 0, 0}}, 2, 10, 0}, {{{237, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 2, 9, 0}, {{{0, 139, 0, 0}}, 2, 11, 0}, {{{154, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 28, 0}}, 3, 11, 0},
+	{{{146, 0, 0, 0}}, 1, 9, 0}, {{{0, 3, 0, 0}}, 2, 9, 0}, {{{189, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 128}}, 4, 11, 0}, {{{150, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 165, 0}}, 3, 11, 0},
+	{{{22, 0, 0, 0}}, 1, 9, 0}, {{{0, 87, 0, 0}}, 2, 12, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 128}}, 4, 11, 0}, {{{0, 186, 0, 0}}, 2, 10, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{70, 0, 0, 0}}, 1, 10, 0}, {{{0, 4, 128, 0}}, 3, 12, 0}, {{{82, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 2, 0, 0}}, 2, 10, 0}, {{{0, 128, 0, 128}}, 4, 12, 0}, {{{2, 2, 0, 0}}, 2, 10, 0}, {{{0, 0, 24, 0}}, 3, 9, 0},
+	{{{8, 2, 0, 0}}, 2, 10, 0}, {{{0, 2, 0, 128}}, 4, 12, 0}, {{{148, 0, 128, 0}}, 3, 12, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 128}}, 4, 12, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 26, 0}}, 3, 11, 0},
+	{{{9, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{13, 0, 128, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{229, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 2, 0}}, 3, 10, 0}, {{{134, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 139, 0}}, 3, 12, 0},
+	{{{177, 0, 0, 0}}, 1, 9, 0}, {{{0, 154, 0, 0}}, 2, 10, 0}, {{{40, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 28}}, 4, 12, 0},
+	{{{1, 0, 2, 0}}, 3, 10, 0}, {{{0, 146, 0, 0}}, 2, 10, 0}, {{{136, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 3, 0}}, 3, 10, 0},
+	{{{18, 128, 0, 0}}, 2, 12, 0}, {{{0, 189, 0, 0}}, 2, 11, 0}, {{{4, 0, 128, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 128}}, 4, 12, 0}, {{{0, 36, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 128}}, 4, 12, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 128}}, 4, 12, 0}, {{{0, 150, 0, 0}}, 2, 10, 0}, {{{29, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 165}}, 4, 12, 0},
+	{{{1, 148, 0, 0}}, 2, 10, 0}, {{{0, 22, 0, 0}}, 2, 10, 0}, {{{16, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{83, 128, 0, 0}}, 2, 12, 0}, {{{0, 6, 0, 0}}, 2, 9, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{71, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 186, 0}}, 3, 11, 0},
+	{{{61, 0, 0, 0}}, 1, 11, 0}, {{{0, 41, 0, 0}}, 2, 9, 0}, {{{5, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 70, 0, 0}}, 2, 11, 0}, {{{10, 128, 0, 0}}, 2, 12, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 1, 9, 0}, {{{0, 82, 0, 0}}, 2, 12, 0}, {{{145, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 8, 0, 0}}, 2, 10, 0}, {{{0, 128, 2, 0}}, 3, 11, 0}, {{{2, 8, 0, 0}}, 2, 10, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 8, 0, 0}}, 2, 10, 0}, {{{0, 2, 2, 0}}, 3, 11, 0}, {{{148, 2, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 24}}, 4, 10, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 2, 0}}, 3, 11, 0}, {{{37, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 2, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 8, 0}}, 3, 10, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 2, 9, 0}, {{{166, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 26}}, 4, 12, 0},
+	{{{1, 0, 8, 0}}, 3, 10, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{101, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 2, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 2, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{2, 0, 2, 0}}, 3, 11, 0}, {{{0, 0, 1, 2}}, 4, 11, 0},
+	{{{8, 0, 2, 0}}, 3, 11, 0}, {{{0, 134, 0, 0}}, 2, 10, 0}, {{{17, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 177, 0, 0}}, 2, 10, 0}, {{{19, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 154, 0}}, 3, 11, 0},
+	{{{85, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{80, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 2}}, 4, 11, 0}, {{{39, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 146, 0}}, 3, 11, 0},
+	{{{140, 0, 0, 0}}, 1, 9, 0}, {{{0, 136, 0, 0}}, 2, 10, 0}, {{{201, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 3}}, 4, 11, 0},
+	{{{1, 0, 0, 2}}, 4, 11, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{86, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 189, 0}}, 3, 12, 0},
+	{{{188, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {{{50, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 148, 0, 0}}, 2, 11, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 148, 0, 0}}, 2, 11, 0}, {{{0, 0, 36, 0}}, 3, 11, 0},
+	{{{8, 148, 0, 0}}, 2, 11, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 150, 0}}, 3, 11, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 148, 0}}, 3, 11, 0}, {{{172, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 22, 0}}, 3, 11, 0},
+	{{{174, 0, 0, 0}}, 1, 9, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 148, 0}}, 3, 11, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 6, 0}}, 3, 10, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 2, 9, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 71, 0, 0}}, 2, 11, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 186}}, 4, 12, 0},
+	{{{1, 13, 0, 0}}, 2, 10, 0}, {{{0, 61, 0, 0}}, 2, 12, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 41, 0}}, 3, 10, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 70, 0}}, 3, 12, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 23, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{160, 0, 0, 0}}, 1, 9, 0}, {{{0, 145, 0, 0}}, 2, 12, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 2, 9, 0}, {{{0, 128, 8, 0}}, 3, 11, 0}, {{{2, 1, 0, 0}}, 2, 9, 0}, {{{0, 0, 128, 2}}, 4, 12, 0},
+	{{{8, 1, 0, 0}}, 2, 9, 0}, {{{0, 2, 8, 0}}, 3, 11, 0}, {{{148, 8, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 24, 0, 0}}, 2, 11, 0}, {{{0, 8, 8, 0}}, 3, 11, 0}, {{{182, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 2}}, 4, 12, 0},
+	{{{167, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 2, 0}}, 3, 12, 0}, {{{13, 8, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 2, 0, 0}}, 2, 12, 0}, {{{0, 1, 1, 0}}, 3, 9, 0}, {{{42, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 2}}, 4, 12, 0},
+	{{{184, 0, 0, 0}}, 1, 9, 0}, {{{0, 37, 0, 0}}, 2, 10, 0}, {{{3, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 3, 9, 0}, {{{0, 33, 0, 0}}, 2, 10, 0}, {{{132, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{216, 0, 0, 0}}, 1, 11, 0}, {{{0, 13, 2, 0}}, 3, 12, 0}, {{{4, 8, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 8, 0}}, 3, 11, 0}, {{{0, 24, 0, 0}}, 3, 9, 0}, {{{2, 0, 8, 0}}, 3, 11, 0}, {{{0, 0, 1, 8}}, 4, 11, 0},
+	{{{8, 0, 8, 0}}, 3, 11, 0}, {{{0, 255, 0, 0}}, 2, 9, 0}, {{{144, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 73, 0, 0}}, 2, 9, 0}, {{{74, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 64, 0}}, 3, 10, 0},
+	{{{130, 0, 0, 0}}, 1, 9, 0}, {{{0, 166, 0, 0}}, 2, 10, 0}, {{{31, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{147, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 8}}, 4, 11, 0}, {{{138, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 9, 0}}, 3, 9, 0},
+	{{{152, 0, 0, 0}}, 1, 9, 0}, {{{0, 170, 0, 0}}, 2, 10, 0}, {{{6, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 8}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{41, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 2, 0}}, 3, 12, 0}, {{{49, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 2}}, 4, 12, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 2}}, 4, 12, 0}, {{{148, 0, 2, 0}}, 3, 12, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 2}}, 4, 12, 0}, {{{64, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 134, 0}}, 3, 11, 0},
+	{{{9, 2, 0, 0}}, 2, 12, 0}, {{{0, 17, 0, 0}}, 2, 10, 0}, {{{13, 0, 2, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{63, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 177, 0}}, 3, 11, 0},
+	{{{232, 0, 0, 0}}, 1, 12, 0}, {{{0, 19, 0, 0}}, 2, 10, 0}, {{{40, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 154}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 85, 0, 0}}, 2, 10, 0}, {{{66, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 40, 0}}, 3, 9, 0},
+	{{{18, 2, 0, 0}}, 2, 12, 0}, {{{0, 80, 0, 0}}, 2, 12, 0}, {{{4, 0, 2, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 2}}, 4, 12, 0}, {{{0, 176, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 2}}, 4, 12, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 2}}, 4, 12, 0}, {{{0, 39, 0, 0}}, 2, 10, 0}, {{{29, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 146}}, 4, 12, 0},
+	{{{1, 3, 0, 0}}, 2, 12, 0}, {{{0, 140, 0, 0}}, 2, 10, 0}, {{{16, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 136, 0}}, 3, 11, 0},
+	{{{83, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{7, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 18, 0}}, 3, 9, 0},
+	{{{190, 0, 0, 0}}, 1, 9, 0}, {{{0, 86, 0, 0}}, 2, 12, 0}, {{{5, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 188, 0, 0}}, 2, 10, 0}, {{{10, 2, 0, 0}}, 2, 12, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{72, 0, 0, 0}}, 1, 10, 0}, {{{0, 50, 0, 0}}, 2, 11, 0}, {{{43, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 148, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 148, 0}}, 3, 12, 0}, {{{148, 148, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 36}}, 4, 12, 0},
+	{{{1, 1, 0, 0}}, 3, 9, 0}, {{{0, 8, 148, 0}}, 3, 12, 0}, {{{149, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{143, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 148, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 3, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 2, 9, 0}, {{{0, 30, 0, 0}}, 2, 9, 0}, {{{47, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 150}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 3, 9, 0}, {{{68, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 29, 0}}, 3, 9, 0},
+	{{{158, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 148, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 148, 0}}, 3, 12, 0}, {{{0, 27, 0, 0}}, 2, 10, 0}, {{{2, 0, 148, 0}}, 3, 12, 0}, {{{0, 0, 1, 148}}, 4, 12, 0},
+	{{{8, 0, 148, 0}}, 3, 12, 0}, {{{0, 172, 0, 0}}, 2, 10, 0}, {{{213, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 22}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 174, 0, 0}}, 2, 10, 0}, {{{75, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 16, 0}}, 3, 9, 0},
+	{{{32, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 3, 9, 0}, {.subtable = {0, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 148}}, 4, 12, 0}, {{{69, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 83, 0}}, 3, 9, 0},
+	{{{44, 0, 0, 0}}, 1, 9, 0}, {{{0, 168, 0, 0}}, 2, 10, 0}, {{{164, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 6}}, 4, 11, 0},
+	{{{1, 0, 0, 148}}, 4, 12, 0}, {{{0, 18, 0, 0}}, 3, 9, 0}, {{{34, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 7, 0}}, 3, 10, 0},
+	{{{65, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{21, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 13, 0, 0}}, 2, 11, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 13, 0, 0}}, 2, 11, 0}, {{{0, 0, 71, 0}}, 3, 12, 0},
+	{{{8, 13, 0, 0}}, 2, 11, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 12, 0}}, 3, 9, 0},
+	{{{9, 0, 0, 0}}, 3, 9, 0}, {{{0, 29, 0, 0}}, 3, 9, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{77, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 13, 0}}, 3, 11, 0}, {{{156, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{.subtable = {2, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 16, 0, 0}}, 3, 9, 0}, {{{40, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 41}}, 4, 11, 0},
+	{{{1, 0, 13, 0}}, 3, 11, 0}, {{{0, 83, 0, 0}}, 3, 9, 0}, {{{38, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 5, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 3, 9, 0}, {{{0, 15, 0, 0}}, 2, 10, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 3, 9, 0}, {{{29, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 4, 0, 0}}, 2, 10, 0}, {{{0, 14, 0, 0}}, 2, 9, 0}, {{{16, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 10, 0}}, 3, 9, 0},
+	{{{83, 0, 0, 0}}, 3, 9, 0}, {{{0, 5, 0, 0}}, 3, 9, 0}, {{{133, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 23, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 2, 9, 0}, {{{0, 10, 0, 0}}, 3, 9, 0}, {{{5, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 160, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{142, 0, 0, 0}}, 1, 9, 0}, {{{0, 11, 0, 0}}, 2, 9, 0}, {{{11, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 24, 0, 0}}, 2, 12, 0}, {{{0, 128, 1, 0}}, 3, 10, 0}, {{{2, 24, 0, 0}}, 2, 12, 0}, {{{0, 0, 128, 8}}, 4, 12, 0},
+	{{{8, 24, 0, 0}}, 2, 12, 0}, {{{0, 2, 1, 0}}, 3, 10, 0}, {{{148, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 3, 10, 0}, {{{0, 8, 1, 0}}, 3, 10, 0}, {{{28, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 8}}, 4, 12, 0},
+	{{{165, 0, 0, 0}}, 2, 10, 0}, {{{0, 148, 8, 0}}, 3, 12, 0}, {{{13, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 8, 0, 0}}, 2, 12, 0}, {{{0, 1, 24, 0}}, 3, 12, 0}, {{{26, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 8, 8}}, 4, 12, 0},
+	{{{84, 0, 0, 0}}, 1, 10, 0}, {{{0, 182, 0, 0}}, 2, 10, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 24, 0}}, 3, 12, 0}, {{{0, 167, 0, 0}}, 2, 11, 0}, {{{161, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 2, 10, 0}, {{{0, 13, 8, 0}}, 3, 12, 0}, {{{4, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 1, 0}}, 3, 10, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 1, 0}}, 3, 10, 0}, {{{0, 0, 1, 1}}, 4, 10, 0},
+	{{{8, 0, 1, 0}}, 3, 10, 0}, {{{0, 42, 0, 0}}, 2, 10, 0}, {{{181, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 3, 10, 0}, {{{0, 184, 0, 0}}, 2, 10, 0}, {{{154, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 37, 0}}, 3, 11, 0},
+	{{{146, 0, 0, 0}}, 2, 10, 0}, {{{0, 3, 0, 0}}, 3, 10, 0}, {{{46, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 1}}, 4, 10, 0}, {{{150, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 33, 0}}, 3, 11, 0},
+	{{{22, 0, 0, 0}}, 2, 10, 0}, {{{0, 132, 0, 0}}, 2, 10, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 1}}, 4, 10, 0}, {{{0, 216, 0, 0}}, 2, 12, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{52, 0, 0, 0}}, 1, 11, 0}, {{{0, 4, 8, 0}}, 3, 12, 0}, {{{137, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 8}}, 4, 12, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 24, 0}}, 4, 10, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 8}}, 4, 12, 0}, {{{148, 0, 8, 0}}, 3, 12, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 3, 10, 0}, {{{0, 8, 0, 8}}, 4, 12, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 255, 0}}, 3, 10, 0},
+	{{{9, 8, 0, 0}}, 2, 12, 0}, {{{0, 144, 0, 0}}, 2, 10, 0}, {{{13, 0, 8, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{116, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{134, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 73, 0}}, 3, 10, 0},
+	{{{177, 0, 0, 0}}, 2, 10, 0}, {{{0, 74, 0, 0}}, 2, 11, 0}, {{{40, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 64}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 130, 0, 0}}, 2, 10, 0}, {{{136, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 166, 0}}, 3, 11, 0},
+	{{{18, 8, 0, 0}}, 2, 12, 0}, {{{0, 31, 0, 0}}, 2, 11, 0}, {{{4, 0, 8, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 8}}, 4, 12, 0}, {{{0, 147, 0, 0}}, 2, 11, 0}, {{{2, 0, 0, 8}}, 4, 12, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 8}}, 4, 12, 0}, {{{0, 138, 0, 0}}, 2, 10, 0}, {{{29, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 9}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 152, 0, 0}}, 2, 10, 0}, {{{16, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 170, 0}}, 3, 11, 0},
+	{{{83, 8, 0, 0}}, 2, 12, 0}, {{{0, 6, 0, 0}}, 3, 10, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{114, 0, 0, 0}}, 1, 11, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{227, 0, 0, 0}}, 1, 12, 0}, {{{0, 41, 0, 0}}, 3, 10, 0}, {{{5, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 25, 0, 0}}, 2, 10, 0}, {{{10, 8, 0, 0}}, 2, 12, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 2, 10, 0}, {{{0, 49, 0, 0}}, 2, 11, 0}, {{{129, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 2, 10, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 3, 10, 0}, {{{166, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 134}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 17, 0}}, 3, 11, 0},
+	{{{159, 0, 0, 0}}, 1, 10, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 180, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{17, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 177}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{19, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 19, 0}}, 3, 11, 0},
+	{{{85, 0, 0, 0}}, 2, 10, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{179, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 85, 0}}, 3, 11, 0},
+	{{{140, 0, 0, 0}}, 2, 10, 0}, {{{0, 66, 0, 0}}, 2, 11, 0}, {{{45, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 40}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{155, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{188, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {.subtable = {4, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 176, 0}}, 3, 10, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 39, 0}}, 3, 11, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{172, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 140, 0}}, 3, 11, 0},
+	{{{174, 0, 0, 0}}, 2, 10, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 136}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 3, 10, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 178, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 18}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 190, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 188, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 72, 0, 0}}, 2, 11, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 50, 0}}, 3, 12, 0},
+	{{{160, 0, 0, 0}}, 2, 10, 0}, {{{0, 43, 0, 0}}, 2, 11, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 3, 10, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 3, 10, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 3, 10, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{76, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 4, 10, 0}, {{{42, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 2, 10, 0}, {{{0, 149, 0, 0}}, 2, 11, 0}, {{{3, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 4, 10, 0}, {{{0, 143, 0, 0}}, 2, 11, 0}, {{{132, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{246, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 4, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 3, 10, 0}, {{{144, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 73, 0, 0}}, 3, 10, 0}, {{{191, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 30, 0}}, 3, 10, 0},
+	{{{130, 0, 0, 0}}, 2, 10, 0}, {{{0, 47, 0, 0}}, 2, 11, 0}, {{{185, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{88, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 9, 0}}, 4, 10, 0},
+	{{{152, 0, 0, 0}}, 2, 10, 0}, {{{0, 68, 0, 0}}, 2, 11, 0}, {{{6, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 29}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 158, 0, 0}}, 2, 10, 0}, {{{41, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{162, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 27, 0}}, 3, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 172, 0}}, 3, 11, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{207, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 174, 0}}, 3, 11, 0},
+	{{{215, 0, 0, 0}}, 1, 12, 0}, {{{0, 75, 0, 0}}, 2, 10, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 16}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 32, 0, 0}}, 2, 10, 0}, {{{51, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 40, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 3, 10, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 69, 0, 0}}, 2, 11, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 83}}, 4, 10, 0},
+	{{{1, 6, 0, 0}}, 2, 12, 0}, {{{0, 44, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 168, 0}}, 3, 11, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 164, 0, 0}}, 2, 10, 0}, {{{7, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 4, 10, 0},
+	{{{190, 0, 0, 0}}, 2, 10, 0}, {{{0, 34, 0, 0}}, 2, 10, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 7}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 65, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{209, 0, 0, 0}}, 1, 12, 0}, {{{0, 21, 0, 0}}, 2, 11, 0}, {{{131, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 13, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 13, 0}}, 3, 12, 0}, {{{148, 13, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 1, 0, 0}}, 4, 10, 0}, {{{0, 8, 13, 0}}, 3, 12, 0}, {{{55, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{67, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 13, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 4, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 3, 10, 0}, {{{0, 30, 0, 0}}, 3, 10, 0}, {{{169, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 12}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 4, 10, 0}, {.subtable = {6, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 29, 0}}, 4, 10, 0},
+	{{{158, 0, 0, 0}}, 2, 10, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 13, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 13, 0}}, 3, 12, 0}, {{{0, 77, 0, 0}}, 2, 11, 0}, {{{2, 0, 13, 0}}, 3, 12, 0}, {{{0, 0, 1, 13}}, 4, 12, 0},
+	{{{8, 0, 13, 0}}, 3, 12, 0}, {{{0, 156, 0, 0}}, 2, 10, 0}, {{{35, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 41, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{75, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 16, 0}}, 4, 10, 0},
+	{{{32, 0, 0, 0}}, 2, 10, 0}, {{{0, 40, 0, 0}}, 4, 10, 0}, {{{48, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 3, 10, 0}, {{{0, 1, 0, 13}}, 4, 12, 0}, {{{153, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 83, 0}}, 4, 10, 0},
+	{{{44, 0, 0, 0}}, 2, 10, 0}, {{{0, 38, 0, 0}}, 2, 10, 0}, {{{164, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 5}}, 4, 10, 0},
+	{{{1, 0, 0, 13}}, 4, 12, 0}, {{{0, 18, 0, 0}}, 4, 10, 0}, {{{34, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 15, 0}}, 3, 11, 0},
+	{{{65, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{175, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 4, 0, 0}}, 2, 11, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 4, 0, 0}}, 2, 11, 0}, {{{0, 0, 20, 0}}, 3, 10, 0},
+	{{{8, 4, 0, 0}}, 2, 11, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 12, 0}}, 4, 10, 0},
+	{{{9, 0, 0, 0}}, 4, 10, 0}, {{{0, 29, 0, 0}}, 4, 10, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{173, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 4, 0}}, 3, 11, 0}, {{{156, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 14, 0}}, 3, 10, 0},
+	{{{171, 0, 0, 0}}, 1, 10, 0}, {{{0, 16, 0, 0}}, 4, 10, 0}, {{{40, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 10}}, 4, 10, 0},
+	{{{1, 0, 4, 0}}, 3, 11, 0}, {{{0, 83, 0, 0}}, 4, 10, 0}, {{{38, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 5, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 4, 10, 0}, {{{0, 133, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 3, 10, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 4, 10, 0}, {{{29, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 23}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 14, 0, 0}}, 3, 10, 0}, {{{16, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 10, 0}}, 4, 10, 0},
+	{{{83, 0, 0, 0}}, 4, 10, 0}, {{{0, 5, 0, 0}}, 4, 10, 0}, {{{163, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 3, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 160, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 3, 10, 0}, {{{0, 10, 0, 0}}, 4, 10, 0}, {{{5, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 142, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 11, 0}}, 3, 10, 0},
+	{{{142, 0, 0, 0}}, 2, 10, 0}, {{{0, 11, 0, 0}}, 3, 10, 0}, {{{11, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 128, 0, 0}}, 3, 11, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 128, 0, 0}}, 3, 11, 0}, {{{0, 0, 128, 1}}, 4, 11, 0},
+	{{{8, 128, 0, 0}}, 3, 11, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{28, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 1}}, 4, 11, 0},
+	{{{165, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 1, 0}}, 3, 11, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 1, 0, 0}}, 2, 11, 0}, {{{0, 1, 128, 0}}, 4, 11, 0}, {{{26, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 1}}, 4, 11, 0},
+	{{{139, 0, 0, 0}}, 2, 11, 0}, {{{0, 28, 0, 0}}, 3, 11, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 128, 0}}, 4, 11, 0}, {{{0, 165, 0, 0}}, 3, 11, 0}, {.subtable = {8, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 1, 0}}, 3, 11, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 26, 0, 0}}, 3, 11, 0}, {{{78, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 2, 9, 0}, {{{0, 84, 0, 0}}, 2, 11, 0}, {{{154, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 182, 0}}, 3, 11, 0},
+	{{{146, 0, 0, 0}}, 1, 9, 0}, {{{0, 3, 0, 0}}, 2, 9, 0}, {{{189, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{150, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 167, 0}}, 3, 12, 0},
+	{{{22, 0, 0, 0}}, 1, 9, 0}, {{{0, 161, 0, 0}}, 2, 11, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 186, 0, 0}}, 3, 11, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{70, 0, 0, 0}}, 2, 11, 0}, {{{0, 4, 1, 0}}, 3, 11, 0}, {{{198, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 2, 0, 0}}, 3, 11, 0}, {{{0, 128, 0, 1}}, 4, 11, 0}, {{{2, 2, 0, 0}}, 3, 11, 0}, {{{0, 0, 24, 0}}, 3, 9, 0},
+	{{{8, 2, 0, 0}}, 3, 11, 0}, {{{0, 2, 0, 1}}, 4, 11, 0}, {{{148, 0, 1, 0}}, 3, 11, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 1}}, 4, 11, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 42, 0}}, 3, 11, 0},
+	{{{9, 1, 0, 0}}, 2, 11, 0}, {{{0, 181, 0, 0}}, 2, 12, 0}, {{{13, 0, 1, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{245, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 2, 0}}, 4, 11, 0}, {{{134, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 184, 0}}, 3, 11, 0},
+	{{{177, 0, 0, 0}}, 1, 9, 0}, {{{0, 154, 0, 0}}, 3, 11, 0}, {{{40, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 37}}, 4, 12, 0},
+	{{{1, 0, 2, 0}}, 4, 11, 0}, {{{0, 146, 0, 0}}, 3, 11, 0}, {{{136, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 3, 0}}, 4, 11, 0},
+	{{{18, 1, 0, 0}}, 2, 11, 0}, {{{0, 46, 0, 0}}, 2, 11, 0}, {{{4, 0, 1, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 1}}, 4, 11, 0}, {{{0, 36, 0, 0}}, 3, 11, 0}, {{{2, 0, 0, 1}}, 4, 11, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 1}}, 4, 11, 0}, {{{0, 150, 0, 0}}, 3, 11, 0}, {{{29, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 33}}, 4, 12, 0},
+	{{{1, 148, 0, 0}}, 3, 11, 0}, {{{0, 22, 0, 0}}, 3, 11, 0}, {{{16, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 132, 0}}, 3, 11, 0},
+	{{{83, 1, 0, 0}}, 2, 11, 0}, {{{0, 6, 0, 0}}, 2, 9, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{71, 0, 0, 0}}, 2, 11, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{109, 0, 0, 0}}, 1, 12, 0}, {{{0, 41, 0, 0}}, 2, 9, 0}, {{{5, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 52, 0, 0}}, 2, 12, 0}, {{{10, 1, 0, 0}}, 2, 11, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 1, 9, 0}, {{{0, 137, 0, 0}}, 2, 12, 0}, {{{141, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 8, 0, 0}}, 3, 11, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 8, 0, 0}}, 3, 11, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 8, 0, 0}}, 3, 11, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 24}}, 4, 10, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 8, 0}}, 4, 11, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 2, 9, 0}, {{{166, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 255}}, 4, 11, 0},
+	{{{1, 0, 8, 0}}, 4, 11, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 144, 0}}, 3, 11, 0},
+	{{{202, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 134, 0, 0}}, 3, 11, 0}, {{{17, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 73}}, 4, 11, 0},
+	{{{1, 64, 0, 0}}, 2, 12, 0}, {{{0, 177, 0, 0}}, 3, 11, 0}, {{{19, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 74, 0}}, 3, 12, 0},
+	{{{85, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {.subtable = {10, 2}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 130, 0}}, 3, 11, 0},
+	{{{140, 0, 0, 0}}, 1, 9, 0}, {{{0, 136, 0, 0}}, 3, 11, 0}, {.subtable = {14, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 166}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{211, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 31, 0}}, 3, 12, 0},
+	{{{188, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {{{50, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 147, 0}}, 3, 12, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 9, 0, 0}}, 2, 11, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 138, 0}}, 3, 11, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{172, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 152, 0}}, 3, 11, 0},
+	{{{174, 0, 0, 0}}, 1, 9, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 170}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 6, 0}}, 4, 11, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 2, 9, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 114, 0, 0}}, 2, 12, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 13, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 41, 0}}, 4, 11, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 25, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 23, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 49, 0}}, 3, 12, 0},
+	{{{160, 0, 0, 0}}, 1, 9, 0}, {{{0, 129, 0, 0}}, 2, 11, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 2, 9, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 2, 9, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 2, 9, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{167, 0, 0, 0}}, 2, 11, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 3, 9, 0}, {{{42, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 1, 9, 0}, {{{0, 37, 0, 0}}, 3, 11, 0}, {{{3, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 3, 9, 0}, {{{0, 33, 0, 0}}, 3, 11, 0}, {{{132, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{97, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 3, 9, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 2, 9, 0}, {{{144, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 73, 0, 0}}, 2, 9, 0}, {{{74, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 64, 0}}, 4, 11, 0},
+	{{{130, 0, 0, 0}}, 1, 9, 0}, {{{0, 166, 0, 0}}, 3, 11, 0}, {{{31, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{147, 0, 0, 0}}, 2, 11, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 9, 0}}, 3, 9, 0},
+	{{{152, 0, 0, 0}}, 1, 9, 0}, {{{0, 170, 0, 0}}, 3, 11, 0}, {{{6, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 17}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 159, 0, 0}}, 2, 11, 0}, {{{41, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{49, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 180, 0}}, 3, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 17, 0, 0}}, 3, 11, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{89, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{239, 0, 0, 0}}, 1, 12, 0}, {{{0, 19, 0, 0}}, 3, 11, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 19}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 85, 0, 0}}, 3, 11, 0}, {{{66, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 40, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 179, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 39, 0, 0}}, 3, 11, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 85}}, 4, 12, 0},
+	{{{1, 40, 0, 0}}, 2, 11, 0}, {{{0, 140, 0, 0}}, 3, 11, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 66, 0}}, 3, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 45, 0, 0}}, 2, 11, 0}, {{{7, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 3, 9, 0},
+	{{{190, 0, 0, 0}}, 1, 9, 0}, {{{0, 155, 0, 0}}, 2, 12, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 188, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{72, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{43, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 176}}, 4, 11, 0},
+	{{{1, 1, 0, 0}}, 3, 9, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{149, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{143, 0, 0, 0}}, 2, 11, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 3, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 2, 9, 0}, {{{0, 30, 0, 0}}, 2, 9, 0}, {{{47, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 39}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 3, 9, 0}, {{{68, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 29, 0}}, 3, 9, 0},
+	{{{158, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 27, 0, 0}}, 3, 11, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 172, 0, 0}}, 3, 11, 0}, {.subtable = {16, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 140}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 174, 0, 0}}, 3, 11, 0}, {{{75, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 16, 0}}, 3, 9, 0},
+	{{{32, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 3, 9, 0}, {.subtable = {18, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{69, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 83, 0}}, 3, 9, 0},
+	{{{44, 0, 0, 0}}, 1, 9, 0}, {{{0, 168, 0, 0}}, 3, 11, 0}, {{{164, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 3, 9, 0}, {{{34, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 7, 0}}, 4, 11, 0},
+	{{{65, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{21, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 178, 0}}, 3, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 18, 0, 0}}, 2, 11, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 12, 0}}, 3, 9, 0},
+	{{{9, 0, 0, 0}}, 3, 9, 0}, {{{0, 29, 0, 0}}, 3, 9, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{77, 0, 0, 0}}, 2, 11, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{156, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 190, 0}}, 3, 11, 0},
+	{{{56, 0, 0, 0}}, 1, 12, 0}, {{{0, 16, 0, 0}}, 3, 9, 0}, {{{40, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 3, 9, 0}, {{{38, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 5, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 3, 9, 0}, {{{0, 15, 0, 0}}, 3, 11, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 3, 9, 0}, {{{29, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 188}}, 4, 12, 0},
+	{{{1, 4, 0, 0}}, 3, 11, 0}, {{{0, 14, 0, 0}}, 2, 9, 0}, {{{16, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 10, 0}}, 3, 9, 0},
+	{{{83, 0, 0, 0}}, 3, 9, 0}, {{{0, 5, 0, 0}}, 3, 9, 0}, {{{187, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 72, 0}}, 3, 12, 0},
+	{{{14, 0, 0, 0}}, 2, 9, 0}, {{{0, 10, 0, 0}}, 3, 9, 0}, {{{5, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 160, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 43, 0}}, 3, 12, 0},
+	{{{142, 0, 0, 0}}, 1, 9, 0}, {{{0, 11, 0, 0}}, 2, 9, 0}, {{{11, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 1, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 1, 0}}, 4, 11, 0}, {{{148, 1, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 4, 11, 0}, {{{0, 8, 1, 0}}, 4, 11, 0}, {{{28, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{165, 0, 0, 0}}, 3, 11, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 1, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{26, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{84, 0, 0, 0}}, 2, 11, 0}, {{{0, 182, 0, 0}}, 3, 11, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 76, 0, 0}}, 2, 11, 0}, {{{161, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 3, 11, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 1, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 1, 0}}, 4, 11, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 1, 0}}, 4, 11, 0}, {{{0, 0, 1, 1}}, 4, 10, 0},
+	{{{8, 0, 1, 0}}, 4, 11, 0}, {{{0, 42, 0, 0}}, 3, 11, 0}, {{{151, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 4, 11, 0}, {{{0, 184, 0, 0}}, 3, 11, 0}, {{{154, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 149, 0}}, 3, 12, 0},
+	{{{146, 0, 0, 0}}, 3, 11, 0}, {{{0, 3, 0, 0}}, 4, 11, 0}, {{{46, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 3, 11, 0}, {{{0, 1, 0, 1}}, 4, 10, 0}, {{{150, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 143, 0}}, 3, 12, 0},
+	{{{22, 0, 0, 0}}, 3, 11, 0}, {{{0, 132, 0, 0}}, 3, 11, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 1}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{199, 0, 0, 0}}, 1, 12, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{157, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 24, 0}}, 4, 10, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 4, 11, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 255, 0}}, 4, 11, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 144, 0, 0}}, 3, 11, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{203, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{134, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 73, 0}}, 4, 11, 0},
+	{{{177, 0, 0, 0}}, 3, 11, 0}, {{{0, 191, 0, 0}}, 2, 11, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 30}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 130, 0, 0}}, 3, 11, 0}, {{{136, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 47, 0}}, 3, 12, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 185, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 88, 0, 0}}, 2, 11, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 138, 0, 0}}, 3, 11, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 9}}, 4, 10, 0},
+	{{{1, 29, 0, 0}}, 2, 11, 0}, {{{0, 152, 0, 0}}, 3, 11, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 68, 0}}, 3, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 6, 0, 0}}, 4, 11, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{113, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 158, 0}}, 3, 11, 0},
+	{{{59, 0, 0, 0}}, 1, 12, 0}, {{{0, 41, 0, 0}}, 4, 11, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 25, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 3, 11, 0}, {{{0, 162, 0, 0}}, 2, 11, 0}, {{{129, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 27}}, 4, 12, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 3, 11, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 4, 11, 0}, {{{166, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 172}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{159, 0, 0, 0}}, 2, 11, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 180, 0, 0}}, 3, 11, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{17, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 174}}, 4, 12, 0},
+	{{{1, 16, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{19, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 75, 0}}, 3, 11, 0},
+	{{{85, 0, 0, 0}}, 3, 11, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{135, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 32, 0}}, 3, 11, 0},
+	{{{140, 0, 0, 0}}, 3, 11, 0}, {{{0, 51, 0, 0}}, 2, 11, 0}, {{{45, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 40}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{197, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{188, 0, 0, 0}}, 3, 11, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {.subtable = {20, 2}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 176, 0}}, 4, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 83, 0, 0}}, 2, 11, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 69, 0}}, 3, 12, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 3, 11, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{172, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 44, 0}}, 3, 11, 0},
+	{{{174, 0, 0, 0}}, 3, 11, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 168}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 164, 0}}, 3, 11, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 4, 11, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 178, 0, 0}}, 3, 11, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 18}}, 4, 10, 0},
+	{{{1, 7, 0, 0}}, 2, 12, 0}, {{{0, 190, 0, 0}}, 3, 11, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 34, 0}}, 3, 11, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 65, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 21, 0}}, 3, 12, 0},
+	{{{160, 0, 0, 0}}, 3, 11, 0}, {{{0, 131, 0, 0}}, 2, 12, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 4, 11, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 4, 11, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 4, 11, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{76, 0, 0, 0}}, 2, 11, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 4, 10, 0}, {{{42, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{3, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 4, 10, 0}, {{{0, 67, 0, 0}}, 2, 11, 0}, {{{132, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{.subtable = {24, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 4, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 4, 11, 0}, {{{144, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 12, 0, 0}}, 2, 11, 0}, {{{0, 73, 0, 0}}, 4, 11, 0}, {{{191, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 30, 0}}, 4, 11, 0},
+	{{{130, 0, 0, 0}}, 3, 11, 0}, {{{0, 169, 0, 0}}, 2, 11, 0}, {{{183, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{88, 0, 0, 0}}, 2, 11, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 9, 0}}, 4, 10, 0},
+	{{{152, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{6, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 29}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 158, 0, 0}}, 3, 11, 0}, {{{41, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 3, 11, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{162, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 77, 0}}, 3, 12, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 156, 0}}, 3, 11, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 35, 0, 0}}, 2, 11, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 3, 11, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{243, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{222, 0, 0, 0}}, 1, 12, 0}, {{{0, 75, 0, 0}}, 3, 11, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 16}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 32, 0, 0}}, 3, 11, 0}, {{{51, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 40, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 48, 0, 0}}, 2, 11, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 153, 0, 0}}, 2, 11, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 83}}, 4, 10, 0},
+	{{{1, 5, 0, 0}}, 2, 11, 0}, {{{0, 44, 0, 0}}, 3, 11, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 38, 0}}, 3, 11, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 164, 0, 0}}, 3, 11, 0}, {{{7, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 3, 11, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 4, 10, 0},
+	{{{190, 0, 0, 0}}, 3, 11, 0}, {{{0, 34, 0, 0}}, 3, 11, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 15}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 65, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{.subtable = {26, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 175, 0, 0}}, 2, 12, 0}, {{{79, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 4, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 4, 0}}, 3, 12, 0}, {{{148, 4, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 20}}, 4, 11, 0},
+	{{{1, 1, 0, 0}}, 4, 10, 0}, {{{0, 8, 4, 0}}, 3, 12, 0}, {{{214, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{67, 0, 0, 0}}, 2, 11, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 4, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 4, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 4, 11, 0}, {{{0, 30, 0, 0}}, 4, 11, 0}, {{{169, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 12}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 4, 10, 0}, {{{91, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 29, 0}}, 4, 10, 0},
+	{{{158, 0, 0, 0}}, 3, 11, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 4, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 4, 0}}, 3, 12, 0}, {{{0, 173, 0, 0}}, 2, 11, 0}, {{{2, 0, 4, 0}}, 3, 12, 0}, {{{0, 0, 1, 4}}, 4, 12, 0},
+	{{{8, 0, 4, 0}}, 3, 12, 0}, {{{0, 156, 0, 0}}, 3, 11, 0}, {{{35, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 14}}, 4, 11, 0},
+	{{{1, 10, 0, 0}}, 2, 11, 0}, {{{0, 171, 0, 0}}, 2, 11, 0}, {{{75, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 16, 0}}, 4, 10, 0},
+	{{{32, 0, 0, 0}}, 3, 11, 0}, {{{0, 40, 0, 0}}, 4, 10, 0}, {{{48, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 4, 11, 0}, {{{0, 1, 0, 4}}, 4, 12, 0}, {{{153, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 83, 0}}, 4, 10, 0},
+	{{{44, 0, 0, 0}}, 3, 11, 0}, {{{0, 38, 0, 0}}, 3, 11, 0}, {{{164, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 5}}, 4, 10, 0},
+	{{{1, 0, 0, 4}}, 4, 12, 0}, {{{0, 18, 0, 0}}, 4, 10, 0}, {{{34, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{65, 0, 0, 0}}, 3, 11, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{81, 0, 0, 0}}, 1, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 20, 0}}, 4, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 12, 0}}, 4, 10, 0},
+	{{{9, 0, 0, 0}}, 4, 10, 0}, {{{0, 29, 0, 0}}, 4, 10, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{173, 0, 0, 0}}, 2, 11, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{156, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 14, 0}}, 4, 11, 0},
+	{{{171, 0, 0, 0}}, 2, 11, 0}, {{{0, 16, 0, 0}}, 4, 10, 0}, {{{40, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 10}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 4, 10, 0}, {{{38, 0, 0, 0}}, 3, 11, 0}, {{{0, 0, 5, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 4, 10, 0}, {{{0, 163, 0, 0}}, 2, 11, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 4, 10, 0}, {{{29, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 160}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 14, 0, 0}}, 4, 11, 0}, {{{16, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 10, 0}}, 4, 10, 0},
+	{{{83, 0, 0, 0}}, 4, 10, 0}, {{{0, 5, 0, 0}}, 4, 10, 0}, {{{163, 0, 0, 0}}, 2, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 4, 11, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 142, 0}}, 3, 11, 0},
+	{{{14, 0, 0, 0}}, 4, 11, 0}, {{{0, 10, 0, 0}}, 4, 10, 0}, {{{5, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 11}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 142, 0, 0}}, 3, 11, 0}, {{{10, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 11, 0}}, 4, 11, 0},
+	{{{142, 0, 0, 0}}, 3, 11, 0}, {{{0, 11, 0, 0}}, 4, 11, 0}, {{{11, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 128, 0, 0}}, 2, 10, 0}, {{{0, 128, 128, 0}}, 4, 12, 0}, {{{2, 128, 0, 0}}, 2, 10, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 128, 0, 0}}, 2, 10, 0}, {{{0, 2, 128, 0}}, 4, 12, 0}, {{{148, 128, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 2, 9, 0}, {{{0, 8, 128, 0}}, 4, 12, 0}, {{{28, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{165, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 128, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 128, 0}}, 3, 10, 0}, {{{26, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{139, 0, 0, 0}}, 1, 10, 0}, {{{0, 28, 0, 0}}, 2, 10, 0}, {{{3, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 128, 0}}, 3, 10, 0}, {{{0, 165, 0, 0}}, 2, 10, 0}, {{{87, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 148, 1}}, 4, 12, 0},
+	{{{186, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 128, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 128, 0}}, 4, 12, 0}, {{{0, 24, 1, 0}}, 3, 12, 0}, {{{2, 0, 128, 0}}, 4, 12, 0}, {{{0, 0, 1, 128}}, 4, 11, 0},
+	{{{8, 0, 128, 0}}, 4, 12, 0}, {{{0, 26, 0, 0}}, 2, 10, 0}, {{{217, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 2, 9, 0}, {{{0, 139, 0, 0}}, 3, 12, 0}, {{{154, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 28, 0}}, 4, 12, 0},
+	{{{146, 0, 0, 0}}, 1, 9, 0}, {{{0, 3, 0, 0}}, 2, 9, 0}, {{{189, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 128}}, 4, 11, 0}, {{{150, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 165, 0}}, 4, 12, 0},
+	{{{22, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{6, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 128}}, 4, 11, 0}, {{{0, 186, 0, 0}}, 2, 10, 0}, {{{41, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 13, 1}}, 4, 12, 0},
+	{{{70, 0, 0, 0}}, 1, 10, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{82, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 2, 0, 0}}, 2, 10, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 2, 0, 0}}, 2, 10, 0}, {{{0, 0, 24, 0}}, 3, 9, 0},
+	{{{8, 2, 0, 0}}, 2, 10, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 26, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 78, 0, 0}}, 2, 12, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{212, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 2, 0}}, 3, 10, 0}, {{{134, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 84, 0}}, 3, 12, 0},
+	{{{177, 0, 0, 0}}, 1, 9, 0}, {{{0, 154, 0, 0}}, 2, 10, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 182}}, 4, 12, 0},
+	{{{1, 0, 2, 0}}, 3, 10, 0}, {{{0, 146, 0, 0}}, 2, 10, 0}, {{{136, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 3, 0}}, 3, 10, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 189, 0, 0}}, 3, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 36, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 150, 0, 0}}, 2, 10, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 148, 0, 0}}, 2, 10, 0}, {{{0, 22, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 161, 0}}, 3, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 6, 0, 0}}, 2, 9, 0}, {{{7, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{71, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 186, 0}}, 4, 12, 0},
+	{{{61, 0, 0, 0}}, 2, 12, 0}, {{{0, 41, 0, 0}}, 2, 9, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 70, 0, 0}}, 3, 12, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 1}}, 4, 12, 0},
+	{{{23, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{145, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 8, 0, 0}}, 2, 10, 0}, {{{0, 128, 2, 0}}, 4, 12, 0}, {{{2, 8, 0, 0}}, 2, 10, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 8, 0, 0}}, 2, 10, 0}, {{{0, 2, 2, 0}}, 4, 12, 0}, {{{148, 2, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 24}}, 4, 10, 0},
+	{{{1, 1, 1, 0}}, 3, 12, 0}, {{{0, 8, 2, 0}}, 4, 12, 0}, {{{37, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 0, 1}}, 4, 12, 0}, {{{13, 2, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 1, 0}}, 3, 12, 0}, {{{0, 1, 8, 0}}, 3, 10, 0}, {{{255, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 1, 0, 0}}, 2, 12, 0}, {{{0, 64, 0, 0}}, 2, 9, 0}, {{{166, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 42}}, 4, 12, 0},
+	{{{1, 0, 8, 0}}, 3, 10, 0}, {{{0, 9, 1, 0}}, 3, 12, 0}, {{{170, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{100, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 1}}, 4, 12, 0}, {{{4, 2, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 2, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{2, 0, 2, 0}}, 4, 12, 0}, {{{0, 0, 1, 2}}, 4, 11, 0},
+	{{{8, 0, 2, 0}}, 4, 12, 0}, {{{0, 134, 0, 0}}, 2, 10, 0}, {{{17, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 184}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 177, 0, 0}}, 2, 10, 0}, {{{19, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 154, 0}}, 4, 12, 0},
+	{{{85, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 1, 0}}, 3, 12, 0}, {{{80, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 1, 0, 0}}, 2, 12, 0}, {{{0, 1, 0, 2}}, 4, 11, 0}, {{{39, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 146, 0}}, 4, 12, 0},
+	{{{140, 0, 0, 0}}, 1, 9, 0}, {{{0, 136, 0, 0}}, 2, 10, 0}, {.subtable = {28, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 3}}, 4, 11, 0},
+	{{{1, 0, 0, 2}}, 4, 11, 0}, {{{0, 18, 1, 0}}, 3, 12, 0}, {{{86, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 46, 0}}, 3, 12, 0},
+	{{{188, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 1}}, 4, 12, 0}, {{{50, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 148, 0, 0}}, 3, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 148, 0, 0}}, 3, 12, 0}, {{{0, 0, 36, 0}}, 4, 12, 0},
+	{{{8, 148, 0, 0}}, 3, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 1}}, 4, 12, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 150, 0}}, 4, 12, 0},
+	{{{9, 0, 1, 0}}, 3, 12, 0}, {{{0, 29, 1, 0}}, 3, 12, 0}, {{{13, 0, 0, 1}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 148, 0}}, 4, 12, 0}, {{{172, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 22, 0}}, 4, 12, 0},
+	{{{174, 0, 0, 0}}, 1, 9, 0}, {{{0, 16, 1, 0}}, 3, 12, 0}, {{{40, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 0, 132}}, 4, 12, 0},
+	{{{1, 0, 148, 0}}, 4, 12, 0}, {{{0, 83, 1, 0}}, 3, 12, 0}, {{{168, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 6, 0}}, 3, 10, 0},
+	{{{18, 0, 1, 0}}, 3, 12, 0}, {{{0, 7, 0, 0}}, 2, 9, 0}, {{{4, 0, 0, 1}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 71, 0, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 1, 0}}, 3, 12, 0}, {{{29, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 13, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{16, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 41, 0}}, 3, 10, 0},
+	{{{83, 0, 1, 0}}, 3, 12, 0}, {{{0, 5, 1, 0}}, 3, 12, 0}, {{{15, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 1, 0, 0}}, 2, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{14, 1, 0, 0}}, 2, 12, 0}, {{{0, 10, 1, 0}}, 3, 12, 0}, {{{5, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 23, 0, 0}}, 2, 10, 0}, {{{10, 0, 1, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{160, 0, 0, 0}}, 1, 9, 0}, {{{0, 141, 0, 0}}, 2, 12, 0}, {{{11, 1, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 2, 9, 0}, {{{0, 128, 8, 0}}, 4, 12, 0}, {{{2, 1, 0, 0}}, 2, 9, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 2, 9, 0}, {{{0, 2, 8, 0}}, 4, 12, 0}, {{{148, 8, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 24, 0, 0}}, 3, 12, 0}, {{{0, 8, 8, 0}}, 4, 12, 0}, {{{182, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{167, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 8, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 3, 9, 0}, {{{42, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 1, 9, 0}, {{{0, 37, 0, 0}}, 2, 10, 0}, {{{3, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 3, 9, 0}, {{{0, 33, 0, 0}}, 2, 10, 0}, {{{132, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{216, 0, 0, 0}}, 2, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 8, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 8, 0}}, 4, 12, 0}, {{{0, 24, 0, 0}}, 3, 9, 0}, {{{2, 0, 8, 0}}, 4, 12, 0}, {{{0, 0, 1, 8}}, 4, 11, 0},
+	{{{8, 0, 8, 0}}, 4, 12, 0}, {{{0, 255, 0, 0}}, 2, 9, 0}, {{{144, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 255, 0, 0}}, 2, 12, 0}, {{{0, 73, 0, 0}}, 2, 9, 0}, {{{74, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 64, 0}}, 3, 10, 0},
+	{{{130, 0, 0, 0}}, 1, 9, 0}, {{{0, 166, 0, 0}}, 2, 10, 0}, {{{31, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{147, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 8}}, 4, 11, 0}, {{{138, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 9, 0}}, 3, 9, 0},
+	{{{152, 0, 0, 0}}, 1, 9, 0}, {{{0, 170, 0, 0}}, 2, 10, 0}, {{{6, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 144}}, 4, 12, 0},
+	{{{1, 0, 0, 8}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{41, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{49, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 73, 0, 0}}, 2, 12, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 134, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 17, 0, 0}}, 2, 10, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{244, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 177, 0}}, 4, 12, 0},
+	{{{225, 0, 0, 0}}, 1, 12, 0}, {{{0, 19, 0, 0}}, 2, 10, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 85, 0, 0}}, 2, 10, 0}, {{{66, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 40, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 39, 0, 0}}, 2, 10, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 130}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 140, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 136, 0}}, 4, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{7, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 3, 9, 0},
+	{{{190, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 188, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{72, 0, 0, 0}}, 1, 10, 0}, {{{0, 50, 0, 0}}, 3, 12, 0}, {{{43, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 9, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 9, 0, 0}}, 2, 12, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 9, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 1, 0, 0}}, 3, 9, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{149, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{143, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 3, 9, 0}, {{{0, 1, 9, 0}}, 3, 12, 0}, {{{255, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 2, 9, 0}, {{{0, 30, 0, 0}}, 2, 9, 0}, {{{47, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 138}}, 4, 12, 0},
+	{{{1, 0, 9, 0}}, 3, 12, 0}, {{{0, 9, 0, 0}}, 3, 9, 0}, {{{68, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 29, 0}}, 3, 9, 0},
+	{{{158, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 27, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 172, 0, 0}}, 2, 10, 0}, {{{210, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 152}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 174, 0, 0}}, 2, 10, 0}, {{{75, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 16, 0}}, 3, 9, 0},
+	{{{32, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 3, 9, 0}, {.subtable = {30, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{69, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 83, 0}}, 3, 9, 0},
+	{{{44, 0, 0, 0}}, 1, 9, 0}, {{{0, 168, 0, 0}}, 2, 10, 0}, {{{164, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 6}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 3, 9, 0}, {{{34, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 7, 0}}, 3, 10, 0},
+	{{{65, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{21, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 13, 0, 0}}, 3, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 13, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{8, 13, 0, 0}}, 3, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 12, 0}}, 3, 9, 0},
+	{{{9, 0, 0, 0}}, 3, 9, 0}, {{{0, 29, 0, 0}}, 3, 9, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{77, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 13, 0}}, 4, 12, 0}, {{{156, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{253, 0, 0, 0}}, 1, 12, 0}, {{{0, 16, 0, 0}}, 3, 9, 0}, {{{40, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 41}}, 4, 11, 0},
+	{{{1, 0, 13, 0}}, 4, 12, 0}, {{{0, 83, 0, 0}}, 3, 9, 0}, {{{38, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 5, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 3, 9, 0}, {{{0, 15, 0, 0}}, 2, 10, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 3, 9, 0}, {{{29, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 25}}, 4, 12, 0},
+	{{{1, 4, 0, 0}}, 2, 10, 0}, {{{0, 14, 0, 0}}, 2, 9, 0}, {{{16, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 10, 0}}, 3, 9, 0},
+	{{{83, 0, 0, 0}}, 3, 9, 0}, {{{0, 5, 0, 0}}, 3, 9, 0}, {{{133, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 23, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 2, 9, 0}, {{{0, 10, 0, 0}}, 3, 9, 0}, {{{5, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 160, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 129, 0}}, 3, 12, 0},
+	{{{142, 0, 0, 0}}, 1, 9, 0}, {{{0, 11, 0, 0}}, 2, 9, 0}, {{{11, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 1, 0}}, 3, 10, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 1, 0}}, 3, 10, 0}, {{{148, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 3, 10, 0}, {{{0, 8, 1, 0}}, 3, 10, 0}, {{{28, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{165, 0, 0, 0}}, 2, 10, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{26, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{84, 0, 0, 0}}, 1, 10, 0}, {{{0, 182, 0, 0}}, 2, 10, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 167, 0, 0}}, 3, 12, 0}, {{{161, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 2, 10, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 1, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 1, 0}}, 3, 10, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 1, 0}}, 3, 10, 0}, {{{0, 0, 1, 1}}, 4, 10, 0},
+	{{{8, 0, 1, 0}}, 3, 10, 0}, {{{0, 42, 0, 0}}, 2, 10, 0}, {{{181, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 3, 10, 0}, {{{0, 184, 0, 0}}, 2, 10, 0}, {{{154, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 37, 0}}, 4, 12, 0},
+	{{{146, 0, 0, 0}}, 2, 10, 0}, {{{0, 3, 0, 0}}, 3, 10, 0}, {{{46, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 1}}, 4, 10, 0}, {{{150, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 33, 0}}, 4, 12, 0},
+	{{{22, 0, 0, 0}}, 2, 10, 0}, {{{0, 132, 0, 0}}, 2, 10, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 1}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{52, 0, 0, 0}}, 2, 12, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{137, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 24, 0}}, 4, 10, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 3, 10, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 255, 0}}, 3, 10, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 144, 0, 0}}, 2, 10, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{58, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{134, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 73, 0}}, 3, 10, 0},
+	{{{177, 0, 0, 0}}, 2, 10, 0}, {{{0, 74, 0, 0}}, 3, 12, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 64}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 130, 0, 0}}, 2, 10, 0}, {{{136, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 166, 0}}, 4, 12, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 31, 0, 0}}, 3, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 147, 0, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 138, 0, 0}}, 2, 10, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 9}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 152, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 170, 0}}, 4, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 6, 0, 0}}, 3, 10, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{114, 0, 0, 0}}, 2, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 159, 0}}, 3, 12, 0},
+	{{{115, 0, 0, 0}}, 1, 12, 0}, {{{0, 41, 0, 0}}, 3, 10, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 25, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 2, 10, 0}, {{{0, 49, 0, 0}}, 3, 12, 0}, {{{129, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 180}}, 4, 12, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 2, 10, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 3, 10, 0}, {{{166, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 17, 0}}, 4, 12, 0},
+	{{{159, 0, 0, 0}}, 1, 10, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 180, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 89, 0, 0}}, 2, 12, 0}, {{{17, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{19, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 19, 0}}, 4, 12, 0},
+	{{{85, 0, 0, 0}}, 2, 10, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{179, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 85, 0}}, 4, 12, 0},
+	{{{140, 0, 0, 0}}, 2, 10, 0}, {{{0, 66, 0, 0}}, 3, 12, 0}, {{{45, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 40}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{155, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{188, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {{{200, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 40, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 40, 0, 0}}, 2, 12, 0}, {{{0, 0, 176, 0}}, 3, 10, 0},
+	{{{8, 40, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 39, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 40, 0}}, 3, 12, 0}, {{{172, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 140, 0}}, 4, 12, 0},
+	{{{174, 0, 0, 0}}, 2, 10, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 40, 0}}, 3, 12, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 45, 0}}, 3, 12, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 3, 10, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 178, 0, 0}}, 2, 10, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 18}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 190, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 188, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 72, 0, 0}}, 3, 12, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{160, 0, 0, 0}}, 2, 10, 0}, {{{0, 43, 0, 0}}, 3, 12, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 3, 10, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 3, 10, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 3, 10, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 176, 0, 0}}, 2, 12, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{76, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 4, 10, 0}, {{{42, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 2, 10, 0}, {{{0, 149, 0, 0}}, 3, 12, 0}, {{{3, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 4, 10, 0}, {{{0, 143, 0, 0}}, 3, 12, 0}, {{{132, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{224, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 4, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 3, 10, 0}, {{{144, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 73, 0, 0}}, 3, 10, 0}, {{{191, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 30, 0}}, 3, 10, 0},
+	{{{130, 0, 0, 0}}, 2, 10, 0}, {{{0, 47, 0, 0}}, 3, 12, 0}, {{{185, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{88, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 9, 0}}, 4, 10, 0},
+	{{{152, 0, 0, 0}}, 2, 10, 0}, {{{0, 68, 0, 0}}, 3, 12, 0}, {{{6, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 29}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 158, 0, 0}}, 2, 10, 0}, {{{41, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{162, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 27, 0}}, 4, 12, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 172, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{193, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 174, 0}}, 4, 12, 0},
+	{{{125, 0, 0, 0}}, 1, 12, 0}, {{{0, 75, 0, 0}}, 2, 10, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 16}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 32, 0, 0}}, 2, 10, 0}, {{{51, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 40, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 3, 10, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 69, 0, 0}}, 3, 12, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 83}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 44, 0, 0}}, 2, 10, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 168, 0}}, 4, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 164, 0, 0}}, 2, 10, 0}, {{{7, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 2, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 4, 10, 0},
+	{{{190, 0, 0, 0}}, 2, 10, 0}, {{{0, 34, 0, 0}}, 2, 10, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 7}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 65, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{205, 0, 0, 0}}, 1, 12, 0}, {{{0, 21, 0, 0}}, 3, 12, 0}, {{{131, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 18, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 18, 0, 0}}, 2, 12, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 18, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 178}}, 4, 12, 0},
+	{{{1, 1, 0, 0}}, 4, 10, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {.subtable = {32, 3}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{67, 0, 0, 0}}, 1, 10, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 4, 10, 0}, {{{0, 1, 18, 0}}, 3, 12, 0}, {{{255, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 3, 10, 0}, {{{0, 30, 0, 0}}, 3, 10, 0}, {{{169, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 12}}, 4, 10, 0},
+	{{{1, 0, 18, 0}}, 3, 12, 0}, {{{0, 9, 0, 0}}, 4, 10, 0}, {.subtable = {40, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 29, 0}}, 4, 10, 0},
+	{{{158, 0, 0, 0}}, 2, 10, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 77, 0, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 156, 0, 0}}, 2, 10, 0}, {{{35, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 190}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{75, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 16, 0}}, 4, 10, 0},
+	{{{32, 0, 0, 0}}, 2, 10, 0}, {{{0, 40, 0, 0}}, 4, 10, 0}, {{{48, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 3, 10, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{153, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 83, 0}}, 4, 10, 0},
+	{{{44, 0, 0, 0}}, 2, 10, 0}, {{{0, 38, 0, 0}}, 2, 10, 0}, {{{164, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 0, 5}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 4, 10, 0}, {{{34, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 15, 0}}, 4, 12, 0},
+	{{{65, 0, 0, 0}}, 2, 10, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{175, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 4, 0, 0}}, 3, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 4, 0, 0}}, 3, 12, 0}, {{{0, 0, 20, 0}}, 3, 10, 0},
+	{{{8, 4, 0, 0}}, 3, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 12, 0}}, 4, 10, 0},
+	{{{9, 0, 0, 0}}, 4, 10, 0}, {{{0, 29, 0, 0}}, 4, 10, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{173, 0, 0, 0}}, 1, 10, 0}, {{{0, 1, 4, 0}}, 4, 12, 0}, {{{156, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 14, 0}}, 3, 10, 0},
+	{{{171, 0, 0, 0}}, 1, 10, 0}, {{{0, 16, 0, 0}}, 4, 10, 0}, {{{40, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 10}}, 4, 10, 0},
+	{{{1, 0, 4, 0}}, 4, 12, 0}, {{{0, 83, 0, 0}}, 4, 10, 0}, {{{38, 0, 0, 0}}, 2, 10, 0}, {{{0, 0, 5, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 4, 10, 0}, {{{0, 187, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 3, 10, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 4, 10, 0}, {{{29, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 14, 0, 0}}, 3, 10, 0}, {{{16, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 10, 0}}, 4, 10, 0},
+	{{{83, 0, 0, 0}}, 4, 10, 0}, {{{0, 5, 0, 0}}, 4, 10, 0}, {{{163, 0, 0, 0}}, 1, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 3, 10, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 160, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 3, 10, 0}, {{{0, 10, 0, 0}}, 4, 10, 0}, {{{5, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 142, 0, 0}}, 2, 10, 0}, {{{10, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 11, 0}}, 3, 10, 0},
+	{{{142, 0, 0, 0}}, 2, 10, 0}, {{{0, 11, 0, 0}}, 3, 10, 0}, {{{11, 0, 0, 0}}, 3, 10, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 128, 0, 0}}, 4, 12, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 128, 0, 0}}, 4, 12, 0}, {{{0, 0, 128, 1}}, 4, 11, 0},
+	{{{8, 128, 0, 0}}, 4, 12, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{28, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 1}}, 4, 11, 0},
+	{{{165, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 1, 0}}, 4, 12, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 1, 0, 0}}, 3, 12, 0}, {{{0, 1, 128, 0}}, 4, 11, 0}, {{{26, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 1}}, 4, 11, 0},
+	{{{139, 0, 0, 0}}, 3, 12, 0}, {{{0, 28, 0, 0}}, 4, 12, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 128, 0}}, 4, 11, 0}, {{{0, 165, 0, 0}}, 4, 12, 0}, {{{254, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 1, 0}}, 4, 12, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 26, 0, 0}}, 4, 12, 0}, {{{78, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 2, 9, 0}, {{{0, 84, 0, 0}}, 3, 12, 0}, {{{154, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 182, 0}}, 4, 12, 0},
+	{{{146, 0, 0, 0}}, 1, 9, 0}, {{{0, 3, 0, 0}}, 2, 9, 0}, {{{189, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{150, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 76, 0}}, 3, 12, 0},
+	{{{22, 0, 0, 0}}, 1, 9, 0}, {{{0, 161, 0, 0}}, 3, 12, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 186, 0, 0}}, 4, 12, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{70, 0, 0, 0}}, 3, 12, 0}, {{{0, 4, 1, 0}}, 4, 12, 0}, {.subtable = {42, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 2, 0, 0}}, 4, 12, 0}, {{{0, 128, 0, 1}}, 4, 11, 0}, {{{2, 2, 0, 0}}, 4, 12, 0}, {{{0, 0, 24, 0}}, 3, 9, 0},
+	{{{8, 2, 0, 0}}, 4, 12, 0}, {{{0, 2, 0, 1}}, 4, 11, 0}, {{{148, 0, 1, 0}}, 4, 12, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 2, 9, 0}, {{{0, 8, 0, 1}}, 4, 11, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 42, 0}}, 4, 12, 0},
+	{{{9, 1, 0, 0}}, 3, 12, 0}, {{{0, 151, 0, 0}}, 2, 12, 0}, {{{13, 0, 1, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{238, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 2, 0}}, 4, 11, 0}, {{{134, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 184, 0}}, 4, 12, 0},
+	{{{177, 0, 0, 0}}, 1, 9, 0}, {{{0, 154, 0, 0}}, 4, 12, 0}, {{{40, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 2, 0}}, 4, 11, 0}, {{{0, 146, 0, 0}}, 4, 12, 0}, {{{136, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 3, 0}}, 4, 11, 0},
+	{{{18, 1, 0, 0}}, 3, 12, 0}, {{{0, 46, 0, 0}}, 3, 12, 0}, {{{4, 0, 1, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 1}}, 4, 11, 0}, {{{0, 36, 0, 0}}, 4, 12, 0}, {{{2, 0, 0, 1}}, 4, 11, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 1}}, 4, 11, 0}, {{{0, 150, 0, 0}}, 4, 12, 0}, {{{29, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 148, 0, 0}}, 4, 12, 0}, {{{0, 22, 0, 0}}, 4, 12, 0}, {{{16, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 132, 0}}, 4, 12, 0},
+	{{{83, 1, 0, 0}}, 3, 12, 0}, {{{0, 6, 0, 0}}, 2, 9, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{71, 0, 0, 0}}, 3, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{93, 0, 0, 0}}, 1, 12, 0}, {{{0, 41, 0, 0}}, 2, 9, 0}, {{{5, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{10, 1, 0, 0}}, 3, 12, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 1, 9, 0}, {{{0, 157, 0, 0}}, 2, 12, 0}, {{{141, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 8, 0, 0}}, 4, 12, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 8, 0, 0}}, 4, 12, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 8, 0, 0}}, 4, 12, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 24}}, 4, 10, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 1, 9, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 8, 0}}, 4, 11, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 2, 9, 0}, {{{166, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 255}}, 4, 11, 0},
+	{{{1, 0, 8, 0}}, 4, 11, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 144, 0}}, 4, 12, 0},
+	{{{196, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 134, 0, 0}}, 4, 12, 0}, {{{17, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 73}}, 4, 11, 0},
+	{{{1, 30, 0, 0}}, 2, 12, 0}, {{{0, 177, 0, 0}}, 4, 12, 0}, {{{19, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 191, 0}}, 3, 12, 0},
+	{{{85, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{206, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 130, 0}}, 4, 12, 0},
+	{{{140, 0, 0, 0}}, 1, 9, 0}, {{{0, 136, 0, 0}}, 4, 12, 0}, {{{195, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {.subtable = {44, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{188, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {{{50, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 29, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 29, 0, 0}}, 2, 12, 0}, {{{0, 0, 88, 0}}, 3, 12, 0},
+	{{{8, 29, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 9, 0, 0}}, 3, 12, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 138, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 29, 0}}, 3, 12, 0}, {{{172, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 152, 0}}, 4, 12, 0},
+	{{{174, 0, 0, 0}}, 1, 9, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 29, 0}}, 3, 12, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 6, 0}}, 4, 11, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 2, 9, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 158}}, 4, 12, 0},
+	{{{1, 13, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 41, 0}}, 4, 11, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 25, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 23, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 162, 0}}, 3, 12, 0},
+	{{{160, 0, 0, 0}}, 1, 9, 0}, {{{0, 129, 0, 0}}, 3, 12, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 2, 9, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 2, 9, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 2, 9, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{167, 0, 0, 0}}, 3, 12, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 3, 9, 0}, {{{42, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 1, 9, 0}, {{{0, 37, 0, 0}}, 4, 12, 0}, {{{3, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 3, 9, 0}, {{{0, 33, 0, 0}}, 4, 12, 0}, {{{132, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{53, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 3, 9, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 2, 9, 0}, {{{144, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 73, 0, 0}}, 2, 9, 0}, {{{74, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 64, 0}}, 4, 11, 0},
+	{{{130, 0, 0, 0}}, 1, 9, 0}, {{{0, 166, 0, 0}}, 4, 12, 0}, {{{31, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{147, 0, 0, 0}}, 3, 12, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 9, 0}}, 3, 9, 0},
+	{{{152, 0, 0, 0}}, 1, 9, 0}, {{{0, 170, 0, 0}}, 4, 12, 0}, {{{6, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 159, 0, 0}}, 3, 12, 0}, {{{41, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{49, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 16, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 16, 0, 0}}, 2, 12, 0}, {{{0, 0, 180, 0}}, 4, 12, 0},
+	{{{8, 16, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 17, 0, 0}}, 4, 12, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 16, 0}}, 3, 12, 0}, {{{89, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{235, 0, 0, 0}}, 1, 12, 0}, {{{0, 19, 0, 0}}, 4, 12, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 75}}, 4, 12, 0},
+	{{{1, 0, 16, 0}}, 3, 12, 0}, {{{0, 85, 0, 0}}, 4, 12, 0}, {{{66, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 40, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 135, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 39, 0, 0}}, 4, 12, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 32}}, 4, 12, 0},
+	{{{1, 40, 0, 0}}, 3, 12, 0}, {{{0, 140, 0, 0}}, 4, 12, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 51, 0}}, 3, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 45, 0, 0}}, 3, 12, 0}, {{{7, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 1, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 3, 9, 0},
+	{{{190, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 188, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{72, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{43, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 83, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 83, 0, 0}}, 2, 12, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 83, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 176}}, 4, 11, 0},
+	{{{1, 1, 0, 0}}, 3, 9, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{149, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{143, 0, 0, 0}}, 3, 12, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 3, 9, 0}, {{{0, 1, 83, 0}}, 3, 12, 0}, {{{255, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 2, 9, 0}, {{{0, 30, 0, 0}}, 2, 9, 0}, {{{47, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 83, 0}}, 3, 12, 0}, {{{0, 9, 0, 0}}, 3, 9, 0}, {{{68, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 29, 0}}, 3, 9, 0},
+	{{{158, 0, 0, 0}}, 1, 9, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 27, 0, 0}}, 4, 12, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 172, 0, 0}}, 4, 12, 0}, {{{223, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 44}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 174, 0, 0}}, 4, 12, 0}, {{{75, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 16, 0}}, 3, 9, 0},
+	{{{32, 0, 0, 0}}, 1, 9, 0}, {{{0, 40, 0, 0}}, 3, 9, 0}, {.subtable = {46, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{69, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 83, 0}}, 3, 9, 0},
+	{{{44, 0, 0, 0}}, 1, 9, 0}, {{{0, 168, 0, 0}}, 4, 12, 0}, {{{164, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 0, 164}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 3, 9, 0}, {{{34, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 7, 0}}, 4, 11, 0},
+	{{{65, 0, 0, 0}}, 1, 9, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{21, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 178, 0}}, 4, 12, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 18, 0, 0}}, 3, 12, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 12, 0}}, 3, 9, 0},
+	{{{9, 0, 0, 0}}, 3, 9, 0}, {{{0, 29, 0, 0}}, 3, 9, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{77, 0, 0, 0}}, 3, 12, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{156, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 190, 0}}, 4, 12, 0},
+	{{{234, 0, 0, 0}}, 1, 12, 0}, {{{0, 16, 0, 0}}, 3, 9, 0}, {{{40, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 34}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 3, 9, 0}, {{{38, 0, 0, 0}}, 1, 9, 0}, {{{0, 0, 5, 0}}, 3, 9, 0},
+	{{{18, 0, 0, 0}}, 3, 9, 0}, {{{0, 15, 0, 0}}, 4, 12, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 2, 9, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 3, 9, 0}, {{{29, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 65}}, 4, 12, 0},
+	{{{1, 4, 0, 0}}, 4, 12, 0}, {{{0, 14, 0, 0}}, 2, 9, 0}, {{{16, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 10, 0}}, 3, 9, 0},
+	{{{83, 0, 0, 0}}, 3, 9, 0}, {{{0, 5, 0, 0}}, 3, 9, 0}, {{{187, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 2, 9, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{14, 0, 0, 0}}, 2, 9, 0}, {{{0, 10, 0, 0}}, 3, 9, 0}, {{{5, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 160, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 3, 9, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{142, 0, 0, 0}}, 1, 9, 0}, {{{0, 11, 0, 0}}, 2, 9, 0}, {{{11, 0, 0, 0}}, 2, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 1, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 1, 0}}, 4, 11, 0}, {{{148, 1, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 128, 0, 0}}, 4, 11, 0}, {{{0, 8, 1, 0}}, 4, 11, 0}, {{{28, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{165, 0, 0, 0}}, 4, 12, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 1, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{26, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{84, 0, 0, 0}}, 3, 12, 0}, {{{0, 182, 0, 0}}, 4, 12, 0}, {{{3, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 76, 0, 0}}, 3, 12, 0}, {{{161, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 148, 0}}, 3, 8, 0},
+	{{{186, 0, 0, 0}}, 4, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 1, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 1, 0}}, 4, 11, 0}, {{{0, 24, 0, 0}}, 2, 8, 0}, {{{2, 0, 1, 0}}, 4, 11, 0}, {{{0, 0, 1, 1}}, 4, 10, 0},
+	{{{8, 0, 1, 0}}, 4, 11, 0}, {{{0, 42, 0, 0}}, 4, 12, 0}, {{{151, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 2, 0, 0}}, 4, 11, 0}, {{{0, 184, 0, 0}}, 4, 12, 0}, {{{154, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{146, 0, 0, 0}}, 4, 12, 0}, {{{0, 3, 0, 0}}, 4, 11, 0}, {{{46, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{36, 0, 0, 0}}, 4, 12, 0}, {{{0, 1, 0, 1}}, 4, 10, 0}, {{{150, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 67, 0}}, 3, 12, 0},
+	{{{22, 0, 0, 0}}, 4, 12, 0}, {{{0, 132, 0, 0}}, 4, 12, 0}, {{{6, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 148}}, 4, 9, 0},
+	{{{1, 0, 0, 1}}, 4, 10, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{41, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 13, 0}}, 3, 8, 0},
+	{{{194, 0, 0, 0}}, 1, 12, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{157, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 12, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 12, 0, 0}}, 2, 12, 0}, {{{0, 0, 24, 0}}, 4, 10, 0},
+	{{{8, 12, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 8, 0, 0}}, 4, 11, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 255, 0}}, 4, 11, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 144, 0, 0}}, 4, 12, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{121, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 12, 0}}, 3, 12, 0}, {{{134, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 73, 0}}, 4, 11, 0},
+	{{{177, 0, 0, 0}}, 4, 12, 0}, {{{0, 191, 0, 0}}, 3, 12, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 30}}, 4, 11, 0},
+	{{{1, 0, 12, 0}}, 3, 12, 0}, {{{0, 130, 0, 0}}, 4, 12, 0}, {{{136, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 169, 0}}, 3, 12, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 183, 0, 0}}, 2, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 88, 0, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 138, 0, 0}}, 4, 12, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 9}}, 4, 10, 0},
+	{{{1, 29, 0, 0}}, 3, 12, 0}, {{{0, 152, 0, 0}}, 4, 12, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 6, 0, 0}}, 4, 11, 0}, {{{7, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{57, 0, 0, 0}}, 1, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 158, 0}}, 4, 12, 0},
+	{.subtable = {48, 1}, .flags = HUFFMAN_ENTRY_SUBTABLE}, {{{0, 41, 0, 0}}, 4, 11, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 13}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 25, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 3, 8, 0},
+	{{{23, 0, 0, 0}}, 4, 12, 0}, {{{0, 162, 0, 0}}, 3, 12, 0}, {{{129, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 1, 0, 0}}, 2, 8, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{37, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{33, 0, 0, 0}}, 4, 12, 0}, {{{0, 148, 0, 0}}, 3, 8, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 2, 8, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 1, 8, 0}, {{{0, 64, 0, 0}}, 4, 11, 0}, {{{166, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 156}}, 4, 12, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 2, 8, 0}, {{{170, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 35, 0}}, 3, 12, 0},
+	{{{159, 0, 0, 0}}, 3, 12, 0}, {{{0, 13, 0, 0}}, 3, 8, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 180, 0, 0}}, 4, 12, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{17, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 16, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{19, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 75, 0}}, 4, 12, 0},
+	{{{85, 0, 0, 0}}, 4, 12, 0}, {{{0, 40, 0, 0}}, 2, 8, 0}, {{{135, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{39, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 32, 0}}, 4, 12, 0},
+	{{{140, 0, 0, 0}}, 4, 12, 0}, {{{0, 51, 0, 0}}, 3, 12, 0}, {{{45, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 40}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 2, 8, 0}, {{{192, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 48, 0}}, 3, 12, 0},
+	{{{188, 0, 0, 0}}, 4, 12, 0}, {{{0, 4, 0, 0}}, 3, 8, 0}, {{{230, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 5, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 5, 0, 0}}, 2, 12, 0}, {{{0, 0, 176, 0}}, 4, 11, 0},
+	{{{8, 5, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 83, 0, 0}}, 3, 12, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 153, 0}}, 3, 12, 0},
+	{{{9, 0, 0, 0}}, 2, 8, 0}, {{{0, 29, 0, 0}}, 2, 8, 0}, {{{13, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{27, 0, 0, 0}}, 4, 12, 0}, {{{0, 1, 5, 0}}, 3, 12, 0}, {{{172, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 44, 0}}, 4, 12, 0},
+	{{{174, 0, 0, 0}}, 4, 12, 0}, {{{0, 16, 0, 0}}, 2, 8, 0}, {{{40, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 38}}, 4, 12, 0},
+	{{{1, 0, 5, 0}}, 3, 12, 0}, {{{0, 83, 0, 0}}, 2, 8, 0}, {{{168, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 164, 0}}, 4, 12, 0},
+	{{{18, 0, 0, 0}}, 2, 8, 0}, {{{0, 7, 0, 0}}, 4, 11, 0}, {{{4, 0, 0, 0}}, 3, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 178, 0, 0}}, 4, 12, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 2, 8, 0}, {{{29, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 18}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 190, 0, 0}}, 4, 12, 0}, {{{16, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 34, 0}}, 4, 12, 0},
+	{{{83, 0, 0, 0}}, 2, 8, 0}, {{{0, 5, 0, 0}}, 2, 8, 0}, {{{15, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 1, 8, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 65, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 1, 8, 0}, {{{0, 10, 0, 0}}, 2, 8, 0}, {{{5, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 4}}, 4, 9, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{10, 0, 0, 0}}, 2, 8, 0}, {{{0, 0, 0, 0}}, 2, 2, 0},
+	{{{160, 0, 0, 0}}, 4, 12, 0}, {{{0, 79, 0, 0}}, 2, 12, 0}, {{{11, 0, 0, 0}}, 1, 8, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 1, 0, 0}}, 4, 11, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 1, 0, 0}}, 4, 11, 0}, {{{0, 0, 128, 0}}, 3, 7, 0},
+	{{{8, 1, 0, 0}}, 4, 11, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 128}}, 4, 8, 0},
+	{{{1, 20, 0, 0}}, 2, 12, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{182, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 2, 0}}, 3, 7, 0},
+	{{{76, 0, 0, 0}}, 3, 12, 0}, {{{0, 148, 0, 0}}, 2, 7, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 1, 7, 0}, {{{0, 1, 1, 0}}, 4, 10, 0}, {{{42, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 8, 0}}, 3, 7, 0},
+	{{{184, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{3, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 2}}, 4, 8, 0},
+	{{{1, 0, 1, 0}}, 4, 10, 0}, {{{0, 67, 0, 0}}, 3, 12, 0}, {{{132, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 148, 0}}, 4, 9, 0},
+	{{{251, 0, 0, 0}}, 1, 12, 0}, {{{0, 13, 0, 0}}, 2, 7, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 24, 0, 0}}, 4, 10, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 255, 0, 0}}, 4, 11, 0}, {{{144, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 8}}, 4, 8, 0},
+	{{{1, 12, 0, 0}}, 3, 12, 0}, {{{0, 73, 0, 0}}, 4, 11, 0}, {{{191, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 30, 0}}, 4, 11, 0},
+	{{{130, 0, 0, 0}}, 4, 12, 0}, {{{0, 169, 0, 0}}, 3, 12, 0}, {{{183, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{88, 0, 0, 0}}, 3, 12, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{138, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 9, 0}}, 4, 10, 0},
+	{{{152, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 0}}, 1, 1, 0}, {{{6, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 29}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 158, 0, 0}}, 4, 12, 0}, {{{41, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 13, 0}}, 4, 9, 0},
+	{{{25, 0, 0, 0}}, 4, 12, 0}, {{{0, 4, 0, 0}}, 2, 7, 0}, {{{162, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 10, 0, 0}}, 2, 12, 0}, {{{0, 128, 0, 0}}, 3, 7, 0}, {{{2, 10, 0, 0}}, 2, 12, 0}, {{{0, 0, 173, 0}}, 3, 12, 0},
+	{{{8, 10, 0, 0}}, 2, 12, 0}, {{{0, 2, 0, 0}}, 3, 7, 0}, {{{148, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 14, 0, 0}}, 2, 12, 0}, {{{0, 8, 0, 0}}, 3, 7, 0}, {{{64, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 156, 0}}, 4, 12, 0},
+	{{{9, 0, 0, 0}}, 1, 7, 0}, {{{0, 35, 0, 0}}, 3, 12, 0}, {{{13, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{180, 0, 0, 0}}, 4, 12, 0}, {{{0, 1, 10, 0}}, 3, 12, 0}, {{{208, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 171, 0}}, 3, 12, 0},
+	{{{221, 0, 0, 0}}, 1, 12, 0}, {{{0, 75, 0, 0}}, 4, 12, 0}, {{{40, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 16}}, 4, 10, 0},
+	{{{1, 0, 10, 0}}, 3, 12, 0}, {{{0, 32, 0, 0}}, 4, 12, 0}, {{{51, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 40, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 1, 7, 0}, {{{0, 48, 0, 0}}, 3, 12, 0}, {{{4, 0, 0, 0}}, 2, 7, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 3, 7, 0}, {{{0, 176, 0, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 3, 7, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 3, 7, 0}, {{{0, 153, 0, 0}}, 3, 12, 0}, {{{29, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 83}}, 4, 10, 0},
+	{{{1, 5, 0, 0}}, 3, 12, 0}, {{{0, 44, 0, 0}}, 4, 12, 0}, {{{16, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 38, 0}}, 4, 12, 0},
+	{{{83, 0, 0, 0}}, 1, 7, 0}, {{{0, 164, 0, 0}}, 4, 12, 0}, {{{7, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{178, 0, 0, 0}}, 4, 12, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 18, 0}}, 4, 10, 0},
+	{{{190, 0, 0, 0}}, 4, 12, 0}, {{{0, 34, 0, 0}}, 4, 12, 0}, {{{5, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 0, 0}}, 3, 3, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 65, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 1, 7, 0}, {{{0, 0, 4, 0}}, 4, 9, 0},
+	{{{219, 0, 0, 0}}, 1, 12, 0}, {{{0, 81, 0, 0}}, 2, 12, 0}, {{{79, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 2, 6, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 128, 0}}, 4, 8, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 2, 6, 0}, {{{148, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 20}}, 4, 11, 0},
+	{{{1, 1, 0, 0}}, 4, 10, 0}, {{{0, 8, 0, 0}}, 2, 6, 0}, {{{204, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 2, 0}}, 4, 8, 0},
+	{{{67, 0, 0, 0}}, 3, 12, 0}, {{{0, 148, 0, 0}}, 4, 9, 0}, {{{13, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{24, 0, 0, 0}}, 4, 10, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{255, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 8, 0}}, 4, 8, 0},
+	{{{73, 0, 0, 0}}, 4, 11, 0}, {{{0, 30, 0, 0}}, 4, 11, 0}, {{{169, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 12}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 9, 0, 0}}, 4, 10, 0}, {{{242, 0, 0, 0}}, 1, 12, 0}, {{{0, 0, 29, 0}}, 4, 10, 0},
+	{{{158, 0, 0, 0}}, 4, 12, 0}, {{{0, 13, 0, 0}}, 4, 9, 0}, {{{4, 0, 0, 0}}, 1, 6, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 2, 6, 0}, {{{0, 173, 0, 0}}, 3, 12, 0}, {{{2, 0, 0, 0}}, 2, 6, 0}, {{{0, 0, 1, 0}}, 3, 6, 0},
+	{{{8, 0, 0, 0}}, 2, 6, 0}, {{{0, 156, 0, 0}}, 4, 12, 0}, {{{35, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 14}}, 4, 11, 0},
+	{{{1, 10, 0, 0}}, 3, 12, 0}, {{{0, 171, 0, 0}}, 3, 12, 0}, {{{75, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 16, 0}}, 4, 10, 0},
+	{{{32, 0, 0, 0}}, 4, 12, 0}, {{{0, 40, 0, 0}}, 4, 10, 0}, {{{48, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{176, 0, 0, 0}}, 4, 11, 0}, {{{0, 1, 0, 0}}, 3, 6, 0}, {{{153, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 83, 0}}, 4, 10, 0},
+	{{{44, 0, 0, 0}}, 4, 12, 0}, {{{0, 38, 0, 0}}, 4, 12, 0}, {{{164, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 0, 5}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 3, 6, 0}, {{{0, 18, 0, 0}}, 4, 10, 0}, {{{34, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 163, 0}}, 3, 12, 0},
+	{{{65, 0, 0, 0}}, 4, 12, 0}, {{{0, 4, 0, 0}}, 4, 9, 0}, {{{81, 0, 0, 0}}, 2, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 1, 5, 0}, {{{0, 128, 0, 0}}, 4, 8, 0}, {{{2, 0, 0, 0}}, 1, 5, 0}, {{{0, 0, 20, 0}}, 4, 11, 0},
+	{{{8, 0, 0, 0}}, 1, 5, 0}, {{{0, 2, 0, 0}}, 4, 8, 0}, {{{148, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 1}}, 4, 7, 0},
+	{{{1, 0, 0, 0}}, 1, 4, 0}, {{{0, 8, 0, 0}}, 4, 8, 0}, {{{30, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 12, 0}}, 4, 10, 0},
+	{{{9, 0, 0, 0}}, 4, 10, 0}, {{{0, 29, 0, 0}}, 4, 10, 0}, {{{13, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{173, 0, 0, 0}}, 3, 12, 0}, {{{0, 1, 0, 0}}, 2, 5, 0}, {{{156, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 14, 0}}, 4, 11, 0},
+	{{{171, 0, 0, 0}}, 3, 12, 0}, {{{0, 16, 0, 0}}, 4, 10, 0}, {{{40, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 10}}, 4, 10, 0},
+	{{{1, 0, 0, 0}}, 2, 5, 0}, {{{0, 83, 0, 0}}, 4, 10, 0}, {{{38, 0, 0, 0}}, 4, 12, 0}, {{{0, 0, 5, 0}}, 4, 10, 0},
+	{{{18, 0, 0, 0}}, 4, 10, 0}, {{{0, 163, 0, 0}}, 3, 12, 0}, {{{4, 0, 0, 0}}, 4, 9, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{128, 0, 0, 0}}, 4, 8, 0}, {{{0, 20, 0, 0}}, 4, 11, 0}, {{{2, 0, 0, 0}}, 4, 8, 0}, {{{0, 0, 1, 0}}, 4, 7, 0},
+	{{{8, 0, 0, 0}}, 4, 8, 0}, {{{0, 12, 0, 0}}, 4, 10, 0}, {{{29, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 142}}, 4, 12, 0},
+	{{{1, 11, 0, 0}}, 2, 12, 0}, {{{0, 14, 0, 0}}, 4, 11, 0}, {{{16, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 10, 0}}, 4, 10, 0},
+	{{{83, 0, 0, 0}}, 4, 10, 0}, {{{0, 5, 0, 0}}, 4, 10, 0}, {{{163, 0, 0, 0}}, 3, 12, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+	{{{20, 0, 0, 0}}, 4, 11, 0}, {{{0, 1, 0, 0}}, 4, 7, 0}, {{{12, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 142, 0}}, 4, 12, 0},
+	{{{14, 0, 0, 0}}, 4, 11, 0}, {{{0, 10, 0, 0}}, 4, 10, 0}, {{{5, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 0, 11}}, 4, 11, 0},
+	{{{1, 0, 0, 0}}, 4, 7, 0}, {{{0, 142, 0, 0}}, 4, 12, 0}, {{{10, 0, 0, 0}}, 4, 10, 0}, {{{0, 0, 11, 0}}, 4, 11, 0},
+	{{{142, 0, 0, 0}}, 4, 12, 0}, {{{0, 11, 0, 0}}, 4, 11, 0}, {{{11, 0, 0, 0}}, 4, 11, 0}, {{{0, 0, 0, 0}}, 4, 4, 0},
+};
+
+static const HuffmanSubEntry MULTI_SUBTABLES[] = {
+	{218, 13}, {123, 13}, {122, 13}, {99, 13}, {249, 13}, {247, 13}, {96, 13}, {95, 13},
+	{231, 13}, {220, 13}, {108, 14}, {250, 13}, {126, 14}, {250, 13}, {124, 13}, {117, 13},
+	{62, 13}, {252, 13}, {105, 13}, {104, 13}, {54, 13}, {118, 14}, {54, 13}, {240, 14},
+	{241, 13}, {127, 13}, {94, 13}, {228, 13}, {111, 13}, {98, 13}, {233, 13}, {226, 13},
+	{90, 13}, {256, 15}, {90, 13}, {248, 14}, {90, 13}, {119, 15}, {90, 13}, {248, 14},
+	{107, 13}, {106, 13}, {236, 13}, {60, 13}, {112, 13}, {92, 13}, {120, 13}, {110, 13},
+	{103, 13}, {102, 13},
+};
@@ -1,5 +1,6 @@
 #include <ddnet_protocol/int_string.h>
 
+#include <ddnet_protocol/common.h>
 #include <ddnet_protocol/errors.h>
 
 size_t ddproto_str_length(const char *str) {
@@ -10,44 +11,242 @@ size_t ddproto_str_length(const char *str) {
 	return len;
 }
 
+// ASCII is checked this many bytes at a time. The compiler turns the vector
+// type into SSE2, AVX2 or NEON instructions if the target has them and into
+// plain integer code otherwise
+#ifdef __AVX2__
+#define UTF8_VECTOR_SIZE 32
+#else
+#define UTF8_VECTOR_SIZE 16
+#endif
+
+typedef uint64_t Utf8VectorWords __attribute__((vector_size(UTF8_VECTOR_SIZE)));
+
+// pure ASCII is skipped this many vectors at a time
+#define UTF8_VECTORS_PER_BLOCK 4
+#define UTF8_BLOCK_SIZE (UTF8_VECTOR_SIZE * UTF8_VECTORS_PER_BLOCK)
+
+// true if none of the bytes of the block at `str` has the high bit set
+static bool utf8_block_is_ascii(const uint8_t *str) {
+	Utf8VectorWords any = {0};
+	for(size_t i = 0; i < UTF8_VECTORS_PER_BLOCK; i++) {
+		Utf8VectorWords words;
+		memcpy(&words, str + i * UTF8_VECTOR_SIZE, sizeof(words));
+		any |= words;
+	}
+	any &= 0x8080808080808080;
+	uint64_t high_bits = 0;
+	for(size_t i = 0; i < UTF8_VECTOR_SIZE / sizeof(uint64_t); i++) {
+		high_bits |= any[i];
+	}
+	return !high_bits;
+}
+
+// length of the sequence at the start of `str` or 0 if it is invalid
+static size_t utf8_sequence_len(const uint8_t *str, size_t len) {
+	const uint8_t lead = str[0];
+	if(lead < 0x80) {
+		return 1;
+	}
+
+	// the second byte has a narrower range after some lead bytes. That
+	// rejects overlong encodings, surrogates and code points above U+10FFFF
+	uint8_t min = 0x80;
+	uint8_t max = 0xbf;
+	size_t size;
+	if(lead >= 0xc2 && lead <= 0xdf) {
+		size = 2;
+	} else if(lead >= 0xe0 && lead <= 0xef) {
+		size = 3;
+		if(lead == 0xe0) {
+			min = 0xa0;
+		} else if(lead == 0xed) {
+			max = 0x9f;
+		}
+	} else if(lead >= 0xf0 && lead <= 0xf4) {
+		size = 4;
+		if(lead == 0xf0) {
+			min = 0x90;
+		} else if(lead == 0xf4) {
+			max = 0x8f;
+		}
+	} else {
+		return 0;
+	}
+
+	if(len < size || str[1] < min || str[1] > max) {
+		return 0;
+	}
+	for(size_t i = 2; i < size; i++) {
+		if((str[i] & 0xc0) != 0x80) {
+			return 0;
+		}
+	}
+	return size;
+}
+
+bool ddproto_str_is_utf8(const char *str, size_t len) {
+	const uint8_t *bytes = (const uint8_t *)str;
+	size_t i = 0;
+	while(i + UTF8_BLOCK_SIZE <= len) {
+		if(utf8_block_is_ascii(bytes + i)) {
+			i += UTF8_BLOCK_SIZE;
+			continue;
+		}
+		// the last sequence may end behind the block
+		const size_t block_end = i + UTF8_BLOCK_SIZE;
+		while(i < block_end) {
+			const size_t size = utf8_sequence_len(bytes + i, len - i);
+			if(!size) {
+				return false;
+			}
+			i += size;
+		}
+	}
+
+	// the last block overlaps the bytes that were already checked
+	if(len >= UTF8_BLOCK_SIZE && utf8_block_is_ascii(bytes + len - UTF8_BLOCK_SIZE)) {
+		return true;
+	}
+	while(i < len) {
+		uint64_t word;
+		if(i + sizeof(word) <= len) {
+			memcpy(&word, bytes + i, sizeof(word));
+			if(!(word & 0x8080808080808080)) {
+				i += sizeof(word);
+				continue;
+			}
+		}
+		const size_t size = utf8_sequence_len(bytes + i, len - i);
+		if(!size) {
+			return false;
+		}
+		i += size;
+	}
+	return true;
+}
+
+// the characters are stored from the most to the least significant byte of
+// the integers and offset by 128. Converting swaps the bytes of every integer
+// on little endian targets and flips their high bit. It is its own inverse so
+// it converts both ways
+typedef uint32_t IntStringVector __attribute__((vector_size(16)));
+
+#define INT_STRING_VECTOR_INTS (sizeof(IntStringVector) / sizeof(uint32_t))
+
+// fits the longest string of the snapshot items, the skin
+#define INT_STRING_CHUNK_INTS 8
+
+static IntStringVector string_ints_convert(IntStringVector ints) {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+	ints = (ints >> 24) | ((ints >> 8) & 0xff00) | ((ints & 0xff00) << 8) | (ints << 24);
+#endif
+	return ints ^ 0x80808080;
+}
+
+static uint32_t string_int_convert(uint32_t value) {
+#if !defined(__BYTE_ORDER__) || __BYTE_ORDER__ != __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap32(value);
+#endif
+	return value ^ 0x80808080;
+}
+
+// converts `num_ints` integers from `src` into `dst`
+static void string_ints_convert_n(uint8_t *dst, const uint8_t *src, size_t num_ints) {
+	size_t i = 0;
+	for(; i + INT_STRING_VECTOR_INTS <= num_ints; i += INT_STRING_VECTOR_INTS) {
+		IntStringVector ints;
+		memcpy(&ints, src + i * sizeof(uint32_t), sizeof(ints));
+		ints = string_ints_convert(ints);
+		memcpy(dst + i * sizeof(uint32_t), &ints, sizeof(ints));
+	}
+	for(; i < num_ints; i++) {
+		uint32_t value;
+		memcpy(&value, src + i * sizeof(uint32_t), sizeof(value));
+		value = string_int_convert(value);
+		memcpy(dst + i * sizeof(uint32_t), &value, sizeof(value));
+	}
+}
+
 DDProtoError ddproto_ints_to_str(const uint32_t *ints, size_t num_ints, char *str, size_t str_len) {
 	if(str_len < num_ints * sizeof(uint32_t)) {
 		return DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
 	}
 
 	// unpack string without validation
-	size_t str_index = 0;
-	for(size_t i = 0; i < num_ints; i++) {
-		const uint32_t current_int = ints[i];
-		str[str_index++] = (char)(((current_int >> 24) & 0xff) - 128);
-		str[str_index++] = (char)(((current_int >> 16) & 0xff) - 128);
-		str[str_index++] = (char)(((current_int >> 8) & 0xff) - 128);
-		str[str_index++] = (char)((current_int & 0xff) - 128);
-	}
+	string_ints_convert_n((uint8_t *)str, (const uint8_t *)ints, num_ints);
 	// ensure null-termination
-	str[str_index - 1] = '\0';
+	str[num_ints * sizeof(uint32_t) - 1] = '\0';
+
+	return DDPROTO_ERR_NONE;
+}
+
+DDProtoError ddproto_ints_to_str_utf8(const uint32_t *ints, size_t num_ints, char *str, size_t str_len) {
+	const DDProtoError err = ddproto_ints_to_str(ints, num_ints, str, str_len);
+	if(err != DDPROTO_ERR_NONE) {
+		return err;
+	}
+	if(!ddproto_str_is_utf8(str, strlen(str))) {
+		str[0] = '\0';
+		return DDPROTO_ERR_INVALID_UTF8;
+	}
+	return DDPROTO_ERR_NONE;
+}
+
+DDProtoError ddproto_unpacker_get_int_string(DDProtoUnpacker *unpacker, size_t num_ints, char *str, size_t str_len) {
+	if(str_len < num_ints * sizeof(uint32_t)) {
+		return DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
+	}
 
-	// TODO: check valid utf8
+	// the integers are unpacked a few at a time and converted right away.
+	// They are converted one by one because loading a vector right after
+	// the integers were stored separately stalls the CPU
+	size_t i = 0;
+	while(i < num_ints) {
+		size_t num = num_ints - i;
+		if(num > INT_STRING_CHUNK_INTS) {
+			num = INT_STRING_CHUNK_INTS;
+		}
+		uint32_t ints[INT_STRING_CHUNK_INTS];
+		if(ddproto_unpacker_get_ints(unpacker, (int32_t *)ints, num) != DDPROTO_ERR_NONE) {
+			str[0] = '\0';
+			return unpacker->err;
+		}
+		for(size_t k = 0; k < num; k++, i++) {
+			const uint32_t value = string_int_convert(ints[k]);
+			memcpy(str + i * sizeof(uint32_t), &value, sizeof(value));
+		}
+	}
+	str[num_ints * sizeof(uint32_t) - 1] = '\0';
+
+	if(unpacker->options->validate_utf8 && !ddproto_str_is_utf8(str, strlen(str))) {
+		str[0] = '\0';
+		unpacker->err = DDPROTO_ERR_INVALID_UTF8;
+		return unpacker->err;
+	}
 	return DDPROTO_ERR_NONE;
 }
 
 DDProtoError ddproto_str_to_ints(uint32_t *ints, size_t num_ints, const char *str) {
-	const size_t str_len = ddproto_str_length(str);
+	const size_t str_len = strlen(str);
 	if(str_len > num_ints * sizeof(uint32_t)) {
 		return DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
 	}
 
 	for(size_t i = 0; i < num_ints; i++) {
-		// copy to temporary buffer to ensure we don't read past the end of the
-		// input string
-		char buf[sizeof(uint32_t)] = {0, 0, 0, 0};
-		for(size_t buf_idx = 0; buf_idx < sizeof(uint32_t) && (i * sizeof(uint32_t)) + buf_idx < str_len; buf_idx++) {
-			buf[buf_idx] = str[(i * sizeof(uint32_t)) + buf_idx];
-		}
-		ints[i] = ((uint32_t)(buf[0] + 128) << 24) |
-			  ((buf[1] + 128) << 16) |
-			  ((buf[2] + 128) << 8) |
-			  (buf[3] + 128);
+		// the part of the string behind its end is padded with zeros
+		const size_t offset = i * sizeof(uint32_t);
+		uint8_t buf[sizeof(uint32_t)] = {0, 0, 0, 0};
+		if(offset + sizeof(buf) <= str_len) {
+			memcpy(buf, str + offset, sizeof(buf));
+		} else {
+			for(size_t buf_idx = 0; offset + buf_idx < str_len; buf_idx++) {
+				buf[buf_idx] = str[offset + buf_idx];
+			}
+		}
+		uint32_t value;
+		memcpy(&value, buf, sizeof(value));
+		ints[i] = string_int_convert(value);
 	}
 	// last byte is always zero and unused in this format
 	ints[num_ints - 1] &= 0xffffff00;
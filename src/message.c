@@ -4,452 +4,410 @@
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/msg_system.h>
 #include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/packet.h>
 #include <ddnet_protocol/snapshot.h>
 #include <ddnet_protocol/version.h>
 
-static DDProtoError decode_game_message(DDProtoChunk *chunk, DDProtoMessageId msg_id, DDProtoUnpacker *unpacker) {
-	DDProtoGenericMessage *msg = &chunk->payload.msg;
-	switch(msg_id) {
-	case DDPROTO_MSG_SV_MOTD:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_MOTD;
-		msg->motd.message = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_SV_BROADCAST:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_BROADCAST;
-		msg->broadcast.message = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_SV_CHAT:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_CHAT;
-		msg->chat.team = ddproto_unpacker_get_int(unpacker);
-		msg->chat.client_id = ddproto_unpacker_get_int(unpacker);
-		msg->chat.message = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_SV_KILLMSG:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_KILLMSG;
-		msg->kill_msg.killer_id = ddproto_unpacker_get_int(unpacker);
-		msg->kill_msg.victim_id = ddproto_unpacker_get_int(unpacker);
-		msg->kill_msg.weapon = ddproto_unpacker_get_int(unpacker);
-		msg->kill_msg.mode_special = ddproto_unpacker_get_int(unpacker);
-		break;
-	case DDPROTO_MSG_SV_SOUNDGLOBAL:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_SOUNDGLOBAL;
-		msg->sound_global.sound_id = ddproto_unpacker_get_int(unpacker);
-		break;
-	case DDPROTO_MSG_SV_TUNEPARAMS:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_TUNEPARAMS;
-		msg->tune_params.ground_control_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.ground_control_accel = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.ground_friction = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.ground_jump_impulse = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.air_jump_impulse = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.air_control_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.air_control_accel = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.air_friction = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.hook_length = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.hook_fire_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.hook_drag_accel = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.hook_drag_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.gravity = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.velramp_start = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.velramp_range = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.velramp_curvature = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.gun_curvature = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.gun_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.gun_lifetime = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.shotgun_curvature = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.shotgun_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.shotgun_speeddiff = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.shotgun_lifetime = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.grenade_curvature = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.grenade_speed = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.grenade_lifetime = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.laser_reach = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.laser_bounce_delay = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.laser_bounce_num = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.laser_bounce_cost = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.laser_damage = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.player_collision = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		msg->tune_params.player_hooking = (float)ddproto_unpacker_get_int(unpacker) / 100;
-		break;
-	case DDPROTO_MSG_SV_READYTOENTER:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_READYTOENTER;
-		break;
-	case DDPROTO_MSG_SV_WEAPONPICKUP:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_WEAPONPICKUP;
-		msg->weapon_pickup.weapon = ddproto_unpacker_get_int(unpacker);
-		break;
-	case DDPROTO_MSG_SV_EMOTICON:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_EMOTICON;
-		msg->emoticon.client_id = ddproto_unpacker_get_int(unpacker);
-		msg->emoticon.emoticon = ddproto_unpacker_get_int(unpacker);
-		break;
-	case DDPROTO_MSG_SV_VOTECLEAROPTIONS:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_VOTECLEAROPTIONS;
-		break;
-	case DDPROTO_MSG_SV_VOTEOPTIONLISTADD:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_VOTEOPTIONLISTADD;
-		msg->vote_option_list_add.num_options = ddproto_unpacker_get_int(unpacker);
-		memset((void *)msg->vote_option_list_add.descriptions, 0, sizeof(msg->vote_option_list_add.descriptions));
-		for(int32_t i = 0; i < msg->vote_option_list_add.num_options; i++) {
-			msg->vote_option_list_add.descriptions[i] = ddproto_unpacker_get_string(unpacker);
-		}
-		break;
-	case DDPROTO_MSG_SV_VOTEOPTIONADD:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_VOTEOPTIONADD;
-		msg->vote_option_add.description = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_SV_VOTEOPTIONREMOVE:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_VOTEOPTIONREMOVE;
-		msg->vote_option_remove.description = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_SV_VOTESET:
-		chunk->payload.kind = DDPROTO_MSG_KIND_SV_VOTESET;
-		msg->vote_set.timeout = ddproto_unpacker_get_int(unpacker);
-		msg->vote_set.description = ddproto_unpacker_get_string(unpacker);
-		msg->vote_set.reason = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_CL_SAY:
-		chunk->payload.kind = DDPROTO_MSG_KIND_CL_SAY;
-		msg->say.team = ddproto_unpacker_get_int(unpacker);
-		msg->say.message = ddproto_unpacker_get_string(unpacker);
-		break;
-	case DDPROTO_MSG_CL_STARTINFO:
-		chunk->payload.kind = DDPROTO_MSG_KIND_CL_STARTINFO;
-		msg->start_info.name = ddproto_unpacker_get_string(unpacker);
-		msg->start_info.clan = ddproto_unpacker_get_string(unpacker);
-		msg->start_info.country = ddproto_unpacker_get_int(unpacker);
-		msg->start_info.skin = ddproto_unpacker_get_string(unpacker);
-		msg->start_info.use_custom_color = ddproto_unpacker_get_bool(unpacker);
-		msg->start_info.color_body = ddproto_unpacker_get_int(unpacker);
-		msg->start_info.color_feet = ddproto_unpacker_get_int(unpacker);
-		break;
-	default:
-		return DDPROTO_ERR_UNKNOWN_MESSAGE;
+#include "message_schema.h"
+
+// a teeworlds varint of an int32_t takes at most this many bytes
+#define VARINT_MAX_SIZE 5
+
+// packed size of `value` as teeworlds varint
+static size_t varint_size(int32_t value) {
+	return ddproto_packer_ints_size(&value, 1);
+}
+
+// packed size of `value` including the null terminator
+static size_t string_size(const char *value) {
+	return strlen(value) + 1;
+}
+
+// reads `num` strings, the remaining entries of `strings` are set to NULL
+static void unpack_string_array(DDProtoUnpacker *unpacker, const char **strings, size_t capacity, int32_t num) {
+	for(size_t i = 0; i < capacity; i++) {
+		strings[i] = (int32_t)i < num ? ddproto_unpacker_get_string(unpacker) : NULL;
 	}
+}
 
-	return unpacker->err;
+// every entry is sent, the ones after the first `num` as empty strings
+static void pack_string_array(DDProtoPacker *packer, const char *const *strings, size_t capacity, int32_t num) {
+	for(size_t i = 0; i < capacity; i++) {
+		ddproto_packer_add_string(packer, (int32_t)i < num ? strings[i] : "");
+	}
 }
 
-static DDProtoError decode_system_message(DDProtoChunk *chunk, DDProtoMessageId msg_id, DDProtoUnpacker *unpacker) {
-	DDProtoGenericMessage *msg = &chunk->payload.msg;
-	switch(msg_id) {
-	case DDPROTO_MSG_INFO:
-		msg->info.version = ddproto_unpacker_get_string(unpacker);
-		msg->info.password = ddproto_unpacker_get_string(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_INFO;
-		break;
-	case DDPROTO_MSG_MAP_CHANGE:
-		msg->map_change.name = ddproto_unpacker_get_string(unpacker);
-		msg->map_change.crc = ddproto_unpacker_get_int(unpacker);
-		msg->map_change.size = ddproto_unpacker_get_int(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_MAP_CHANGE;
-		break;
-	case DDPROTO_MSG_MAP_DATA:
-		msg->map_data.last = ddproto_unpacker_get_bool(unpacker);
-		msg->map_data.map_crc = ddproto_unpacker_get_int(unpacker);
-		msg->map_data.chunk = ddproto_unpacker_get_int(unpacker);
-		msg->map_data.chunk_size = ddproto_unpacker_get_int(unpacker);
-		msg->map_data.data = ddproto_unpacker_get_raw(unpacker, msg->map_data.chunk_size);
-		chunk->payload.kind = DDPROTO_MSG_KIND_MAP_CHANGE;
-		break;
-	case DDPROTO_MSG_SNAPSINGLE:
-		msg->snap_single.game_tick = ddproto_unpacker_get_int(unpacker);
-		msg->snap_single.delta_tick = ddproto_unpacker_get_int(unpacker);
-		msg->snap_single.crc = ddproto_unpacker_get_int(unpacker);
-		msg->snap_single.part_size = ddproto_unpacker_get_int(unpacker);
-		DDProtoError err = ddproto_decode_snapshot(unpacker, &msg->snap_single.snapshot);
-		if(err != DDPROTO_ERR_NONE) {
-			return err;
-		}
-		chunk->payload.kind = DDPROTO_MSG_KIND_SNAPSINGLE;
-		break;
-	case DDPROTO_MSG_CON_READY:
-		chunk->payload.kind = DDPROTO_MSG_KIND_CON_READY;
-		break;
-	case DDPROTO_MSG_INPUTTIMING:
-		msg->input_timing.intended_tick = ddproto_unpacker_get_int(unpacker);
-		msg->input_timing.time_left = ddproto_unpacker_get_int(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_INPUTTIMING;
-		break;
-	case DDPROTO_MSG_RCON_AUTH_STATUS:
-		msg->rcon_auth_status.authed = ddproto_unpacker_get_bool(unpacker);
-		msg->rcon_auth_status.cmdlist = ddproto_unpacker_get_bool(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_AUTH_STATUS;
-		break;
-	case DDPROTO_MSG_RCON_LINE:
-		msg->rcon_line.line = ddproto_unpacker_get_string(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_LINE;
-		break;
-	case DDPROTO_MSG_READY:
-		chunk->payload.kind = DDPROTO_MSG_KIND_READY;
-		break;
-	case DDPROTO_MSG_ENTERGAME:
-		chunk->payload.kind = DDPROTO_MSG_KIND_ENTERGAME;
-		break;
-	case DDPROTO_MSG_INPUT:
-		msg->input.ack_game_tick = ddproto_unpacker_get_int(unpacker);
-		msg->input.prediction_tick = ddproto_unpacker_get_int(unpacker);
-		msg->input.size = ddproto_unpacker_get_int(unpacker);
-		msg->input.direction = ddproto_unpacker_get_int(unpacker);
-		msg->input.target_x = ddproto_unpacker_get_int(unpacker);
-		msg->input.target_y = ddproto_unpacker_get_int(unpacker);
-		msg->input.jump = ddproto_unpacker_get_int(unpacker);
-		msg->input.fire = ddproto_unpacker_get_int(unpacker);
-		msg->input.hook = ddproto_unpacker_get_int(unpacker);
-		msg->input.player_flags = ddproto_unpacker_get_int(unpacker);
-		msg->input.wanted_weapon = ddproto_unpacker_get_int(unpacker);
-		msg->input.next_weapon = ddproto_unpacker_get_int(unpacker);
-		msg->input.prev_weapon = ddproto_unpacker_get_int(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_INPUT;
-		break;
-	case DDPROTO_MSG_RCON_CMD:
-		msg->rcon_cmd.command = ddproto_unpacker_get_string(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_CMD;
-		break;
-	case DDPROTO_MSG_RCON_AUTH:
-		msg->rcon_auth.name = ddproto_unpacker_get_string(unpacker);
-		msg->rcon_auth.password = ddproto_unpacker_get_string(unpacker);
-		msg->rcon_auth.send_rcon_cmds = ddproto_unpacker_get_bool(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_AUTH;
-		break;
-	case DDPROTO_MSG_REQUEST_MAP_DATA:
-		msg->request_map_data.chunk = ddproto_unpacker_get_int(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_REQUEST_MAP_DATA;
-		break;
-	case DDPROTO_MSG_RCON_CMD_ADD:
-		msg->rcon_cmd_add.name = ddproto_unpacker_get_string(unpacker);
-		msg->rcon_cmd_add.help = ddproto_unpacker_get_string(unpacker);
-		msg->rcon_cmd_add.params = ddproto_unpacker_get_string(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_CMD_ADD;
-		break;
-	case DDPROTO_MSG_RCON_CMD_REM:
-		msg->rcon_cmd_rem.name = ddproto_unpacker_get_string(unpacker);
-		chunk->payload.kind = DDPROTO_MSG_KIND_RCON_CMD_REM;
-		break;
-	default:
-		return DDPROTO_ERR_UNKNOWN_MESSAGE;
+static size_t string_array_size(const char *const *strings, size_t capacity, int32_t num) {
+	size_t size = 0;
+	for(size_t i = 0; i < capacity; i++) {
+		size += (int32_t)i < num ? string_size(strings[i]) : 1;
+	}
+	return size;
+}
+
+// the tune params are sent as fixed point integers. They are the message with
+// the most of them
+enum {
+	TUNE_PARAMS_NUM = sizeof(DDProtoMsgSvTuneParams) / sizeof(float),
+};
+
+static void unpack_fixed_points(DDProtoUnpacker *unpacker, float *values, size_t num) {
+	int32_t fixed_points[TUNE_PARAMS_NUM];
+	ddproto_unpacker_get_ints(unpacker, fixed_points, num);
+	for(size_t i = 0; i < num; i++) {
+		values[i] = (float)fixed_points[i] / 100;
+	}
+}
+
+static void to_fixed_points(const float *values, int32_t *fixed_points, size_t num) {
+	for(size_t i = 0; i < num; i++) {
+		fixed_points[i] = (int32_t)(values[i] * 100);
+	}
+}
+
+static void pack_fixed_points(DDProtoPacker *packer, const float *values, size_t num) {
+	int32_t fixed_points[TUNE_PARAMS_NUM];
+	to_fixed_points(values, fixed_points, num);
+	ddproto_packer_add_ints(packer, fixed_points, num);
+}
+
+static size_t fixed_points_size(const float *values, size_t num) {
+	int32_t fixed_points[TUNE_PARAMS_NUM];
+	to_fixed_points(values, fixed_points, num);
+	return ddproto_packer_ints_size(fixed_points, num);
+}
+
+#define ARRAY_LEN(array) (sizeof(array) / sizeof((array)[0]))
+
+// decode_NAME fills the struct of the message from `unpacker`
+#define INT(field) m->field = ddproto_unpacker_get_int(unpacker);
+#define BOOL(field) m->field = ddproto_unpacker_get_bool(unpacker);
+#define STRING(field) m->field = ddproto_unpacker_get_string(unpacker);
+#define STRING_LEN(field) m->field = ddproto_unpacker_get_string_len(unpacker, &m->field##_len);
+#define STRING_ARRAY(field, num) unpack_string_array(unpacker, m->field, ARRAY_LEN(m->field), m->num);
+#define RAW(field, len) m->field = ddproto_unpacker_get_raw(unpacker, m->len);
+#define INTS(Type) ddproto_unpacker_get_ints(unpacker, (int32_t *)m, sizeof(Type) / sizeof(int32_t));
+#define FIXED_POINTS(Type) unpack_fixed_points(unpacker, (float *)m, sizeof(Type) / sizeof(float));
+#define SNAPSHOT(field) \
+	{ \
+		DDProtoError err = ddproto_decode_snapshot(unpacker, &m->field); \
+		if(err != DDPROTO_ERR_NONE) { \
+			return err; \
+		} \
+	}
+#define CONST_STRING(value)
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) \
+	static DDProtoError decode_##NAME(DDProtoGenericMessage *msg, DDProtoUnpacker *unpacker) { \
+		Type *m = &msg->member; \
+		FIELDS \
+		return unpacker->err; \
+	}
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS) \
+	static DDProtoError decode_##NAME(DDProtoGenericMessage *msg, DDProtoUnpacker *unpacker) { \
+		(void)msg; \
+		FIELDS \
+		return unpacker->err; \
+	}
+DDPROTO_MESSAGES(MSG, MSG, EMPTY)
+#undef INT
+#undef BOOL
+#undef STRING
+#undef STRING_LEN
+#undef STRING_ARRAY
+#undef RAW
+#undef INTS
+#undef FIXED_POINTS
+#undef SNAPSHOT
+#undef CONST_STRING
+#undef MSG
+#undef EMPTY
+
+// encode_NAME packs the struct of the message after the message id
+#define INT(field) ddproto_packer_add_int(packer, (int32_t)m->field);
+#define BOOL(field) ddproto_packer_add_int(packer, m->field);
+#define STRING(field) ddproto_packer_add_string(packer, m->field);
+#define STRING_LEN(field) ddproto_packer_add_string(packer, m->field);
+#define STRING_ARRAY(field, num) pack_string_array(packer, m->field, ARRAY_LEN(m->field), m->num);
+#define RAW(field, len) ddproto_packer_add_raw(packer, m->field, m->len);
+#define INTS(Type) ddproto_packer_add_ints(packer, (const int32_t *)m, sizeof(Type) / sizeof(int32_t));
+#define FIXED_POINTS(Type) pack_fixed_points(packer, (const float *)m, sizeof(Type) / sizeof(float));
+#define SNAPSHOT(field) return DDPROTO_ERR_UNKNOWN_MESSAGE;
+#define CONST_STRING(value) ddproto_packer_add_string_len(packer, value, sizeof(value) - 1);
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) \
+	static DDProtoError encode_##NAME(const DDProtoGenericMessage *msg, DDProtoPacker *packer) { \
+		const Type *m = &msg->member; \
+		FIELDS \
+		return packer->err; \
 	}
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS) \
+	static DDProtoError encode_##NAME(const DDProtoGenericMessage *msg, DDProtoPacker *packer) { \
+		(void)msg; \
+		FIELDS \
+		return packer->err; \
+	}
+DDPROTO_MESSAGES(MSG, MSG, EMPTY)
+#undef INT
+#undef BOOL
+#undef STRING
+#undef STRING_LEN
+#undef STRING_ARRAY
+#undef RAW
+#undef INTS
+#undef FIXED_POINTS
+#undef SNAPSHOT
+#undef CONST_STRING
+#undef MSG
+#undef EMPTY
+
+// size_NAME returns the amount of bytes encode_NAME packs
+#define INT(field) size += varint_size((int32_t)m->field);
+#define BOOL(field) size += varint_size(m->field);
+#define STRING(field) size += string_size(m->field);
+#define STRING_LEN(field) size += string_size(m->field);
+#define STRING_ARRAY(field, num) size += string_array_size(m->field, ARRAY_LEN(m->field), m->num);
+#define RAW(field, len) size += m->len;
+#define INTS(Type) size += ddproto_packer_ints_size((const int32_t *)m, sizeof(Type) / sizeof(int32_t));
+#define FIXED_POINTS(Type) size += fixed_points_size((const float *)m, sizeof(Type) / sizeof(float));
+#define SNAPSHOT(field) \
+	*err = DDPROTO_ERR_UNKNOWN_MESSAGE; \
+	return 0;
+#define CONST_STRING(value) size += sizeof(value);
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) \
+	static size_t size_##NAME(const DDProtoGenericMessage *msg, DDProtoError *err) { \
+		(void)err; \
+		const Type *m = &msg->member; \
+		size_t size = 0; \
+		FIELDS \
+		return size; \
+	}
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS) \
+	static size_t size_##NAME(const DDProtoGenericMessage *msg, DDProtoError *err) { \
+		(void)msg; \
+		(void)err; \
+		size_t size = 0; \
+		FIELDS \
+		return size; \
+	}
+DDPROTO_MESSAGES(MSG, MSG, EMPTY)
+#undef INT
+#undef BOOL
+#undef STRING
+#undef STRING_LEN
+#undef STRING_ARRAY
+#undef RAW
+#undef INTS
+#undef FIXED_POINTS
+#undef SNAPSHOT
+#undef CONST_STRING
+#undef MSG
+#undef EMPTY
+
+typedef struct {
+	DDProtoMessageId id;
+	DDProtoMessageCategory category;
+
+	// upper bound of the encoded size including the message id
+	size_t max_size;
+
+	DDProtoError (*decode)(DDProtoGenericMessage *msg, DDProtoUnpacker *unpacker);
+	DDProtoError (*encode)(const DDProtoGenericMessage *msg, DDProtoPacker *packer);
+	size_t (*size)(const DDProtoGenericMessage *msg, DDProtoError *err);
+} MessageCodec;
+
+// strings and raw data are only bounded by the size of a packet
+#define INT(field) +VARINT_MAX_SIZE
+#define BOOL(field) +1
+#define STRING(field) +DDPROTO_MAX_PACKET_SIZE
+#define STRING_LEN(field) +DDPROTO_MAX_PACKET_SIZE
+#define STRING_ARRAY(field, num) +DDPROTO_MAX_PACKET_SIZE
+#define RAW(field, len) +DDPROTO_MAX_PACKET_SIZE
+#define INTS(Type) +sizeof(Type) / sizeof(int32_t) * VARINT_MAX_SIZE
+#define FIXED_POINTS(Type) +sizeof(Type) / sizeof(float) * VARINT_MAX_SIZE
+#define SNAPSHOT(field) +DDPROTO_MAX_PACKET_SIZE
+#define CONST_STRING(value) +sizeof(value)
+#define MAX_SIZE(size) ((size) < DDPROTO_MAX_PACKET_SIZE ? (size) : DDPROTO_MAX_PACKET_SIZE)
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) \
+	[DDPROTO_MSG_KIND_##NAME] = {DDPROTO_MSG_##NAME, DDPROTO_##CATEGORY, MAX_SIZE(1 FIELDS), decode_##NAME, encode_##NAME, size_##NAME},
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS) \
+	[DDPROTO_MSG_KIND_##NAME] = {DDPROTO_MSG_##NAME, DDPROTO_##CATEGORY, MAX_SIZE(1 FIELDS), decode_##NAME, encode_##NAME, size_##NAME},
+// indexed by DDProtoMessageKind, the entry of DDPROTO_MSG_KIND_UNKNOWN is empty
+static const MessageCodec CODECS[] = {
+	DDPROTO_MESSAGES(MSG, MSG, EMPTY)};
+#undef MSG
+#undef EMPTY
+
+// message ids are smaller than this
+#define MAX_MSG_ID 32
+
+#define MSG(NAME, CATEGORY, VITAL, ...) [DDPROTO_##CATEGORY][DDPROTO_MSG_##NAME] = DDPROTO_MSG_KIND_##NAME,
+// indexed by DDProtoMessageCategory and DDProtoMessageId
+static const DDProtoMessageKind KINDS[2][MAX_MSG_ID] = {
+	DDPROTO_MESSAGES(MSG, MSG, MSG)};
+#undef MSG
+
+#undef INT
+#undef BOOL
+#undef STRING
+#undef STRING_LEN
+#undef STRING_ARRAY
+#undef RAW
+#undef INTS
+#undef FIXED_POINTS
+#undef SNAPSHOT
+#undef CONST_STRING
+#undef MAX_SIZE
+
+// codec of `kind` or NULL if it can not be encoded or decoded
+static const MessageCodec *message_codec(DDProtoMessageKind kind) {
+	if(kind == DDPROTO_MSG_KIND_UNKNOWN || (size_t)kind >= ARRAY_LEN(CODECS)) {
+		return NULL;
+	}
+	return &CODECS[kind];
+}
+
+DDProtoMessageKind ddproto_message_kind(DDProtoMessageCategory category, DDProtoMessageId msg_id) {
+	if((uint32_t)category > DDPROTO_SYSTEM || (uint32_t)msg_id >= MAX_MSG_ID) {
+		return DDPROTO_MSG_KIND_UNKNOWN;
+	}
+	return KINDS[category][msg_id];
+}
 
-	return unpacker->err;
+size_t ddproto_message_max_size(DDProtoMessageKind kind) {
+	const MessageCodec *codec = message_codec(kind);
+	return codec ? codec->max_size : DDPROTO_MAX_PACKET_SIZE;
+}
+
+DDProtoError ddproto_unpack_message(DDProtoChunk *chunk, DDProtoUnpacker *unpacker) {
+	// unknown messages point to the whole chunk payload
+	const uint8_t *start = unpacker->buf;
+	int32_t msg_and_sys = ddproto_unpacker_get_int(unpacker);
+	DDProtoMessageKind kind = ddproto_message_kind(msg_and_sys & 1 ? DDPROTO_SYSTEM : DDPROTO_GAME, msg_and_sys >> 1);
+
+	// messages that are not in the mask are passed on like unknown ones
+	const uint64_t kinds = unpacker->options->kinds;
+	bool wanted = !kinds || (kinds & DDPROTO_MSG_KIND_BIT(kind));
+	DDProtoError err = DDPROTO_ERR_UNKNOWN_MESSAGE;
+	const MessageCodec *codec = message_codec(kind);
+	if(wanted && codec) {
+		chunk->payload.kind = kind;
+		err = codec->decode(&chunk->payload.msg, unpacker);
+	}
+
+	if(err == DDPROTO_ERR_UNKNOWN_MESSAGE) {
+		unpacker->buf = start;
+		chunk->payload.msg.unknown.len = chunk->header.size;
+		chunk->payload.msg.unknown.buf = ddproto_unpacker_get_raw(unpacker, chunk->header.size);
+		chunk->payload.kind = DDPROTO_MSG_KIND_UNKNOWN;
+	}
+
+	return wanted ? err : unpacker->err;
 }
 
 DDProtoError ddproto_decode_message(DDProtoChunk *chunk, const uint8_t *buf) {
 	DDProtoUnpacker unpacker;
 	ddproto_unpacker_init(&unpacker, buf, chunk->header.size);
+	return ddproto_unpack_message(chunk, &unpacker);
+}
+
+DDProtoMessageId ddproto_lazy_chunk_message_id(const DDProtoLazyChunk *chunk, DDProtoMessageCategory *category) {
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, chunk->payload, chunk->header.size);
 	int32_t msg_and_sys = ddproto_unpacker_get_int(&unpacker);
-	bool sys = msg_and_sys & 1;
-	DDProtoMessageId msg_id = msg_and_sys >> 1;
-
-	DDProtoError err = DDPROTO_ERR_NONE;
-	if(sys) {
-		err = decode_system_message(chunk, msg_id, &unpacker);
-	} else {
-		err = decode_game_message(chunk, msg_id, &unpacker);
+	*category = msg_and_sys & 1 ? DDPROTO_SYSTEM : DDPROTO_GAME;
+	return msg_and_sys >> 1;
+}
+
+DDProtoError ddproto_decode_lazy_chunk(const DDProtoLazyChunk *lazy, const DDProtoDecodeOptions *options, DDProtoChunk *chunk) {
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, lazy->payload, lazy->header.size);
+	DDProtoDecodeOptions lazy_options = options ? *options : *unpacker.options;
+	if(!lazy_options.strings) {
+		lazy_options.strings = lazy->strings;
 	}
+	unpacker.options = &lazy_options;
+	chunk->header = lazy->header;
+	return ddproto_unpack_message(chunk, &unpacker);
+}
 
-	if(err == DDPROTO_ERR_UNKNOWN_MESSAGE) {
-		chunk->payload.msg.unknown.len = chunk->header.size;
-		chunk->payload.msg.unknown.buf = buf;
-		chunk->payload.kind = DDPROTO_MSG_KIND_UNKNOWN;
+size_t ddproto_message_encoded_size(const DDProtoMessage *message, DDProtoError *err) {
+	if(message->kind == DDPROTO_MSG_KIND_UNKNOWN) {
+		return message->msg.unknown.len;
 	}
 
-	return err;
+	const MessageCodec *codec = message_codec(message->kind);
+	DDProtoError size_err = codec ? DDPROTO_ERR_NONE : DDPROTO_ERR_UNKNOWN_MESSAGE;
+	size_t size = 0;
+	if(codec) {
+		size = codec->size(&message->msg, &size_err);
+	}
+	if(size_err != DDPROTO_ERR_NONE) {
+		if(err != NULL) {
+			*err = size_err;
+		}
+
+		return 0;
+	}
+
+	// every message id and category flag fits into one byte
+	return 1 + size;
 }
 
 size_t ddproto_encode_message(DDProtoChunk *chunk, uint8_t *buf, DDProtoError *err) {
-	DDProtoPacker packer;
-	ddproto_packer_init_msg(&packer, chunk->payload.kind);
-
-	DDProtoGenericMessage *msg = &chunk->payload.msg;
+	// `buf` has to fit as much as a packer
+	return ddproto_encode_message_buf(chunk, buf, DDPROTO_PACKER_BUFFER_SIZE, err);
+}
 
-	switch(chunk->payload.kind) {
-	case DDPROTO_MSG_KIND_UNKNOWN:
-		memcpy(buf, chunk->payload.msg.unknown.buf, chunk->payload.msg.unknown.len);
-		return msg->unknown.len;
-	case DDPROTO_MSG_KIND_INFO:
-		ddproto_packer_add_string(&packer, msg->info.version);
-		ddproto_packer_add_string(&packer, msg->info.password);
-		break;
-	case DDPROTO_MSG_KIND_MAP_CHANGE:
-		ddproto_packer_add_string(&packer, msg->map_change.name);
-		ddproto_packer_add_int(&packer, msg->map_change.crc);
-		ddproto_packer_add_int(&packer, msg->map_change.size);
-		break;
-	case DDPROTO_MSG_KIND_MAP_DATA:
-		ddproto_packer_add_int(&packer, msg->map_data.last);
-		ddproto_packer_add_int(&packer, msg->map_data.map_crc);
-		ddproto_packer_add_int(&packer, msg->map_data.chunk);
-		ddproto_packer_add_int(&packer, msg->map_data.chunk_size);
-		ddproto_packer_add_raw(&packer, msg->map_data.data, msg->map_data.chunk_size);
-		break;
-	case DDPROTO_MSG_KIND_ENTERGAME:
-		ddproto_packer_add_string(&packer, "ddnet_protocol " DDPROTO_BUILDINFO);
-		break;
-	case DDPROTO_MSG_KIND_CON_READY:
-	case DDPROTO_MSG_KIND_READY:
-	case DDPROTO_MSG_KIND_SV_READYTOENTER:
-	case DDPROTO_MSG_KIND_SV_VOTECLEAROPTIONS:
-		break;
-	case DDPROTO_MSG_KIND_INPUTTIMING:
-		ddproto_packer_add_int(&packer, msg->input_timing.intended_tick);
-		ddproto_packer_add_int(&packer, msg->input_timing.time_left);
-		break;
-	case DDPROTO_MSG_KIND_RCON_AUTH_STATUS:
-		ddproto_packer_add_int(&packer, msg->rcon_auth_status.authed);
-		ddproto_packer_add_int(&packer, msg->rcon_auth_status.cmdlist);
-		break;
-	case DDPROTO_MSG_KIND_RCON_LINE:
-		ddproto_packer_add_string(&packer, msg->rcon_line.line);
-		break;
-	case DDPROTO_MSG_KIND_INPUT:
-		ddproto_packer_add_int(&packer, msg->input.ack_game_tick);
-		ddproto_packer_add_int(&packer, msg->input.prediction_tick);
-		ddproto_packer_add_int(&packer, msg->input.size);
-		ddproto_packer_add_int(&packer, msg->input.direction);
-		ddproto_packer_add_int(&packer, msg->input.target_x);
-		ddproto_packer_add_int(&packer, msg->input.target_y);
-		ddproto_packer_add_int(&packer, msg->input.jump);
-		ddproto_packer_add_int(&packer, msg->input.fire);
-		ddproto_packer_add_int(&packer, msg->input.hook);
-		ddproto_packer_add_int(&packer, msg->input.player_flags);
-		ddproto_packer_add_int(&packer, msg->input.wanted_weapon);
-		ddproto_packer_add_int(&packer, msg->input.next_weapon);
-		ddproto_packer_add_int(&packer, msg->input.prev_weapon);
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD:
-		ddproto_packer_add_string(&packer, msg->rcon_cmd.command);
-		break;
-	case DDPROTO_MSG_KIND_RCON_AUTH:
-		ddproto_packer_add_string(&packer, msg->rcon_auth.name);
-		ddproto_packer_add_string(&packer, msg->rcon_auth.password);
-		ddproto_packer_add_int(&packer, msg->rcon_auth.send_rcon_cmds);
-		break;
-	case DDPROTO_MSG_KIND_REQUEST_MAP_DATA:
-		ddproto_packer_add_int(&packer, msg->request_map_data.chunk);
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD_ADD:
-		ddproto_packer_add_string(&packer, msg->rcon_cmd_add.name);
-		ddproto_packer_add_string(&packer, msg->rcon_cmd_add.help);
-		ddproto_packer_add_string(&packer, msg->rcon_cmd_add.params);
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD_REM:
-		ddproto_packer_add_string(&packer, msg->rcon_cmd_rem.name);
-		break;
-	case DDPROTO_MSG_KIND_SV_MOTD:
-		ddproto_packer_add_string(&packer, msg->motd.message);
-		break;
-	case DDPROTO_MSG_KIND_SV_BROADCAST:
-		ddproto_packer_add_string(&packer, msg->broadcast.message);
-		break;
-	case DDPROTO_MSG_KIND_SV_CHAT:
-		ddproto_packer_add_int(&packer, msg->chat.team);
-		ddproto_packer_add_int(&packer, msg->chat.client_id);
-		ddproto_packer_add_string(&packer, msg->chat.message);
-		break;
-	case DDPROTO_MSG_KIND_SV_KILLMSG:
-		ddproto_packer_add_int(&packer, msg->kill_msg.killer_id);
-		ddproto_packer_add_int(&packer, msg->kill_msg.victim_id);
-		ddproto_packer_add_int(&packer, msg->kill_msg.weapon);
-		ddproto_packer_add_int(&packer, msg->kill_msg.mode_special);
-		break;
-	case DDPROTO_MSG_KIND_SV_SOUNDGLOBAL:
-		ddproto_packer_add_int(&packer, msg->sound_global.sound_id);
-		break;
-	case DDPROTO_MSG_KIND_SV_TUNEPARAMS:
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.ground_control_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.ground_control_accel * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.ground_friction * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.ground_jump_impulse * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.air_jump_impulse * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.air_control_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.air_control_accel * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.air_friction * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.hook_length * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.hook_fire_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.hook_drag_accel * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.hook_drag_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.gravity * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.velramp_start * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.velramp_range * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.velramp_curvature * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.gun_curvature * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.gun_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.gun_lifetime * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.shotgun_curvature * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.shotgun_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.shotgun_speeddiff * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.shotgun_lifetime * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.grenade_curvature * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.grenade_speed * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.grenade_lifetime * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.laser_reach * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.laser_bounce_delay * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.laser_bounce_num * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.laser_bounce_cost * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.laser_damage * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.player_collision * 100));
-		ddproto_packer_add_int(&packer, (int32_t)(msg->tune_params.player_hooking * 100));
-		break;
-	case DDPROTO_MSG_KIND_SV_WEAPONPICKUP:
-		ddproto_packer_add_int(&packer, msg->weapon_pickup.weapon);
-		break;
-	case DDPROTO_MSG_KIND_SV_EMOTICON:
-		ddproto_packer_add_int(&packer, msg->emoticon.client_id);
-		ddproto_packer_add_int(&packer, msg->emoticon.emoticon);
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONLISTADD:
-		ddproto_packer_add_int(&packer, msg->vote_option_list_add.num_options);
-		for(int32_t i = 0; i < (sizeof(msg->vote_option_list_add.descriptions) / sizeof(const char *)); i++) {
-			if(i > msg->vote_option_list_add.num_options) {
-				ddproto_packer_add_string(&packer, "");
-				continue;
+size_t ddproto_encode_message_buf(const DDProtoChunk *chunk, uint8_t *buf, size_t len, DDProtoError *err) {
+	const DDProtoGenericMessage *msg = &chunk->payload.msg;
+	if(chunk->payload.kind == DDPROTO_MSG_KIND_UNKNOWN) {
+		if(msg->unknown.len > len) {
+			if(err != NULL) {
+				*err = DDPROTO_ERR_BUFFER_FULL;
 			}
-			ddproto_packer_add_string(&packer, msg->vote_option_list_add.descriptions[i]);
+
+			return 0;
 		}
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONADD:
-		ddproto_packer_add_string(&packer, msg->vote_option_add.description);
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONREMOVE:
-		ddproto_packer_add_string(&packer, msg->vote_option_remove.description);
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTESET:
-		ddproto_packer_add_int(&packer, msg->vote_set.timeout);
-		ddproto_packer_add_string(&packer, msg->vote_set.description);
-		ddproto_packer_add_string(&packer, msg->vote_set.reason);
-		break;
-	case DDPROTO_MSG_KIND_CL_SAY:
-		ddproto_packer_add_int(&packer, msg->chat.team);
-		ddproto_packer_add_string(&packer, msg->chat.message);
-		break;
-	case DDPROTO_MSG_KIND_CL_STARTINFO:
-		ddproto_packer_add_string(&packer, msg->start_info.name);
-		ddproto_packer_add_string(&packer, msg->start_info.clan);
-		ddproto_packer_add_int(&packer, (int32_t)msg->start_info.country);
-		ddproto_packer_add_string(&packer, msg->start_info.skin);
-		ddproto_packer_add_int(&packer, msg->start_info.use_custom_color);
-		ddproto_packer_add_int(&packer, (int32_t)msg->start_info.color_body);
-		ddproto_packer_add_int(&packer, (int32_t)msg->start_info.color_feet);
-		break;
-	case DDPROTO_MSG_KIND_SNAP:
-	case DDPROTO_MSG_KIND_SNAPEMPTY:
-	case DDPROTO_MSG_KIND_SNAPSINGLE:
-	case DDPROTO_MSG_KIND_SNAPSMALL:
-	default:
+		memcpy(buf, msg->unknown.buf, msg->unknown.len);
+		return msg->unknown.len;
+	}
+
+	// packed straight into `buf`
+	const MessageCodec *codec = message_codec(chunk->payload.kind);
+	DDProtoError encode_err = DDPROTO_ERR_UNKNOWN_MESSAGE;
+	DDProtoPacker packer;
+	if(codec) {
+		ddproto_packer_init_msg_buf(&packer, chunk->payload.kind, buf, len);
+		encode_err = codec->encode(msg, &packer);
+	}
+	if(encode_err != DDPROTO_ERR_NONE) {
 		if(err != NULL) {
-			*err = DDPROTO_ERR_UNKNOWN_MESSAGE;
+			*err = encode_err;
 		}
+
+		return 0;
 	}
 
-	if(err != NULL && packer.err != DDPROTO_ERR_NONE) {
-		*err = packer.err;
+	return ddproto_packer_size(&packer);
+}
 
-		return 0;
+// packs the message id and category flag of `kind`
+static void packer_add_msg_id(DDProtoPacker *packer, DDProtoMessageKind kind) {
+	const MessageCodec *codec = message_codec(kind);
+	if(!codec) {
+		return;
 	}
+	ddproto_packer_add_int(packer, (int32_t)((codec->id << 1) | codec->category));
+}
 
-	memcpy(buf, ddproto_packer_data(&packer), ddproto_packer_size(&packer));
+DDProtoPacker *ddproto_packer_init_msg(DDProtoPackerBuffer *buffer, DDProtoMessageKind kind) {
+	DDProtoPacker *packer = ddproto_packer_init(buffer);
+	packer_add_msg_id(packer, kind);
+	return packer;
+}
 
-	return ddproto_packer_size(&packer);
+void ddproto_packer_init_msg_buf(DDProtoPacker *packer, DDProtoMessageKind kind, uint8_t *buf, size_t len) {
+	ddproto_packer_init_buf(packer, buf, len);
+	packer_add_msg_id(packer, kind);
 }
 
 DDProtoMessage ddproto_build_msg_info(const char *password) {
@@ -0,0 +1,197 @@
+#include <ddnet_protocol/message_records.h>
+
+#include <ddnet_protocol/chunk.h>
+#include <ddnet_protocol/common.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include "message_schema.h"
+
+#define ARRAY_LEN(array) (sizeof(array) / sizeof((array)[0]))
+
+// rounds `size` up to the next multiple of the record alignment
+static size_t record_align(size_t size) {
+	return (size + DDPROTO_RECORD_ALIGNMENT - 1) & ~(size_t)(DDPROTO_RECORD_ALIGNMENT - 1);
+}
+
+// the message starts after the header
+#define RECORD_HEADER_SIZE record_align(sizeof(DDProtoMessageRecord))
+
+// where the data a message points to is copied to, after the struct of the
+// message. If `buf` is NULL the bytes are only counted
+typedef struct {
+	uint8_t *buf;
+	size_t len;
+} RecordTail;
+
+// copies `size` bytes of `data` to the tail and returns the copy
+static void *tail_copy(RecordTail *tail, const void *data, size_t size, size_t align) {
+	if(!data) {
+		return NULL;
+	}
+	tail->len = (tail->len + align - 1) & ~(align - 1);
+	void *copy = tail->buf ? tail->buf + tail->len : NULL;
+	if(copy) {
+		memcpy(copy, data, size);
+	}
+	tail->len += size;
+	return copy;
+}
+
+static const char *tail_copy_string(RecordTail *tail, const char *string) {
+	return tail_copy(tail, string, string ? strlen(string) + 1 : 0, 1);
+}
+
+static void tail_copy_snapshot(RecordTail *tail, const DDProtoSnapshot *snap, DDProtoSnapshot *copy) {
+	copy->removed_keys.data = tail_copy(tail, snap->removed_keys.data, sizeof(int32_t) * snap->removed_keys.len, DDPROTO_RECORD_ALIGNMENT);
+	copy->items.data = tail_copy(tail, snap->items.data, sizeof(DDProtoSnapItem) * snap->items.len, DDPROTO_RECORD_ALIGNMENT);
+	// the arrays are part of the record, nothing has to be freed
+	copy->allocator = NULL;
+}
+
+// copy_NAME copies everything the message `src` points to and makes the
+// pointers of `dst` point to the copies. PLAIN messages need no copy
+#define INT(field)
+#define BOOL(field)
+#define STRING(field) d->field = tail_copy_string(tail, m->field);
+#define STRING_LEN(field) d->field = tail_copy_string(tail, m->field);
+#define STRING_ARRAY(field, num) \
+	for(size_t i = 0; i < ARRAY_LEN(m->field); i++) { \
+		d->field[i] = (int32_t)i < m->num ? tail_copy_string(tail, m->field[i]) : NULL; \
+	}
+#define RAW(field, len) d->field = tail_copy(tail, m->field, m->len > 0 ? (size_t)m->len : 0, 1);
+#define INTS(Type)
+#define FIXED_POINTS(Type)
+#define SNAPSHOT(field) tail_copy_snapshot(tail, &m->field, &d->field);
+#define CONST_STRING(value)
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) \
+	static void copy_##NAME(const DDProtoGenericMessage *src, DDProtoGenericMessage *dst, RecordTail *tail) { \
+		const Type *m = &src->member; \
+		Type *d = &dst->member; \
+		FIELDS \
+	}
+#define PLAIN(NAME, CATEGORY, VITAL, Type, member, FIELDS)
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS)
+DDPROTO_MESSAGES(MSG, PLAIN, EMPTY)
+#undef INT
+#undef BOOL
+#undef STRING
+#undef STRING_LEN
+#undef STRING_ARRAY
+#undef RAW
+#undef INTS
+#undef FIXED_POINTS
+#undef SNAPSHOT
+#undef CONST_STRING
+#undef MSG
+#undef PLAIN
+#undef EMPTY
+
+static void copy_UNKNOWN(const DDProtoGenericMessage *src, DDProtoGenericMessage *dst, RecordTail *tail) {
+	dst->unknown.buf = tail_copy(tail, src->unknown.buf, src->unknown.len, 1);
+}
+
+typedef struct {
+	// size of the struct of the message
+	size_t size;
+
+	// NULL if the message does not point to anything
+	void (*copy)(const DDProtoGenericMessage *src, DDProtoGenericMessage *dst, RecordTail *tail);
+} RecordLayout;
+
+#define MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) [DDPROTO_MSG_KIND_##NAME] = {sizeof(Type), copy_##NAME},
+#define PLAIN(NAME, CATEGORY, VITAL, Type, member, FIELDS) [DDPROTO_MSG_KIND_##NAME] = {sizeof(Type), NULL},
+#define EMPTY(NAME, CATEGORY, VITAL, FIELDS) [DDPROTO_MSG_KIND_##NAME] = {0, NULL},
+// indexed by DDProtoMessageKind
+static const RecordLayout LAYOUTS[] = {
+	[DDPROTO_MSG_KIND_UNKNOWN] = {sizeof(DDProtoMsgUnknown), copy_UNKNOWN},
+	DDPROTO_MESSAGES(MSG, PLAIN, EMPTY)};
+#undef MSG
+#undef PLAIN
+#undef EMPTY
+
+// layout of the kind of `chunk` or NULL if there is none
+static const RecordLayout *record_layout(const DDProtoChunk *chunk) {
+	if((size_t)chunk->payload.kind >= ARRAY_LEN(LAYOUTS)) {
+		return NULL;
+	}
+	return &LAYOUTS[chunk->payload.kind];
+}
+
+void ddproto_message_records_init(DDProtoMessageRecords *records, void *buf, size_t capacity) {
+	records->buf = buf;
+	records->capacity = capacity;
+	records->len = 0;
+	records->count = 0;
+}
+
+void ddproto_message_records_reset(DDProtoMessageRecords *records) {
+	records->len = 0;
+	records->count = 0;
+}
+
+size_t ddproto_message_record_size(const DDProtoChunk *chunk, DDProtoError *err) {
+	const RecordLayout *layout = record_layout(chunk);
+	if(!layout) {
+		if(err) {
+			*err = DDPROTO_ERR_UNKNOWN_MESSAGE;
+		}
+
+		return 0;
+	}
+
+	RecordTail tail = {.buf = NULL, .len = 0};
+	if(layout->copy) {
+		// the pointers are written into a scratch message
+		DDProtoGenericMessage scratch;
+		layout->copy(&chunk->payload.msg, &scratch, &tail);
+	}
+	return RECORD_HEADER_SIZE + record_align(layout->size) + record_align(tail.len);
+}
+
+DDProtoError ddproto_message_records_push(DDProtoMessageRecords *records, const DDProtoChunk *chunk) {
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t size = ddproto_message_record_size(chunk, &err);
+	if(err != DDPROTO_ERR_NONE) {
+		return err;
+	}
+	if(records->capacity - records->len < size) {
+		return DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
+	}
+
+	const RecordLayout *layout = record_layout(chunk);
+	DDProtoMessageRecord *record = (DDProtoMessageRecord *)(records->buf + records->len);
+	record->header = chunk->header;
+	record->kind = chunk->payload.kind;
+	record->record_size = size;
+
+	DDProtoGenericMessage *msg = (DDProtoGenericMessage *)((uint8_t *)record + RECORD_HEADER_SIZE);
+	memcpy(msg, &chunk->payload.msg, layout->size);
+	if(layout->copy) {
+		RecordTail tail = {.buf = (uint8_t *)msg + record_align(layout->size), .len = 0};
+		layout->copy(&chunk->payload.msg, msg, &tail);
+	}
+
+	records->len += size;
+	records->count++;
+	return DDPROTO_ERR_NONE;
+}
+
+const DDProtoMessageRecord *ddproto_message_records_first(const DDProtoMessageRecords *records) {
+	return records->len ? (const DDProtoMessageRecord *)records->buf : NULL;
+}
+
+const DDProtoMessageRecord *ddproto_message_records_next(const DDProtoMessageRecords *records, const DDProtoMessageRecord *record) {
+	const uint8_t *next = (const uint8_t *)record + record->record_size;
+	return next < records->buf + records->len ? (const DDProtoMessageRecord *)next : NULL;
+}
+
+const DDProtoGenericMessage *ddproto_message_record_msg(const DDProtoMessageRecord *record) {
+	return (const DDProtoGenericMessage *)((const uint8_t *)record + RECORD_HEADER_SIZE);
+}
+
+void ddproto_message_record_load(const DDProtoMessageRecord *record, DDProtoChunk *chunk) {
+	chunk->header = record->header;
+	chunk->payload.kind = record->kind;
+	memcpy(&chunk->payload.msg, ddproto_message_record_msg(record), LAYOUTS[record->kind].size);
+}
@@ -0,0 +1,77 @@
+// Layout of every message the library knows. The decoders, encoders, size
+// functions and lookup tables in message.c and chunk.c and the record layouts
+// in message_records.c are generated from it.
+
+#pragma once
+
+// clang-format off
+
+// MSG(NAME, CATEGORY, VITAL, Type, member, FIELDS) is a message whose fields
+// are stored in the `member` of DDProtoGenericMessage. PLAIN has the same
+// columns but none of its FIELDS point to memory outside of the struct, so it
+// has no STRING, STRING_LEN, STRING_ARRAY, RAW or SNAPSHOT. EMPTY(NAME,
+// CATEGORY, VITAL, FIELDS) has no struct, its FIELDS can only be constants.
+//
+// NAME is the suffix of DDPROTO_MSG_##NAME and DDPROTO_MSG_KIND_##NAME,
+// CATEGORY is SYSTEM or GAME and VITAL is VITAL or NOT_VITAL. The FIELDS are
+// packed in the listed order:
+//
+// INT(field)                 int32_t, enum or size_t as one varint
+// BOOL(field)                bool as one varint
+// STRING(field)              null terminated string
+// STRING_LEN(field)          same as STRING but decoding also sets field##_len
+// STRING_ARRAY(field, num)   every entry of an array, `num` of them are set
+// RAW(field, len)            `len` bytes of raw data
+// INTS(Type)                 the whole struct as array of int32_t
+// FIXED_POINTS(Type)         the whole struct as array of floats times 100
+// SNAPSHOT(field)            a snapshot, can only be decoded
+// CONST_STRING(value)        string that is always sent, never decoded
+#define DDPROTO_MESSAGES(MSG, PLAIN, EMPTY) \
+	/* system messages */ \
+	MSG(INFO, SYSTEM, VITAL, DDProtoMsgInfo, info, STRING(version) STRING(password)) \
+	MSG(MAP_CHANGE, SYSTEM, VITAL, DDProtoMsgMapChange, map_change, STRING(name) INT(crc) INT(size)) \
+	MSG(MAP_DATA, SYSTEM, VITAL, DDProtoMsgMapData, map_data, BOOL(last) INT(map_crc) INT(chunk) INT(chunk_size) RAW(data, chunk_size)) \
+	EMPTY(CON_READY, SYSTEM, VITAL, ) \
+	MSG(SNAP, SYSTEM, NOT_VITAL, DDProtoMsgSnap, snap, INT(game_tick) INT(delta_tick) INT(num_parts) INT(part) INT(crc) INT(part_size) RAW(data, part_size)) \
+	PLAIN(SNAPEMPTY, SYSTEM, NOT_VITAL, DDProtoMsgSnapEmpty, snap_empty, INT(game_tick) INT(delta_tick)) \
+	MSG(SNAPSINGLE, SYSTEM, NOT_VITAL, DDProtoMsgSnapSingle, snap_single, INT(game_tick) INT(delta_tick) INT(crc) INT(part_size) SNAPSHOT(snapshot)) \
+	MSG(SNAPSMALL, SYSTEM, NOT_VITAL, DDProtoMsgSnapSmall, snap_small, INT(game_tick) INT(delta_tick) INT(crc) INT(part_size) RAW(data, part_size)) \
+	PLAIN(INPUTTIMING, SYSTEM, VITAL, DDProtoMsgInputTiming, input_timing, INT(intended_tick) INT(time_left)) \
+	PLAIN(RCON_AUTH_STATUS, SYSTEM, VITAL, DDProtoMsgRconAuthStatus, rcon_auth_status, BOOL(authed) BOOL(cmdlist)) \
+	MSG(RCON_LINE, SYSTEM, VITAL, DDProtoMsgRconLine, rcon_line, STRING(line)) \
+	EMPTY(READY, SYSTEM, VITAL, ) \
+	EMPTY(ENTERGAME, SYSTEM, VITAL, CONST_STRING(ENTERGAME_BUILDINFO)) \
+	PLAIN(INPUT, SYSTEM, NOT_VITAL, DDProtoMsgInput, input, INTS(DDProtoMsgInput)) \
+	MSG(RCON_CMD, SYSTEM, VITAL, DDProtoMsgRconCmd, rcon_cmd, STRING(command)) \
+	MSG(RCON_AUTH, SYSTEM, VITAL, DDProtoMsgRconAuth, rcon_auth, STRING(name) STRING(password) BOOL(send_rcon_cmds)) \
+	PLAIN(REQUEST_MAP_DATA, SYSTEM, VITAL, DDProtoMsgRequestMapData, request_map_data, INT(chunk)) \
+	EMPTY(PING, SYSTEM, NOT_VITAL, ) \
+	EMPTY(PING_REPLY, SYSTEM, NOT_VITAL, ) \
+	MSG(RCON_CMD_ADD, SYSTEM, VITAL, DDProtoMsgRconCmdAdd, rcon_cmd_add, STRING(name) STRING(help) STRING(params)) \
+	MSG(RCON_CMD_REM, SYSTEM, VITAL, DDProtoMsgRconCmdRem, rcon_cmd_rem, STRING(name)) \
+	/* game messages */ \
+	MSG(SV_MOTD, GAME, VITAL, DDProtoMsgSvMotd, motd, STRING_LEN(message)) \
+	MSG(SV_BROADCAST, GAME, VITAL, DDProtoMsgSvBroadcast, broadcast, STRING_LEN(message)) \
+	MSG(SV_CHAT, GAME, VITAL, DDProtoMsgSvChat, chat, INT(team) INT(client_id) STRING_LEN(message)) \
+	PLAIN(SV_KILLMSG, GAME, VITAL, DDProtoMsgSvKillMsg, kill_msg, INT(killer_id) INT(victim_id) INT(weapon) INT(mode_special)) \
+	PLAIN(SV_SOUNDGLOBAL, GAME, VITAL, DDProtoMsgSvSoundGlobal, sound_global, INT(sound_id)) \
+	PLAIN(SV_TUNEPARAMS, GAME, VITAL, DDProtoMsgSvTuneParams, tune_params, FIXED_POINTS(DDProtoMsgSvTuneParams)) \
+	EMPTY(SV_READYTOENTER, GAME, VITAL, ) \
+	PLAIN(SV_WEAPONPICKUP, GAME, VITAL, DDProtoMsgSvWeaponPickup, weapon_pickup, INT(weapon)) \
+	PLAIN(SV_EMOTICON, GAME, VITAL, DDProtoMsgSvEmoticon, emoticon, INT(client_id) INT(emoticon)) \
+	EMPTY(SV_VOTECLEAROPTIONS, GAME, VITAL, ) \
+	MSG(SV_VOTEOPTIONLISTADD, GAME, VITAL, DDProtoMsgSvVoteOptionListAdd, vote_option_list_add, INT(num_options) STRING_ARRAY(descriptions, num_options)) \
+	MSG(SV_VOTEOPTIONADD, GAME, VITAL, DDProtoMsgSvVoteOptionAdd, vote_option_add, STRING(description)) \
+	MSG(SV_VOTEOPTIONREMOVE, GAME, VITAL, DDProtoMsgSvVoteOptionRemove, vote_option_remove, STRING(description)) \
+	MSG(SV_VOTESET, GAME, VITAL, DDProtoMsgSvVoteSet, vote_set, INT(timeout) STRING(description) STRING(reason)) \
+	MSG(CL_SAY, GAME, VITAL, DDProtoMsgClSay, say, INT(team) STRING_LEN(message)) \
+	MSG(CL_STARTINFO, GAME, VITAL, DDProtoMsgClStartInfo, start_info, STRING(name) STRING(clan) INT(country) STRING(skin) BOOL(use_custom_color) INT(color_body) INT(color_feet))
+
+// clang-format on
+
+// values of the VITAL column
+#define SCHEMA_VITAL true
+#define SCHEMA_NOT_VITAL false
+
+// the string the entergame message is sent with
+#define ENTERGAME_BUILDINFO "ddnet_protocol " DDPROTO_BUILDINFO
@@ -1,229 +1,208 @@
 #include <ddnet_protocol/packer.h>
 
-#include <ddnet_protocol/chunk.h>
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/arena.h>
 #include <ddnet_protocol/common.h>
 #include <ddnet_protocol/errors.h>
-#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/int_string.h>
+#include <ddnet_protocol/packet.h>
+
+// the strings are processed this many bytes at a time. The compiler turns the
+// vector types into SSE2, AVX2 or NEON instructions if the target has them and
+// into plain integer code otherwise
+#ifdef __AVX2__
+#define STR_VECTOR_SIZE 32
+#else
+#define STR_VECTOR_SIZE 16
+#endif
+
+typedef uint8_t StrVector __attribute__((vector_size(STR_VECTOR_SIZE)));
+typedef uint64_t StrVectorWords __attribute__((vector_size(STR_VECTOR_SIZE)));
+
+static StrVector str_vector_load(const uint8_t *str) {
+	StrVector vector;
+	memcpy(&vector, str, sizeof(vector));
+	return vector;
+}
 
-void ddproto_str_sanitize_cc(char *string) {
-	uint8_t *str = (uint8_t *)string;
-	while(*str) {
-		if(*str < 32) {
-			*str = ' ';
+// index of the first byte that is set in `mask` or STR_VECTOR_SIZE
+static size_t str_vector_first(StrVector mask) {
+	StrVectorWords words = (StrVectorWords)mask;
+	for(size_t i = 0; i < STR_VECTOR_SIZE / sizeof(uint64_t); i++) {
+		if(words[i]) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			return i * sizeof(uint64_t) + __builtin_clzll(words[i]) / 8;
+#else
+			return i * sizeof(uint64_t) + __builtin_ctzll(words[i]) / 8;
+#endif
+		}
+	}
+	return STR_VECTOR_SIZE;
+}
+
+// copies `len` bytes from `src` to `dst` and replaces control characters
+// with spaces. Tabs and line breaks are kept if `keep_whitespace` is set.
+// `dst` and `src` may be the same
+static void str_sanitize_copy(uint8_t *dst, const uint8_t *src, size_t len, bool keep_whitespace) {
+	size_t i = 0;
+	for(; i + STR_VECTOR_SIZE <= len; i += STR_VECTOR_SIZE) {
+		StrVector chars = str_vector_load(src + i);
+		StrVector control = (StrVector)(chars < 32);
+		if(keep_whitespace) {
+			control &= (StrVector)(chars != '\r') & (StrVector)(chars != '\n') & (StrVector)(chars != '\t');
+		}
+		chars = (chars & ~control) | (control & ' ');
+		memcpy(dst + i, &chars, sizeof(chars));
+	}
+	for(; i < len; i++) {
+		uint8_t c = src[i];
+		if(c < 32 && !(keep_whitespace && (c == '\r' || c == '\n' || c == '\t'))) {
+			c = ' ';
 		}
-		str++;
+		dst[i] = c;
 	}
 }
 
+void ddproto_str_sanitize_cc(char *string) {
+	ddproto_str_sanitize_cc_len(string, strlen(string));
+}
+
+void ddproto_str_sanitize_cc_len(char *string, size_t len) {
+	str_sanitize_copy((uint8_t *)string, (const uint8_t *)string, len, false);
+}
+
 void ddproto_str_sanitize(char *string) {
-	uint8_t *str = (uint8_t *)string;
-	while(*str) {
-		if(*str < 32 && !(*str == '\r') && !(*str == '\n') && !(*str == '\t')) {
-			*str = ' ';
+	ddproto_str_sanitize_len(string, strlen(string));
+}
+
+void ddproto_str_sanitize_len(char *string, size_t len) {
+	str_sanitize_copy((uint8_t *)string, (const uint8_t *)string, len, true);
+}
+
+// index of the first of two consecutive spaces in `str` or `len` if there are
+// none
+static size_t str_find_double_space(const uint8_t *str, size_t len) {
+	size_t i = 0;
+	for(; i + STR_VECTOR_SIZE + 1 <= len; i += STR_VECTOR_SIZE) {
+		StrVector first = str_vector_load(str + i);
+		StrVector second = str_vector_load(str + i + 1);
+		StrVector pairs = (StrVector)(first == ' ') & (StrVector)(second == ' ');
+		size_t found = str_vector_first(pairs);
+		if(found != STR_VECTOR_SIZE) {
+			return i + found;
 		}
-		str++;
 	}
+	for(; i + 1 < len; i++) {
+		if(str[i] == ' ' && str[i + 1] == ' ') {
+			return i;
+		}
+	}
+	return len;
 }
 
-void ddproto_str_clean_whitespaces(char *string) {
-	char *read = string;
-	char *write = string;
+size_t ddproto_str_clean_whitespaces(char *string) {
+	return ddproto_str_clean_whitespaces_len(string, strlen(string));
+}
 
-	/* skip initial whitespace */
-	while(*read == ' ') {
+size_t ddproto_str_clean_whitespaces_len(char *string, size_t len) {
+	uint8_t *read = (uint8_t *)string;
+	uint8_t *end = read + len;
+	uint8_t *write = read;
+
+	// skip initial whitespace
+	while(read < end && *read == ' ') {
 		read++;
 	}
 
-	/* end of read string is detected in the loop */
-	while(true) {
-		/* skip whitespace */
-		bool found_whitespace = false;
-		for(; *read == ' '; read++) {
-			found_whitespace = true;
+	// everything up to two consecutive spaces is kept as is. Then the first
+	// space is kept and the following ones are dropped
+	while(read < end) {
+		size_t keep = str_find_double_space(read, end - read);
+		if(keep != (size_t)(end - read)) {
+			keep++;
+		}
+		if(write != read) {
+			memmove(write, read, keep);
+		}
+		write += keep;
+		read += keep;
+		while(read < end && *read == ' ') {
+			read++;
 		}
-		/* if not at the end of the string, put a found whitespace here */
-		if(*read) {
-			if(found_whitespace) {
-				*write++ = ' ';
+	}
+
+	// only a single trailing space can be left
+	if(write != (uint8_t *)string && write[-1] == ' ') {
+		write--;
+	}
+	*write = '\0';
+	return write - (uint8_t *)string;
+}
+
+static bool is_sanitized_char(uint8_t c, DDProtoStringSanitize sanitize) {
+	if(c >= 32) {
+		return true;
+	}
+	if(sanitize & DDPROTO_STRING_SANITIZE) {
+		return c == '\r' || c == '\n' || c == '\t';
+	}
+	return !(sanitize & DDPROTO_STRING_SANITIZE_CC);
+}
+
+bool ddproto_string_view_is_sanitized(DDProtoStringView view, DDProtoStringSanitize sanitize) {
+	const uint8_t *str = (const uint8_t *)view.str;
+	for(size_t i = 0; i < view.len; i++) {
+		if(!is_sanitized_char(str[i], sanitize)) {
+			return false;
+		}
+	}
+
+	if(sanitize & DDPROTO_STRING_SKIP_START_WHITESPACES && view.len) {
+		if(str[0] == ' ' || str[view.len - 1] == ' ') {
+			return false;
+		}
+		for(size_t i = 1; i < view.len; i++) {
+			if(str[i] == ' ' && str[i - 1] == ' ') {
+				return false;
 			}
-			*write++ = *read++;
-		} else {
-			*write = 0;
-			break;
 		}
 	}
+	return true;
 }
 
-void ddproto_packer_init(DDProtoPacker *packer) {
+size_t ddproto_string_view_sanitize(DDProtoStringView view, DDProtoStringSanitize sanitize, char *buf, size_t buf_len) {
+	if(buf_len == 0) {
+		return 0;
+	}
+
+	size_t len = view.len < buf_len - 1 ? view.len : buf_len - 1;
+	if(sanitize & (DDPROTO_STRING_SANITIZE | DDPROTO_STRING_SANITIZE_CC)) {
+		str_sanitize_copy((uint8_t *)buf, (const uint8_t *)view.str, len, sanitize & DDPROTO_STRING_SANITIZE);
+	} else {
+		memmove(buf, view.str, len);
+	}
+	buf[len] = '\0';
+
+	if(sanitize & DDPROTO_STRING_SKIP_START_WHITESPACES) {
+		len = ddproto_str_clean_whitespaces_len(buf, len);
+	}
+	return len;
+}
+
+DDProtoPacker *ddproto_packer_init(DDProtoPackerBuffer *buffer) {
+	ddproto_packer_init_buf(&buffer->packer, buffer->buf, sizeof(buffer->buf));
+	return &buffer->packer;
+}
+
+void ddproto_packer_init_buf(DDProtoPacker *packer, uint8_t *buf, size_t len) {
 	packer->err = DDPROTO_ERR_NONE;
-	packer->current = packer->buf;
-	packer->end = packer->buf + (size_t)DDPROTO_PACKER_BUFFER_SIZE;
-}
-
-void ddproto_packer_init_msg(DDProtoPacker *packer, DDProtoMessageKind kind) {
-	ddproto_packer_init(packer);
-
-	DDProtoMessageId msg_id;
-	DDProtoMessageCategory msg_category;
-
-	switch(kind) {
-	case DDPROTO_MSG_KIND_UNKNOWN:
-		return;
-	case DDPROTO_MSG_KIND_INFO:
-		msg_id = DDPROTO_MSG_INFO;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_MAP_CHANGE:
-		msg_id = DDPROTO_MSG_MAP_CHANGE;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_MAP_DATA:
-		msg_id = DDPROTO_MSG_MAP_DATA;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_CON_READY:
-		msg_id = DDPROTO_MSG_CON_READY;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_SNAP:
-		msg_id = DDPROTO_MSG_SNAP;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_SNAPEMPTY:
-		msg_id = DDPROTO_MSG_SNAPEMPTY;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_SNAPSINGLE:
-		msg_id = DDPROTO_MSG_SNAPSINGLE;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_SNAPSMALL:
-		msg_id = DDPROTO_MSG_SNAPSMALL;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_INPUTTIMING:
-		msg_id = DDPROTO_MSG_INPUTTIMING;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_AUTH_STATUS:
-		msg_id = DDPROTO_MSG_RCON_AUTH_STATUS;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_LINE:
-		msg_id = DDPROTO_MSG_RCON_LINE;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_READY:
-		msg_id = DDPROTO_MSG_READY;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_ENTERGAME:
-		msg_id = DDPROTO_MSG_ENTERGAME;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_INPUT:
-		msg_id = DDPROTO_MSG_INPUT;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD:
-		msg_id = DDPROTO_MSG_RCON_CMD;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_AUTH:
-		msg_id = DDPROTO_MSG_RCON_AUTH;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_REQUEST_MAP_DATA:
-		msg_id = DDPROTO_MSG_REQUEST_MAP_DATA;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_PING:
-		msg_id = DDPROTO_MSG_PING;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_PING_REPLY:
-		msg_id = DDPROTO_MSG_PING_REPLY;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD_ADD:
-		msg_id = DDPROTO_MSG_RCON_CMD_ADD;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_RCON_CMD_REM:
-		msg_id = DDPROTO_MSG_RCON_CMD_REM;
-		msg_category = DDPROTO_SYSTEM;
-		break;
-	case DDPROTO_MSG_KIND_SV_MOTD:
-		msg_id = DDPROTO_MSG_SV_MOTD;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_BROADCAST:
-		msg_id = DDPROTO_MSG_SV_BROADCAST;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_CHAT:
-		msg_id = DDPROTO_MSG_SV_CHAT;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_KILLMSG:
-		msg_id = DDPROTO_MSG_SV_KILLMSG;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_SOUNDGLOBAL:
-		msg_id = DDPROTO_MSG_SV_SOUNDGLOBAL;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_TUNEPARAMS:
-		msg_id = DDPROTO_MSG_SV_TUNEPARAMS;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_READYTOENTER:
-		msg_id = DDPROTO_MSG_SV_READYTOENTER;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_WEAPONPICKUP:
-		msg_id = DDPROTO_MSG_SV_WEAPONPICKUP;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_EMOTICON:
-		msg_id = DDPROTO_MSG_SV_EMOTICON;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTECLEAROPTIONS:
-		msg_id = DDPROTO_MSG_SV_VOTECLEAROPTIONS;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONLISTADD:
-		msg_id = DDPROTO_MSG_SV_VOTEOPTIONLISTADD;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONADD:
-		msg_id = DDPROTO_MSG_SV_VOTEOPTIONADD;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTEOPTIONREMOVE:
-		msg_id = DDPROTO_MSG_SV_VOTEOPTIONREMOVE;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_SV_VOTESET:
-		msg_id = DDPROTO_MSG_SV_VOTESET;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_CL_SAY:
-		msg_id = DDPROTO_MSG_CL_SAY;
-		msg_category = DDPROTO_GAME;
-		break;
-	case DDPROTO_MSG_KIND_CL_STARTINFO:
-		msg_id = DDPROTO_MSG_CL_STARTINFO;
-		msg_category = DDPROTO_GAME;
-		break;
-	}
-
-	ddproto_packer_add_int(packer, (int32_t)((msg_id << 1) | msg_category));
+	packer->start = buf;
+	packer->current = buf;
+	packer->end = buf + len;
 }
 
 size_t ddproto_packer_size(DDProtoPacker *packer) {
-	return packer->current - packer->buf;
+	return packer->current - packer->start;
 }
 
 size_t ddproto_packer_remaining_size(DDProtoPacker *packer) {
@@ -231,7 +210,7 @@ size_t ddproto_packer_remaining_size(DDProtoPacker *packer) {
 }
 
 uint8_t *ddproto_packer_data(DDProtoPacker *packer) {
-	return packer->buf;
+	return packer->start;
 }
 
 DDProtoError ddproto_packer_add_int(DDProtoPacker *packer, int32_t value) {
@@ -272,13 +251,61 @@ DDProtoError ddproto_packer_add_int(DDProtoPacker *packer, int32_t value) {
 	return DDPROTO_ERR_NONE;
 }
 
+size_t ddproto_packer_ints_size(const int32_t *values, size_t num) {
+	size_t size = 0;
+	for(size_t i = 0; i < num; i++) {
+		// the sign has its own bit so negative values take as many bytes as their
+		// complement. Branchless so the compiler can vectorize the loop
+		uint32_t value = (uint32_t)(values[i] ^ -(int32_t)(values[i] < 0));
+		size += 1 + (value >= (1 << 6)) + (value >= (1 << (6 + 7))) + (value >= (1 << (6 + 7 + 7))) + (value >= (1 << (6 + 7 + 7 + 7)));
+	}
+	return size;
+}
+
+// packs `value` without any bounds checks and returns the end of the packed
+// integer
+static uint8_t *pack_int(uint8_t *dst, int32_t value) {
+	uint8_t sign = 0;
+	if(value < 0) {
+		sign = 0x40;
+		value = ~value;
+	}
+
+	*dst = sign | (value & 0x3f);
+	value >>= 6;
+	while(value) {
+		*dst++ |= 0x80;
+		*dst = value & 0x7f;
+		value >>= 7;
+	}
+	return dst + 1;
+}
+
+DDProtoError ddproto_packer_add_ints(DDProtoPacker *packer, const int32_t *values, size_t num) {
+	if(ddproto_packer_remaining_size(packer) < ddproto_packer_ints_size(values, num)) {
+		return packer->err = DDPROTO_ERR_BUFFER_FULL;
+	}
+
+	uint8_t *dst = packer->current;
+	for(size_t i = 0; i < num; i++) {
+		dst = pack_int(dst, values[i]);
+	}
+	packer->current = dst;
+	return DDPROTO_ERR_NONE;
+}
+
 DDProtoError ddproto_packer_add_string(DDProtoPacker *packer, const char *value) {
-	size_t len = strlen(value) + 1;
-	if(ddproto_packer_remaining_size(packer) < len) {
+	return ddproto_packer_add_string_len(packer, value, strlen(value));
+}
+
+DDProtoError ddproto_packer_add_string_len(DDProtoPacker *packer, const char *value, size_t len) {
+	// the null terminator is not part of `len`
+	if(ddproto_packer_remaining_size(packer) <= len) {
 		return packer->err = DDPROTO_ERR_BUFFER_FULL;
 	}
-	strncpy((char *)packer->current, value, len);
-	packer->current += len;
+	memcpy(packer->current, value, len);
+	packer->current[len] = '\0';
+	packer->current += len + 1;
 
 	return DDPROTO_ERR_NONE;
 }
@@ -292,7 +319,14 @@ DDProtoError ddproto_packer_add_raw(DDProtoPacker *packer, const uint8_t *data,
 	return DDPROTO_ERR_NONE;
 }
 
+static const DDProtoDecodeOptions DEFAULT_DECODE_OPTIONS = {};
+
 void ddproto_unpacker_init(DDProtoUnpacker *unpacker, const uint8_t *buf, size_t len) {
+	ddproto_unpacker_reset(unpacker, buf, len);
+	unpacker->options = &DEFAULT_DECODE_OPTIONS;
+}
+
+void ddproto_unpacker_reset(DDProtoUnpacker *unpacker, const uint8_t *buf, size_t len) {
 	unpacker->err = DDPROTO_ERR_NONE;
 	unpacker->buf = buf;
 	unpacker->buf_end = buf + len;
@@ -302,8 +336,80 @@ size_t ddproto_unpacker_remaining_size(DDProtoUnpacker *unpacker) {
 	return unpacker->buf_end - unpacker->buf;
 }
 
+static uint32_t read_le32(const uint8_t *buf) {
+	uint32_t value;
+	memcpy(&value, buf, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap32(value);
+#endif
+	return value;
+}
+
+static uint64_t read_le64(const uint8_t *buf) {
+	uint64_t value;
+	memcpy(&value, buf, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	value = __builtin_bswap64(value);
+#endif
+	return value;
+}
+
+// unpacks an integer of at least 2 bytes without any bounds checks
+// the buffer has to hold at least 5 bytes
+//
+// the length is found by branching on the extend bits of the loaded word.
+// Computing it from the trailing zeros of the extend bits is branchless but
+// makes the position of the next integer depend on the loaded data which
+// turned out to be about twice as slow
+static int32_t unpacker_get_int_fast(DDProtoUnpacker *unpacker) {
+	const uint8_t *buf = unpacker->buf;
+	const uint32_t word = read_le32(buf);
+	const uint32_t sign = (word >> 6) & 1;
+	uint32_t value = (word & 0x3f) | ((word >> 2) & (0x7f << 6));
+	if(!(word & 0x8000)) {
+		unpacker->buf = buf + 2;
+		return (int32_t)(value ^ -sign);
+	}
+
+	value |= (word >> 3) & (0x7f << (6 + 7));
+	if(!(word & 0x800000)) {
+		unpacker->buf = buf + 3;
+		return (int32_t)(value ^ -sign);
+	}
+
+	value |= (word >> 4) & (0x7f << (6 + 7 + 7));
+	if(!(word & 0x80000000)) {
+		unpacker->buf = buf + 4;
+		return (int32_t)(value ^ -sign);
+	}
+
+	value |= (uint32_t)(buf[4] & 0x0f) << (6 + 7 + 7 + 7);
+	unpacker->buf = buf + 5;
+	return (int32_t)(value ^ -sign);
+}
+
+// the buffer has to hold at least 5 bytes
+static int32_t unpacker_get_int_unchecked(DDProtoUnpacker *unpacker) {
+	const uint8_t *buf = unpacker->buf;
+	if(!(*buf & 0x80)) {
+		unpacker->buf++;
+		return (*buf & 0x3f) ^ -((*buf >> 6) & 1);
+	}
+	return unpacker_get_int_fast(unpacker);
+}
+
 int32_t ddproto_unpacker_get_int(DDProtoUnpacker *unpacker) {
 	size_t space = ddproto_unpacker_remaining_size(unpacker);
+	// most integers fit into one byte, so they are checked before anything
+	// else and also right at the end of the data
+	const uint8_t *buf = unpacker->buf;
+	if(space >= 1 && !(*buf & 0x80)) {
+		unpacker->buf++;
+		return (*buf & 0x3f) ^ -((*buf >> 6) & 1);
+	}
+	if(space >= 5) {
+		return unpacker_get_int_fast(unpacker);
+	}
 	if(space < 1) {
 		unpacker->err = DDPROTO_ERR_EMPTY_BUFFER;
 		return 0;
@@ -359,37 +465,147 @@ int32_t ddproto_unpacker_get_int(DDProtoUnpacker *unpacker) {
 	return value;
 }
 
-const char *ddproto_unpacker_get_string_sanitized(DDProtoUnpacker *unpacker, DDProtoStringSanitize sanitize) {
+// unpacks `num` integers at once, checking the remaining space only once per
+// run of integers that is known to fit
+DDProtoError ddproto_unpacker_get_ints(DDProtoUnpacker *unpacker, int32_t *values, size_t num) {
+	size_t i = 0;
+	while(i < num) {
+		// every integer takes at most 5 bytes so this many can be unpacked
+		// without checking the remaining space
+		size_t unchecked = ddproto_unpacker_remaining_size(unpacker) / 5;
+		if(unchecked > num - i) {
+			unchecked = num - i;
+		}
+		for(size_t end = i + unchecked; i < end; i++) {
+			values[i] = unpacker_get_int_unchecked(unpacker);
+		}
+		if(i == num) {
+			break;
+		}
+
+		// near the end of the data. An error that was set before
+		// must not be mistaken for running out of data
+		DDProtoError err = unpacker->err;
+		unpacker->err = DDPROTO_ERR_NONE;
+		values[i++] = ddproto_unpacker_get_int(unpacker);
+		if(unpacker->err != DDPROTO_ERR_NONE) {
+			memset(&values[i], 0, sizeof(int32_t) * (num - i));
+			break;
+		}
+		unpacker->err = err;
+	}
+	return unpacker->err;
+}
+
+DDProtoStringView ddproto_unpacker_get_string_view(DDProtoUnpacker *unpacker) {
+	DDProtoStringView view = {.str = "", .len = 0};
 	if(unpacker->err != DDPROTO_ERR_NONE) {
-		return "";
+		return view;
 	}
 
-	char *str = (char *)unpacker->buf;
-	while(*unpacker->buf) // skip the string
-	{
-		unpacker->buf++;
-		if(unpacker->buf == unpacker->buf_end) {
-			unpacker->err = DDPROTO_ERR_STR_UNEXPECTED_EOF;
-			return "";
+	const uint8_t *nul = memchr(unpacker->buf, 0, ddproto_unpacker_remaining_size(unpacker));
+	if(!nul) {
+		unpacker->err = DDPROTO_ERR_STR_UNEXPECTED_EOF;
+		return view;
+	}
+	view.str = (const char *)unpacker->buf;
+	view.len = nul - unpacker->buf;
+	unpacker->buf = nul + 1;
+
+	if(unpacker->options->validate_utf8 && !ddproto_str_is_utf8(view.str, view.len)) {
+		unpacker->err = DDPROTO_ERR_INVALID_UTF8;
+		view.str = "";
+		view.len = 0;
+	}
+	return view;
+}
+
+#if CODE_SPACE == USER_SPACE
+// sanitized strings of unpackers without memory of their own. A string is
+// only overwritten after the buffer wrapped around which takes at least
+// DDPROTO_MAX_PACKET_SIZE bytes of other strings, strings never get longer
+// than a packet
+static _Thread_local uint8_t scratch[DDPROTO_MAX_PACKET_SIZE * 3];
+static _Thread_local size_t scratch_len;
+
+static char *unpacker_scratch(size_t size) {
+	if(size > DDPROTO_MAX_PACKET_SIZE) {
+		return NULL;
+	}
+	if(sizeof(scratch) - scratch_len < size) {
+		scratch_len = 0;
+	}
+	char *copy = (char *)scratch + scratch_len;
+	scratch_len += size;
+	return copy;
+}
+#endif
+
+// returns where the sanitized copy of `view` is written to. Strings in memory
+// that belongs to the decoder are sanitized where they are, all others are
+// copied into the string buffer, the arena or the scratch buffer of the thread
+static char *unpacker_string_copy(DDProtoUnpacker *unpacker, DDProtoStringView view) {
+	const uint8_t *str = (const uint8_t *)view.str;
+	DDProtoStringBuffer *strings = unpacker->options->strings;
+	if(strings) {
+		if(str >= strings->buf && str < strings->buf + strings->capacity) {
+			return (char *)strings->buf + (str - strings->buf);
+		}
+		if(strings->capacity - strings->len > view.len) {
+			char *copy = (char *)strings->buf + strings->len;
+			strings->len += view.len + 1;
+			return copy;
 		}
 	}
-	unpacker->buf++;
+	if(unpacker->options->arena) {
+		return ddproto_arena_alloc(unpacker->options->arena, view.len + 1);
+	}
+#if CODE_SPACE == USER_SPACE
+	return unpacker_scratch(view.len + 1);
+#else
+	return NULL;
+#endif
+}
 
-	if(sanitize & DDPROTO_STRING_SANITIZE) {
-		ddproto_str_sanitize(str);
-	} else if(sanitize & DDPROTO_STRING_SANITIZE_CC) {
-		ddproto_str_sanitize_cc(str);
+const char *ddproto_unpacker_get_string_sanitized_len(DDProtoUnpacker *unpacker, DDProtoStringSanitize sanitize, size_t *len) {
+	DDProtoStringView view = ddproto_unpacker_get_string_view(unpacker);
+	*len = view.len;
+	if(!view.len) {
+		return view.str;
 	}
-	if(sanitize & DDPROTO_STRING_SKIP_START_WHITESPACES) {
-		ddproto_str_clean_whitespaces(str);
+	// strings were already checked by the view if the unpacker validates
+	if((sanitize & DDPROTO_STRING_VALIDATE_UTF8) && !unpacker->options->validate_utf8 && !ddproto_str_is_utf8(view.str, view.len)) {
+		unpacker->err = DDPROTO_ERR_INVALID_UTF8;
+		*len = 0;
+		return "";
 	}
+	if(ddproto_string_view_is_sanitized(view, sanitize)) {
+		return view.str;
+	}
+
+	char *str = unpacker_string_copy(unpacker, view);
+	if(!str) {
+		unpacker->err = DDPROTO_ERR_BUFFER_FULL;
+		*len = 0;
+		return "";
+	}
+	*len = ddproto_string_view_sanitize(view, sanitize, str, view.len + 1);
 	return str;
 }
 
+const char *ddproto_unpacker_get_string_sanitized(DDProtoUnpacker *unpacker, DDProtoStringSanitize sanitize) {
+	size_t len;
+	return ddproto_unpacker_get_string_sanitized_len(unpacker, sanitize, &len);
+}
+
 const char *ddproto_unpacker_get_string(DDProtoUnpacker *unpacker) {
 	return ddproto_unpacker_get_string_sanitized(unpacker, DDPROTO_STRING_SANITIZE);
 }
 
+const char *ddproto_unpacker_get_string_len(DDProtoUnpacker *unpacker, size_t *len) {
+	return ddproto_unpacker_get_string_sanitized_len(unpacker, DDPROTO_STRING_SANITIZE, len);
+}
+
 bool ddproto_unpacker_get_bool(DDProtoUnpacker *unpacker) {
 	int32_t val = ddproto_unpacker_get_int(unpacker);
 	if(val != 0 && val != 1) {
@@ -410,3 +626,82 @@ const uint8_t *ddproto_unpacker_get_raw(DDProtoUnpacker *unpacker, size_t len) {
 
 	return ptr;
 }
+
+// skips up to `num` integers 8 bytes at a time and returns how many were
+// skipped. Every byte without the extend bit ends an integer so they are
+// counted instead of unpacking the integers. The words are loaded at a fixed
+// stride so the loads do not wait for the previous word. Stops less than 8
+// bytes before the end of the buffer
+static size_t unpacker_skip_ints_words(DDProtoUnpacker *unpacker, size_t num) {
+	const uint64_t high_bits = 0x8080808080808080;
+	const uint8_t *buf = unpacker->buf;
+	// the first byte behind the last integer that was counted
+	const uint8_t *next_int = buf;
+	uint64_t prev_extends = 0;
+	size_t skipped = 0;
+	while(skipped < num && unpacker->buf_end - buf >= 8) {
+		const uint64_t word = read_le64(buf);
+		uint64_t ends = ~word & high_bits;
+		const uint64_t extends = word & high_bits;
+
+		// the fifth byte of an integer ends it even if its extend bit is
+		// set. Those integers are unpacked one by one
+		uint64_t runs = extends;
+		for(size_t i = 1; i < 5; i++) {
+			runs &= (extends << (8 * i)) | (prev_extends >> (64 - 8 * i));
+		}
+		if(runs) {
+			unpacker->buf = next_int;
+			unpacker_get_int_unchecked(unpacker);
+			skipped++;
+			buf = next_int = unpacker->buf;
+			prev_extends = 0;
+			continue;
+		}
+
+		// sums up the ends in the top byte. __builtin_popcountll would be a
+		// library call on targets without a popcount instruction
+		const size_t count = ((ends >> 7) * 0x0101010101010101) >> 56;
+		if(count >= num - skipped) {
+			// clear the ends of the integers before the last one
+			for(size_t i = num - skipped - 1; i > 0; i--) {
+				ends &= ends - 1;
+			}
+			next_int = buf + __builtin_ctzll(ends) / 8 + 1;
+			skipped = num;
+			break;
+		}
+		skipped += count;
+		if(ends) {
+			next_int = buf + 8 - __builtin_clzll(ends) / 8;
+		}
+		prev_extends = extends;
+		buf += 8;
+	}
+	unpacker->buf = next_int;
+	return skipped;
+}
+
+DDProtoError ddproto_unpacker_skip_ints(DDProtoUnpacker *unpacker, size_t num) {
+	if(unpacker->err != DDPROTO_ERR_NONE) {
+		return unpacker->err;
+	}
+	size_t skipped = unpacker_skip_ints_words(unpacker, num);
+	for(; skipped < num; skipped++) {
+		ddproto_unpacker_get_int(unpacker);
+		if(unpacker->err != DDPROTO_ERR_NONE) {
+			break;
+		}
+	}
+	return unpacker->err;
+}
+
+const uint8_t *ddproto_unpacker_get_raw_ints(DDProtoUnpacker *unpacker, size_t num, size_t *size) {
+	*size = 0;
+	const uint8_t *start = unpacker->buf;
+	if(ddproto_unpacker_skip_ints(unpacker, num) != DDPROTO_ERR_NONE) {
+		return NULL;
+	}
+	*size = unpacker->buf - start;
+	return start;
+}
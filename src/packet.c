@@ -1,11 +1,15 @@
 #include <ddnet_protocol/packet.h>
 
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/arena.h>
 #include <ddnet_protocol/chunk.h>
 #include <ddnet_protocol/control_message.h>
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/fetch_chunks.h>
 #include <ddnet_protocol/huffman.h>
 #include <ddnet_protocol/message.h>
+#include <ddnet_protocol/message_records.h>
+#include <ddnet_protocol/packer.h>
 #include <ddnet_protocol/snapshot.h>
 #include <ddnet_protocol/token.h>
 
@@ -27,15 +31,20 @@ DDProtoError ddproto_encode_packet_header(const DDProtoPacketHeader *header, uin
 	return DDPROTO_ERR_NONE;
 }
 
+// where the memory of a decoded packet comes from
 typedef struct {
 	DDProtoChunk *chunks;
-	size_t len;
-} Context;
+	// the messages are decoded with them. The payload and the chunks are
+	// allocated from its arena or allocator too
+	DDProtoDecodeOptions options;
+	// if it is set the chunks are appended to it instead of `chunks`
+	DDProtoMessageRecords *records;
+} PacketMemory;
 
-static void on_chunk(void *ctx, DDProtoChunk *chunk) {
-	Context *context = ctx;
-
-	memcpy(&context->chunks[context->len++], chunk, sizeof(DDProtoChunk));
+// allocates from the arena or from the allocator if there is no arena
+static void *packet_alloc(const PacketMemory *memory, size_t size) {
+	const DDProtoDecodeOptions *options = &memory->options;
+	return options->arena ? ddproto_arena_alloc(options->arena, size) : ddproto_alloc(options->allocator, size);
 }
 
 size_t ddproto_get_packet_payload(DDProtoPacketHeader *header, const uint8_t *full_data, size_t full_len, uint8_t *payload, size_t payload_len, DDProtoError *err) {
@@ -48,7 +57,107 @@ size_t ddproto_get_packet_payload(DDProtoPacketHeader *header, const uint8_t *fu
 	return full_len;
 }
 
-DDProtoPacket ddproto_decode_packet(const uint8_t *buf, size_t len, DDProtoError *err) {
+// unpacks up to `num_chunks` chunks into the chunks or records of `memory`.
+// Returns the amount of unpacked chunks
+static size_t unpack_chunks(DDProtoChunkIterator *iter, size_t num_chunks, const PacketMemory *memory) {
+	size_t unpacked = 0;
+	if(!memory->records) {
+		while(unpacked < num_chunks && ddproto_chunk_iterator_next(iter, &memory->chunks[unpacked])) {
+			unpacked++;
+		}
+		return unpacked;
+	}
+
+	// every chunk is copied into its record right away so one is enough
+	DDProtoChunk chunk = {};
+	DDProtoSnapshot *snap = &chunk.payload.msg.snap_single.snapshot;
+	while(unpacked < num_chunks) {
+		// a snapshot that failed to decode might not have set its arrays
+		snap->removed_keys.data = NULL;
+		snap->items.data = NULL;
+		bool ok = ddproto_chunk_iterator_next(iter, &chunk);
+		if(ok) {
+			DDProtoError err = ddproto_message_records_push(memory->records, &chunk);
+			if(err != DDPROTO_ERR_NONE) {
+				iter->err = err;
+				ok = false;
+			}
+		}
+		if(chunk.payload.kind == DDPROTO_MSG_KIND_SNAPSINGLE) {
+			ddproto_free_snapshot(snap);
+		}
+		if(!ok) {
+			break;
+		}
+		unpacked++;
+	}
+	return unpacked;
+}
+
+// reads the ddnet security token that follows the chunks which end at `size`
+static void read_payload_token(DDProtoPacketHeader *header, const uint8_t *payload, size_t payload_len, size_t size, DDProtoError *err) {
+	size_t space = payload_len - size;
+
+	// missing ddnet security token
+	// this is an error in the ddnet protocol
+	// but expected in the teeworlds protocol
+	//
+	// because pure teeworlds is not in scope we throw an error
+	// https://github.com/MilkeeyCat/ddnet_protocol/issues/48
+	if(space < sizeof(DDProtoToken)) {
+		if(err) {
+			*err = DDPROTO_ERR_MISSING_DDNET_SECURITY_TOKEN;
+		}
+
+		return;
+	}
+
+	if(space > sizeof(DDProtoToken)) {
+		// we did already parse the expected amount of chunks
+		// and the ddnet security token
+		// but there are still bytes left!
+		if(err) {
+			*err = DDPROTO_ERR_REMAINING_BYTES_IN_BUFFER;
+		}
+
+		return;
+	}
+
+	header->token = ddproto_read_token(payload + size);
+}
+
+// decodes the control message or the chunks of the uncompressed
+// `packet.payload`
+static DDProtoPacket decode_payload(DDProtoPacket packet, const PacketMemory *memory, DDProtoError *err) {
+	if(packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL) {
+		packet.kind = DDPROTO_PACKET_CONTROL;
+		size_t size = ddproto_decode_control(packet.payload, packet.payload_len, &packet.control, err); // NOLINT(clang-analyzer-unix.Malloc)
+		packet.header.token = ddproto_read_token(packet.payload + size);
+		return packet;
+	}
+
+	packet.kind = DDPROTO_PACKET_NORMAL;
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, packet.payload, packet.payload_len, &packet.header);
+	iter.options = &memory->options;
+	size_t num_chunks = unpack_chunks(&iter, packet.header.num_chunks, memory);
+	if(iter.err != DDPROTO_ERR_NONE) {
+		if(err) {
+			*err = iter.err;
+		}
+
+		return packet;
+	}
+
+	packet.chunks.data = memory->chunks;
+	packet.chunks.len = num_chunks;
+	read_payload_token(&packet.header, packet.payload, packet.payload_len, ddproto_chunk_iterator_offset(&iter), err);
+	return packet;
+}
+
+// decodes a packet into memory allocated from `arena` or from `allocator` if
+// there is no arena
+static DDProtoPacket decode_packet(const uint8_t *buf, size_t len, DDProtoArena *arena, DDProtoAllocator *allocator, DDProtoError *err) {
 	DDProtoPacket packet = {};
 
 	if(len < DDPROTO_PACKET_HEADER_SIZE || len > DDPROTO_MAX_PACKET_SIZE) {
@@ -60,9 +169,29 @@ DDProtoPacket ddproto_decode_packet(const uint8_t *buf, size_t len, DDProtoError
 	}
 
 	packet.header = ddproto_decode_packet_header(buf);
-	packet.payload = malloc(DDPROTO_MAX_PACKET_SIZE);
+	const bool control = packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL;
+	const bool compressed = packet.header.flags & DDPROTO_PACKET_FLAG_COMPRESSION;
+	packet.allocator = allocator;
+	PacketMemory memory = {
+		.options = {
+			.arena = arena,
+			.allocator = allocator,
+		},
+	};
+	// uncompressed payloads are copied as they are, compressed ones are
+	// decompressed in one go
+	const size_t payload_size = compressed ? DDPROTO_MAX_PACKET_SIZE : len - DDPROTO_PACKET_HEADER_SIZE;
+	uint8_t *payload = packet_alloc(&memory, payload_size);
+	packet.payload = payload;
+	if(!payload && payload_size) {
+		if(err) {
+			*err = DDPROTO_ERR_OUT_OF_MEMORY;
+		}
+
+		return packet;
+	}
 	DDProtoError payload_err = DDPROTO_ERR_NONE;
-	packet.payload_len = ddproto_get_packet_payload(&packet.header, buf, len, packet.payload, DDPROTO_MAX_PACKET_SIZE, &payload_err);
+	packet.payload_len = ddproto_get_packet_payload(&packet.header, buf, len, payload, payload_size, &payload_err);
 	if(payload_err != DDPROTO_ERR_NONE) {
 		if(err) {
 			*err = payload_err;
@@ -70,101 +199,335 @@ DDProtoPacket ddproto_decode_packet(const uint8_t *buf, size_t len, DDProtoError
 		return packet;
 	}
 
-	if(packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL) {
-		packet.kind = DDPROTO_PACKET_CONTROL;
-		size_t size = ddproto_decode_control(packet.payload, packet.payload_len, &packet.control, err); // NOLINT(clang-analyzer-unix.Malloc)
-		packet.header.token = ddproto_read_token(packet.payload + size);
-	} else {
-		packet.kind = DDPROTO_PACKET_NORMAL;
-		Context ctx = {
-			.chunks = malloc(sizeof(DDProtoChunk) * packet.header.num_chunks),
-			.len = 0,
-		};
-		DDProtoError chunk_err = DDPROTO_ERR_NONE;
-		size_t size = ddproto_fetch_chunks(packet.payload, packet.payload_len, &packet.header, on_chunk, &ctx, &chunk_err);
-		size_t space = packet.payload_len - size;
-		if(chunk_err != DDPROTO_ERR_NONE) {
+	// the payload is owned by the packet so its strings are sanitized where
+	// they are
+	DDProtoStringBuffer strings = {
+		.buf = payload,
+		.len = packet.payload_len,
+		.capacity = payload_size,
+	};
+	memory.options.strings = &strings;
+	if(!control) {
+		memory.chunks = packet_alloc(&memory, sizeof(DDProtoChunk) * packet.header.num_chunks);
+		if(!memory.chunks && packet.header.num_chunks) {
 			if(err) {
-				*err = chunk_err;
+				*err = DDPROTO_ERR_OUT_OF_MEMORY;
 			}
 
 			return packet;
 		}
+	}
+	return decode_payload(packet, &memory, err);
+}
 
-		packet.chunks.data = ctx.chunks;
-		packet.chunks.len = ctx.len;
+DDProtoPacket ddproto_decode_packet(const uint8_t *buf, size_t len, DDProtoError *err) {
+	return decode_packet(buf, len, NULL, NULL, err);
+}
 
-		// missing ddnet security token
-		// this is an error in the ddnet protocol
-		// but expected in the teeworlds protocol
-		//
-		// because pure teeworlds is not in scope we throw an error
-		// https://github.com/MilkeeyCat/ddnet_protocol/issues/48
-		if(space < sizeof(DDProtoToken)) {
-			if(err) {
-				*err = DDPROTO_ERR_MISSING_DDNET_SECURITY_TOKEN;
-			}
+DDProtoPacket ddproto_decode_packet_with_allocator(const uint8_t *buf, size_t len, DDProtoAllocator *allocator, DDProtoError *err) {
+	return decode_packet(buf, len, NULL, allocator, err);
+}
 
-			return packet;
+DDProtoPacket ddproto_decode_packet_arena(const uint8_t *buf, size_t len, DDProtoArena *arena, DDProtoError *err) {
+	return decode_packet(buf, len, arena, NULL, err);
+}
+
+DDProtoPacket ddproto_decode_packet_into(const uint8_t *buf, size_t len, DDProtoPacketStorage *storage, DDProtoError *err) {
+	DDProtoPacket packet = {};
+
+	if(len < DDPROTO_PACKET_HEADER_SIZE || len > DDPROTO_MAX_PACKET_SIZE) {
+		if(err) {
+			*err = DDPROTO_ERR_INVALID_PACKET;
 		}
 
-		if(space > sizeof(DDProtoToken)) {
-			// we did already parse the expected amount of chunks
-			// and the ddnet security token
-			// but there are still bytes left!
+		return packet;
+	}
+
+	packet.header = ddproto_decode_packet_header(buf);
+	bool control = packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL;
+	if(!control && packet.header.num_chunks > storage->chunks_capacity) {
+		packet.kind = DDPROTO_PACKET_NORMAL;
+		if(err) {
+			*err = DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
+		}
+
+		return packet;
+	}
+
+	if(storage->snapshots) {
+		storage->snapshots->items_len = 0;
+		storage->snapshots->removed_keys_len = 0;
+	}
+	// the payload of uncompressed packets is not used so the strings of the
+	// datagram are sanitized into it
+	DDProtoStringBuffer strings = {
+		.buf = storage->payload,
+		.len = 0,
+		.capacity = sizeof(storage->payload),
+	};
+	PacketMemory memory = {
+		.chunks = storage->chunks,
+		.options = {
+			.strings = &strings,
+			.snap_storage = storage->snapshots,
+			.kinds = storage->kinds,
+		},
+	};
+
+	if(!(packet.header.flags & DDPROTO_PACKET_FLAG_COMPRESSION)) {
+		// the payload is used right where it is in the datagram
+		packet.payload = buf + DDPROTO_PACKET_HEADER_SIZE;
+		packet.payload_len = len - DDPROTO_PACKET_HEADER_SIZE;
+		return decode_payload(packet, &memory, err);
+	}
+
+	packet.payload = storage->payload;
+	DDProtoError payload_err = DDPROTO_ERR_NONE;
+	packet.payload_len = ddproto_get_packet_payload(&packet.header, buf, len, storage->payload, sizeof(storage->payload), &payload_err);
+	if(payload_err != DDPROTO_ERR_NONE) {
+		if(err) {
+			*err = payload_err;
+		}
+		return packet;
+	}
+	strings.len = packet.payload_len;
+	return decode_payload(packet, &memory, err);
+}
+
+DDProtoLazyPacket ddproto_decode_packet_lazy(const uint8_t *buf, size_t len, DDProtoLazyPacketStorage *storage, DDProtoError *err) {
+	DDProtoLazyPacket packet = {};
+
+	if(len < DDPROTO_PACKET_HEADER_SIZE || len > DDPROTO_MAX_PACKET_SIZE) {
+		if(err) {
+			*err = DDPROTO_ERR_INVALID_PACKET;
+		}
+
+		return packet;
+	}
+
+	packet.header = ddproto_decode_packet_header(buf);
+	storage->strings.buf = storage->payload;
+	storage->strings.len = 0;
+	storage->strings.capacity = sizeof(storage->payload);
+	if(packet.header.flags & DDPROTO_PACKET_FLAG_COMPRESSION) {
+		packet.payload = storage->payload;
+		DDProtoError payload_err = DDPROTO_ERR_NONE;
+		packet.payload_len = ddproto_get_packet_payload(&packet.header, buf, len, storage->payload, sizeof(storage->payload), &payload_err);
+		if(payload_err != DDPROTO_ERR_NONE) {
 			if(err) {
-				*err = DDPROTO_ERR_REMAINING_BYTES_IN_BUFFER;
+				*err = payload_err;
 			}
-
 			return packet;
 		}
+		storage->strings.len = packet.payload_len;
+	} else {
+		packet.payload = buf + DDPROTO_PACKET_HEADER_SIZE;
+		packet.payload_len = len - DDPROTO_PACKET_HEADER_SIZE;
+	}
 
+	if(packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL) {
+		packet.kind = DDPROTO_PACKET_CONTROL;
+		size_t size = ddproto_decode_control(packet.payload, packet.payload_len, &packet.control, err);
 		packet.header.token = ddproto_read_token(packet.payload + size);
+		return packet;
+	}
+
+	packet.kind = DDPROTO_PACKET_NORMAL;
+	DDProtoError chunk_err = DDPROTO_ERR_NONE;
+	size_t size = ddproto_index_chunks(packet.payload, packet.payload_len, &packet.header, storage->chunks, storage->chunks_capacity, &chunk_err);
+	if(chunk_err != DDPROTO_ERR_NONE) {
+		if(err) {
+			*err = chunk_err;
+		}
+
+		return packet;
 	}
 
+	for(size_t i = 0; i < packet.header.num_chunks; i++) {
+		storage->chunks[i].strings = &storage->strings;
+	}
+	packet.chunks.data = storage->chunks;
+	packet.chunks.len = packet.header.num_chunks;
+	read_payload_token(&packet.header, packet.payload, packet.payload_len, size, err);
 	return packet;
 }
 
-size_t ddproto_encode_packet(const DDProtoPacket *packet, uint8_t *buf, size_t len, DDProtoError *err) {
+DDProtoPacketHeader ddproto_decode_packet_records(const uint8_t *buf, size_t len, DDProtoMessageRecords *records, DDProtoError *err) {
+	DDProtoPacket packet = {};
+
+	if(len < DDPROTO_PACKET_HEADER_SIZE || len > DDPROTO_MAX_PACKET_SIZE) {
+		if(err) {
+			*err = DDPROTO_ERR_INVALID_PACKET;
+		}
+
+		return packet.header;
+	}
+
+	packet.header = ddproto_decode_packet_header(buf);
+	if(packet.header.flags & DDPROTO_PACKET_FLAG_CONTROL) {
+		return packet.header;
+	}
+
+	// the decompressed payload or the sanitized strings only have to live
+	// until they are copied into their records
+	uint8_t payload[DDPROTO_MAX_PACKET_SIZE];
+	DDProtoStringBuffer strings = {
+		.buf = payload,
+		.len = 0,
+		.capacity = sizeof(payload),
+	};
+	PacketMemory memory = {
+		.options = {.strings = &strings},
+		.records = records,
+	};
+	const size_t records_len = records->len;
+	const size_t records_count = records->count;
+	DDProtoError decode_err = DDPROTO_ERR_NONE;
+	if(packet.header.flags & DDPROTO_PACKET_FLAG_COMPRESSION) {
+		packet.payload = payload;
+		packet.payload_len = ddproto_get_packet_payload(&packet.header, buf, len, payload, sizeof(payload), &decode_err);
+		strings.len = packet.payload_len;
+	} else {
+		packet.payload = buf + DDPROTO_PACKET_HEADER_SIZE;
+		packet.payload_len = len - DDPROTO_PACKET_HEADER_SIZE;
+	}
+	if(decode_err == DDPROTO_ERR_NONE) {
+		packet = decode_payload(packet, &memory, &decode_err);
+	}
+
+	if(decode_err != DDPROTO_ERR_NONE) {
+		records->len = records_len;
+		records->count = records_count;
+		if(err) {
+			*err = decode_err;
+		}
+	}
+	return packet.header;
+}
+
+// compresses the payload that is already written to `payload` in place
+static size_t compress_payload(uint8_t *payload, size_t payload_len, size_t capacity, DDProtoError *err) {
+	uint8_t uncompressed[DDPROTO_MAX_PACKET_SIZE];
+	if(payload_len > sizeof(uncompressed)) {
+		*err = DDPROTO_ERR_BUFFER_FULL;
+		return 0;
+	}
+	memcpy(uncompressed, payload, payload_len);
+
+	DDProtoError compress_err = DDPROTO_ERR_NONE;
+	size_t size = ddproto_huffman_compress(uncompressed, payload_len, payload, capacity, &compress_err);
+	if(compress_err != DDPROTO_ERR_NONE) {
+		*err = compress_err;
+		return 0;
+	}
+	return size;
+}
+
+size_t ddproto_encode_packet_with_compression(const DDProtoPacket *packet, uint8_t *buf, size_t len, DDProtoCompression compression, DDProtoError *err) {
 	if(len < DDPROTO_PACKET_HEADER_SIZE) {
 		*err = DDPROTO_ERR_BUFFER_FULL;
 		return 0;
 	}
 
 	uint8_t *start = buf;
+	const uint8_t *end = start + len;
 	ddproto_encode_packet_header(&packet->header, buf);
 	buf += DDPROTO_PACKET_HEADER_SIZE;
 
 	switch(packet->kind) {
 	case DDPROTO_PACKET_NORMAL:
-		for(size_t i = 0; i < packet->chunks.len; i++) {
-			buf += ddproto_encode_chunk_header(&packet->chunks.data[i].header, buf);
-			buf += ddproto_encode_message(&packet->chunks.data[i], buf, err);
+		break;
+	case DDPROTO_PACKET_CONTROL: {
+		// the size of the control message is only known once it is encoded
+		uint8_t control[1 + DDPROTO_PACKER_BUFFER_SIZE];
+		size_t control_size = ddproto_encode_control(&packet->control, control, err);
+		if((size_t)(end - buf) < control_size + sizeof(DDProtoToken)) {
+			*err = DDPROTO_ERR_BUFFER_FULL;
+			return 0;
 		}
+		memcpy(buf, control, control_size);
+		buf += control_size;
 		ddproto_write_token(packet->header.token, buf);
 		buf += sizeof(DDProtoToken);
 		return buf - start;
-	case DDPROTO_PACKET_CONTROL:
-		buf += ddproto_encode_control(&packet->control, buf, err);
-		ddproto_write_token(packet->header.token, buf);
-		buf += sizeof(DDProtoToken);
-		return buf - start;
+	}
 	case DDPROTO_PACKET_CONNLESS:
-		break;
+		*err = DDPROTO_ERR_INVALID_PACKET;
+		return 0;
+	}
+
+	uint8_t *payload = buf;
+	for(size_t i = 0; i < packet->chunks.len; i++) {
+		// the message is packed right behind the space for its chunk header
+		// and the header is written once its size is known
+		DDProtoChunkHeader header = packet->chunks.data[i].header;
+		size_t header_size = header.flags & DDPROTO_CHUNK_FLAG_VITAL ? 3 : 2;
+		if((size_t)(end - buf) < header_size) {
+			*err = DDPROTO_ERR_BUFFER_FULL;
+			return 0;
+		}
+
+		DDProtoError msg_err = DDPROTO_ERR_NONE;
+		header.size = ddproto_encode_message_buf(&packet->chunks.data[i], buf + header_size, end - buf - header_size, &msg_err);
+		if(msg_err != DDPROTO_ERR_NONE) {
+			*err = msg_err;
+			return 0;
+		}
+		buf += ddproto_encode_chunk_header(&header, buf);
+		buf += header.size;
+	}
+
+	// the token is part of the compressed data
+	if((size_t)(end - buf) < sizeof(DDProtoToken)) {
+		*err = DDPROTO_ERR_BUFFER_FULL;
+		return 0;
+	}
+	ddproto_write_token(packet->header.token, buf);
+	buf += sizeof(DDProtoToken);
+	size_t payload_len = buf - payload;
+
+	bool compress = compression == DDPROTO_COMPRESSION_ALWAYS;
+	if(compression == DDPROTO_COMPRESSION_AUTO) {
+		compress = ddproto_huffman_compressed_size(ddproto_huffman_default(), payload, payload_len) < payload_len;
 	}
 
-	*err = DDPROTO_ERR_INVALID_PACKET;
-	return 0;
+	DDProtoPacketHeader header = packet->header;
+	header.flags &= ~DDPROTO_PACKET_FLAG_COMPRESSION;
+	if(compress) {
+		payload_len = compress_payload(payload, payload_len, len - DDPROTO_PACKET_HEADER_SIZE, err);
+		if(payload_len == 0) {
+			return 0;
+		}
+		header.flags |= DDPROTO_PACKET_FLAG_COMPRESSION;
+	}
+	ddproto_encode_packet_header(&header, start);
+	return DDPROTO_PACKET_HEADER_SIZE + payload_len;
 }
 
-DDProtoError ddproto_build_packet(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session) {
+size_t ddproto_encode_packet(const DDProtoPacket *packet, uint8_t *buf, size_t len, DDProtoError *err) {
+	DDProtoCompression compression = DDPROTO_COMPRESSION_NEVER;
+	if(packet->kind == DDPROTO_PACKET_NORMAL && packet->header.flags & DDPROTO_PACKET_FLAG_COMPRESSION) {
+		compression = DDPROTO_COMPRESSION_ALWAYS;
+	}
+	return ddproto_encode_packet_with_compression(packet, buf, len, compression, err);
+}
+
+// builds a packet with chunks allocated from `arena` or from the allocator if
+// it is `NULL`
+static DDProtoError build_packet(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session, DDProtoArena *arena) {
 	packet->kind = DDPROTO_PACKET_NORMAL;
 	packet->header.flags = 0;
 	packet->header.token = session->token;
 	packet->header.ack = session->ack;
 	packet->header.num_chunks = messages_len;
 	packet->chunks.len = messages_len;
-	packet->chunks.data = malloc(sizeof(DDProtoChunk) * messages_len);
+	packet->allocator = NULL;
+	const PacketMemory memory = {.options = {.arena = arena}};
+	packet->chunks.data = packet_alloc(&memory, sizeof(DDProtoChunk) * messages_len);
+	if(!packet->chunks.data && messages_len) {
+		packet->chunks.len = 0;
+		return DDPROTO_ERR_OUT_OF_MEMORY;
+	}
 	for(uint8_t i = 0; i < messages_len; i++) {
 		const DDProtoMessage *msg = &messages[i];
 		packet->chunks.data[i].payload.kind = msg->kind;
@@ -181,6 +544,14 @@ DDProtoError ddproto_build_packet(DDProtoPacket *packet, const DDProtoMessage me
 	return DDPROTO_ERR_NONE;
 }
 
+DDProtoError ddproto_build_packet(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session) {
+	return build_packet(packet, messages, messages_len, session, NULL);
+}
+
+DDProtoError ddproto_build_packet_arena(DDProtoPacket *packet, const DDProtoMessage messages[], uint8_t messages_len, DDProtoSession *session, DDProtoArena *arena) {
+	return build_packet(packet, messages, messages_len, session, arena);
+}
+
 DDProtoError ddproto_free_packet(DDProtoPacket *packet) {
 	if(packet->kind == DDPROTO_PACKET_NORMAL) {
 		for(size_t i = 0; i < packet->chunks.len; i++) {
@@ -190,11 +561,13 @@ DDProtoError ddproto_free_packet(DDProtoPacket *packet) {
 				ddproto_free_snapshot(snap);
 			}
 		}
-		free(packet->chunks.data);
+		ddproto_free(packet->allocator, packet->chunks.data);
 		packet->chunks.data = NULL;
 		packet->chunks.len = 0;
 	}
-	free(packet->payload);
+	// only the payloads of ddproto_decode_packet_into are borrowed and those
+	// packets are never freed
+	ddproto_free(packet->allocator, (void *)packet->payload);
 	packet->payload = NULL;
 	packet->payload_len = 0;
 
@@ -1,18 +1,27 @@
 #include <ddnet_protocol/snapshot.h>
 
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/arena.h>
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/int_string.h>
 #include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/string_table.h>
 
-DDProtoError ddproto_unpack_int_array_as_str(DDProtoUnpacker *unpacker, size_t num_ints, char *str, size_t str_len) {
-	uint32_t ints[6] = {};
-	for(size_t i = 0; i < num_ints; i++) {
-		ints[i] = ddproto_unpacker_get_int(unpacker);
-		if(unpacker->err != DDPROTO_ERR_NONE) {
-			return unpacker->err;
-		}
+// unpacks a string of a snap item into `str` or into the string table of the
+// unpacker. Then only the id of the string is written to `id` which shares
+// its memory with `str`
+static DDProtoError snap_item_get_string(DDProtoUnpacker *unpacker, size_t num_ints, char *str, size_t str_len, uint32_t *id) {
+	const DDProtoDecodeOptions *options = unpacker->options;
+	if(!options->string_table) {
+		return ddproto_unpacker_get_int_string(unpacker, num_ints, str, str_len);
+	}
+
+	uint32_t ints[DDPROTO_STRING_TABLE_MAX_INTS];
+	if(ddproto_unpacker_get_ints(unpacker, (int32_t *)ints, num_ints) != DDPROTO_ERR_NONE) {
+		return unpacker->err;
 	}
-	return ddproto_ints_to_str(ints, num_ints, str, str_len);
+	*id = ddproto_string_table_intern(options->string_table, ints, num_ints, options->validate_utf8, &unpacker->err);
+	return unpacker->err;
 }
 
 DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem *item) {
@@ -40,11 +49,8 @@ DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem
 		break;
 	case DDPROTO_ITEM_LASER:
 		item->kind = DDPROTO_ITEM_KIND_LASER;
-		item->item.laser.x = ddproto_unpacker_get_int(unpacker);
-		item->item.laser.y = ddproto_unpacker_get_int(unpacker);
-		item->item.laser.from_x = ddproto_unpacker_get_int(unpacker);
-		item->item.laser.from_y = ddproto_unpacker_get_int(unpacker);
-		item->item.laser.start_tick = ddproto_unpacker_get_int(unpacker);
+		// all fields after the id are consecutive integers
+		ddproto_unpacker_get_ints(unpacker, &item->item.laser.x, 5);
 		break;
 	case DDPROTO_ITEM_PICKUP:
 		item->kind = DDPROTO_ITEM_KIND_PICKUP;
@@ -79,28 +85,10 @@ DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem
 		break;
 	case DDPROTO_ITEM_CHARACTER:
 		item->kind = DDPROTO_ITEM_KIND_CHARACTER;
-		item->item.character.core.tick = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.x = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.y = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.vel_x = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.vel_y = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.angle = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.direction = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.jumped = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hooked_player = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_state = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_tick = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_x = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_y = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_dx = ddproto_unpacker_get_int(unpacker);
-		item->item.character.core.hook_dy = ddproto_unpacker_get_int(unpacker);
-		item->item.character.player_flags = ddproto_unpacker_get_int(unpacker);
-		item->item.character.health = ddproto_unpacker_get_int(unpacker);
-		item->item.character.armor = ddproto_unpacker_get_int(unpacker);
-		item->item.character.ammo_count = ddproto_unpacker_get_int(unpacker);
-		item->item.character.weapon = ddproto_unpacker_get_int(unpacker);
-		item->item.character.emote = ddproto_unpacker_get_int(unpacker);
-		item->item.character.attack_tick = ddproto_unpacker_get_int(unpacker);
+		// the core without its type and id are 15 consecutive integers and so
+		// are the 7 fields after it
+		ddproto_unpacker_get_ints(unpacker, &item->item.character.core.tick, 15);
+		ddproto_unpacker_get_ints(unpacker, &item->item.character.player_flags, 7);
 		break;
 	case DDPROTO_ITEM_PLAYER_INFO:
 		item->kind = DDPROTO_ITEM_KIND_PLAYER_INFO;
@@ -112,16 +100,17 @@ DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem
 		break;
 	case DDPROTO_ITEM_CLIENT_INFO:
 		item->kind = DDPROTO_ITEM_KIND_CLIENT_INFO;
-		err = ddproto_unpack_int_array_as_str(unpacker, 4, item->item.client_info.name, sizeof(item->item.client_info.name));
+		item->item.client_info.interned = unpacker->options->string_table != NULL;
+		err = snap_item_get_string(unpacker, 4, item->item.client_info.name, sizeof(item->item.client_info.name), &item->item.client_info.name_id);
 		if(err != DDPROTO_ERR_NONE) {
 			return err;
 		}
-		err = ddproto_unpack_int_array_as_str(unpacker, 3, item->item.client_info.clan, sizeof(item->item.client_info.clan));
+		err = snap_item_get_string(unpacker, 3, item->item.client_info.clan, sizeof(item->item.client_info.clan), &item->item.client_info.clan_id);
 		if(err != DDPROTO_ERR_NONE) {
 			return err;
 		}
 		item->item.client_info.country = ddproto_unpacker_get_int(unpacker);
-		err = ddproto_unpack_int_array_as_str(unpacker, 6, item->item.client_info.skin, sizeof(item->item.client_info.skin));
+		err = snap_item_get_string(unpacker, 6, item->item.client_info.skin, sizeof(item->item.client_info.skin), &item->item.client_info.skin_id);
 		if(err != DDPROTO_ERR_NONE) {
 			return err;
 		}
@@ -177,18 +166,12 @@ DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem
 		item->kind = DDPROTO_ITEM_KIND_UNKNOWN;
 		int32_t len = ddproto_unpacker_get_int(unpacker);
 		item->item.unknown.size = len;
-		item->item.unknown.data = unpacker->buf;
 
-		// skip over the integers but don't read their values we already point
+		// skip over the integers but don't read their values we only point
 		// into the raw data
-		for(int32_t i = 0; i < len; i++) {
-			ddproto_unpacker_get_int(unpacker);
-			if(unpacker->err != DDPROTO_ERR_NONE) {
-				return unpacker->err;
-			}
-		}
-
-		item->item.unknown.data_len = unpacker->buf - item->item.unknown.data;
+		size_t data_len = 0;
+		item->item.unknown.data = ddproto_unpacker_get_raw_ints(unpacker, len > 0 ? len : 0, &data_len);
+		item->item.unknown.data_len = data_len;
 		break;
 	}
 
@@ -200,15 +183,27 @@ DDProtoError ddproto_decode_snap_item(DDProtoUnpacker *unpacker, DDProtoSnapItem
 }
 
 void ddproto_free_snapshot(DDProtoSnapshot *snap) {
-	free(snap->items.data);
-	free(snap->removed_keys.data);
+	ddproto_free(snap->allocator, snap->items.data);
+	ddproto_free(snap->allocator, snap->removed_keys.data);
 	snap->items.data = NULL;
 	snap->items.len = 0;
 	snap->removed_keys.data = NULL;
 	snap->removed_keys.len = 0;
 }
 
+// allocates memory for a snapshot from the arena of the unpacker or from its
+// allocator if it has none
+static void *snapshot_alloc(DDProtoUnpacker *unpacker, size_t size) {
+	const DDProtoDecodeOptions *options = unpacker->options;
+	void *ptr = options->arena ? ddproto_arena_alloc(options->arena, size) : ddproto_alloc(options->allocator, size);
+	if(!ptr) {
+		unpacker->err = DDPROTO_ERR_OUT_OF_MEMORY;
+	}
+	return ptr;
+}
+
 DDProtoError ddproto_decode_snapshot(DDProtoUnpacker *unpacker, DDProtoSnapshot *snap) {
+	snap->allocator = unpacker->options->allocator;
 	snap->removed_keys.len = ddproto_unpacker_get_int(unpacker);
 	if(!snap->removed_keys.len) {
 		snap->removed_keys.data = NULL;
@@ -225,11 +220,37 @@ DDProtoError ddproto_decode_snapshot(DDProtoUnpacker *unpacker, DDProtoSnapshot
 		return unpacker->err;
 	}
 
+	DDProtoSnapshotStorage *storage = unpacker->options->snap_storage;
+	if(storage) {
+		if(storage->removed_keys_capacity - storage->removed_keys_len < snap->removed_keys.len || storage->items_capacity - storage->items_len < snap->items.len) {
+			snap->removed_keys.data = NULL;
+			snap->removed_keys.len = 0;
+			snap->items.data = NULL;
+			snap->items.len = 0;
+			unpacker->err = DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
+			return unpacker->err;
+		}
+		if(snap->removed_keys.len) {
+			snap->removed_keys.data = storage->removed_keys + storage->removed_keys_len;
+			storage->removed_keys_len += snap->removed_keys.len;
+		}
+		if(snap->items.len) {
+			snap->items.data = storage->items + storage->items_len;
+			storage->items_len += snap->items.len;
+		}
+	}
+
 	if(snap->removed_keys.len) {
-		snap->removed_keys.data = malloc(sizeof(int32_t) * snap->removed_keys.len);
-		for(int32_t i = 0; i < snap->removed_keys.len; i++) {
-			snap->removed_keys.data[i] = ddproto_unpacker_get_int(unpacker);
+		if(!storage) {
+			snap->removed_keys.data = snapshot_alloc(unpacker, sizeof(int32_t) * snap->removed_keys.len);
+			if(!snap->removed_keys.data) {
+				snap->removed_keys.len = 0;
+				snap->items.data = NULL;
+				snap->items.len = 0;
+				return unpacker->err;
+			}
 		}
+		ddproto_unpacker_get_ints(unpacker, snap->removed_keys.data, snap->removed_keys.len);
 	}
 
 	if(unpacker->err != DDPROTO_ERR_NONE) {
@@ -240,7 +261,13 @@ DDProtoError ddproto_decode_snapshot(DDProtoUnpacker *unpacker, DDProtoSnapshot
 		return DDPROTO_ERR_NONE;
 	}
 
-	snap->items.data = malloc(sizeof(DDProtoSnapItem) * snap->items.len);
+	if(!storage) {
+		snap->items.data = snapshot_alloc(unpacker, sizeof(DDProtoSnapItem) * snap->items.len);
+		if(!snap->items.data) {
+			snap->items.len = 0;
+			return unpacker->err;
+		}
+	}
 	for(size_t i = 0; i < snap->items.len; i++) {
 		DDProtoSnapItem *item = &snap->items.data[i];
 		DDProtoError err = ddproto_decode_snap_item(unpacker, item);
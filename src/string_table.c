@@ -0,0 +1,163 @@
+#include <ddnet_protocol/string_table.h>
+
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/common.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/int_string.h>
+
+void ddproto_string_table_init(DDProtoStringTable *table) {
+	table->entries = NULL;
+	table->len = 0;
+	table->capacity = 0;
+	table->max_len = DDPROTO_STRING_TABLE_MAX_LEN;
+	table->slots = NULL;
+	table->num_slots = 0;
+}
+
+void ddproto_string_table_free(DDProtoStringTable *table) {
+	ddproto_free(NULL, table->entries);
+	ddproto_free(NULL, table->slots);
+	ddproto_string_table_init(table);
+}
+
+void ddproto_string_table_clear(DDProtoStringTable *table) {
+	table->len = 0;
+	if(table->slots) {
+		memset(table->slots, 0, sizeof(uint32_t) * table->num_slots);
+	}
+}
+
+static uint32_t string_table_hash(const uint32_t *ints, size_t num_ints) {
+	// the integers are combined cheaply and mixed once at the end with the
+	// finalizer of murmur3. The strings often only differ in a few bits
+	uint32_t hash = num_ints;
+	for(size_t i = 0; i < num_ints; i++) {
+		hash = ((hash << 5) | (hash >> 27)) ^ ints[i];
+	}
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6b;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35;
+	return hash ^ (hash >> 16);
+}
+
+static bool string_table_entry_matches(const DDProtoStringTableEntry *entry, const uint32_t *ints, size_t num_ints) {
+	if(entry->num_ints != num_ints) {
+		return false;
+	}
+	for(size_t i = 0; i < num_ints; i++) {
+		if(entry->ints[i] != ints[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// index of the slot that holds the id of the string packed into `ints` or of
+// the empty slot it would be added to
+static size_t string_table_find_slot(const DDProtoStringTable *table, const uint32_t *ints, size_t num_ints) {
+	const size_t mask = table->num_slots - 1;
+	size_t slot = string_table_hash(ints, num_ints) & mask;
+	while(table->slots[slot] && !string_table_entry_matches(&table->entries[table->slots[slot] - 1], ints, num_ints)) {
+		slot = (slot + 1) & mask;
+	}
+	return slot;
+}
+
+// doubles the capacity of the table up to `max_len`. There are at least twice
+// as many slots as entries so the probe sequences stay short
+static bool string_table_grow(DDProtoStringTable *table) {
+	size_t capacity = table->capacity ? table->capacity * 2 : 64;
+	if(capacity > table->max_len) {
+		capacity = table->max_len;
+	}
+	size_t num_slots = 2;
+	while(num_slots < capacity * 2) {
+		num_slots *= 2;
+	}
+
+	DDProtoStringTableEntry *entries = ddproto_alloc(NULL, sizeof(DDProtoStringTableEntry) * capacity);
+	uint32_t *slots = ddproto_alloc(NULL, sizeof(uint32_t) * num_slots);
+	if(!entries || !slots) {
+		ddproto_free(NULL, entries);
+		ddproto_free(NULL, slots);
+		return false;
+	}
+
+	if(table->len) {
+		memcpy(entries, table->entries, sizeof(DDProtoStringTableEntry) * table->len);
+	}
+	memset(slots, 0, sizeof(uint32_t) * num_slots);
+	ddproto_free(NULL, table->entries);
+	ddproto_free(NULL, table->slots);
+	table->entries = entries;
+	table->capacity = capacity;
+	table->slots = slots;
+	table->num_slots = num_slots;
+
+	for(size_t i = 0; i < table->len; i++) {
+		table->slots[string_table_find_slot(table, entries[i].ints, entries[i].num_ints)] = i + 1;
+	}
+	return true;
+}
+
+uint32_t ddproto_string_table_intern(DDProtoStringTable *table, const uint32_t *ints, size_t num_ints, bool validate_utf8, DDProtoError *err) {
+	if(num_ints > DDPROTO_STRING_TABLE_MAX_INTS) {
+		if(err) {
+			*err = DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL;
+		}
+
+		return 0;
+	}
+
+	size_t slot = 0;
+	if(table->num_slots) {
+		slot = string_table_find_slot(table, ints, num_ints);
+	}
+	if(!table->num_slots || !table->slots[slot]) {
+		if(table->len >= table->max_len) {
+			if(err) {
+				*err = DDPROTO_ERR_STRING_TABLE_FULL;
+			}
+
+			return 0;
+		}
+		if(table->len == table->capacity) {
+			if(!string_table_grow(table)) {
+				if(err) {
+					*err = DDPROTO_ERR_OUT_OF_MEMORY;
+				}
+
+				return 0;
+			}
+			slot = string_table_find_slot(table, ints, num_ints);
+		}
+
+		DDProtoStringTableEntry *entry = &table->entries[table->len];
+		memcpy(entry->ints, ints, num_ints * sizeof(uint32_t));
+		entry->num_ints = num_ints;
+		entry->str[0] = '\0';
+		if(num_ints) {
+			ddproto_ints_to_str(ints, num_ints, entry->str, sizeof(entry->str));
+		}
+		entry->valid_utf8 = ddproto_str_is_utf8(entry->str, strlen(entry->str));
+		table->slots[slot] = ++table->len;
+	}
+
+	const uint32_t id = table->slots[slot];
+	if(validate_utf8 && !table->entries[id - 1].valid_utf8) {
+		if(err) {
+			*err = DDPROTO_ERR_INVALID_UTF8;
+		}
+
+		return 0;
+	}
+	return id;
+}
+
+const char *ddproto_string_table_str(const DDProtoStringTable *table, uint32_t id) {
+	if(!id) {
+		return "";
+	}
+	return table->entries[id - 1].str;
+}
@@ -0,0 +1,136 @@
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/arena.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/msg_system.h>
+#include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/snapshot.h>
+#include <ddnet_protocol/string_table.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+
+#include "snap_packet.h"
+
+// counts the bytes that are still allocated in `ctx`
+struct LiveBytes {
+	size_t bytes = 0;
+};
+
+static void *counting_alloc(void *ctx, size_t size) {
+	size_t *mem = (size_t *)malloc(sizeof(size_t) + size);
+	*mem = size;
+	((LiveBytes *)ctx)->bytes += size;
+	return mem + 1;
+}
+
+static void counting_free(void *ctx, void *ptr) {
+	size_t *mem = (size_t *)ptr - 1;
+	((LiveBytes *)ctx)->bytes -= *mem;
+	free(mem);
+}
+
+TEST(Allocator, DecodePacket) {
+	LiveBytes live;
+	DDProtoAllocator allocator = {.alloc = counting_alloc, .free = counting_free, .ctx = &live};
+	const DDProtoAllocator global = *ddproto_allocator();
+
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .compression = compression});
+
+		allocator.alloc_calls = 0;
+		allocator.alloc_bytes = 0;
+		allocator.free_calls = 0;
+		DDProtoError err = DDPROTO_ERR_NONE;
+		DDProtoPacket packet = ddproto_decode_packet_with_allocator(bytes, len, &allocator, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+		ASSERT_EQ(packet.chunks.len, 1);
+		EXPECT_EQ(packet.allocator, &allocator);
+		EXPECT_EQ(packet.chunks.data[0].payload.msg.snap_single.snapshot.items.data[1].item.pickup.id, 1);
+
+		// the chunks, the removed keys, the items and the copy of the payload
+		const size_t calls = 4;
+		EXPECT_EQ(allocator.alloc_calls, calls);
+		EXPECT_EQ(allocator.alloc_bytes, live.bytes);
+		EXPECT_GT(live.bytes, sizeof(DDProtoChunk) + 2 * sizeof(DDProtoSnapItem));
+
+		ddproto_free_packet(&packet);
+		EXPECT_EQ(allocator.free_calls, calls);
+		EXPECT_EQ(live.bytes, 0);
+	}
+
+	// nothing went through the global allocator
+	EXPECT_EQ(ddproto_allocator()->alloc_calls, global.alloc_calls);
+	EXPECT_EQ(ddproto_allocator()->free_calls, global.free_calls);
+}
+
+TEST(Allocator, SetGlobal) {
+	EXPECT_EQ(ddproto_allocator(), ddproto_default_allocator());
+
+	LiveBytes live;
+	DDProtoAllocator allocator = {.alloc = counting_alloc, .free = counting_free, .ctx = &live};
+	ddproto_set_allocator(&allocator);
+	EXPECT_EQ(ddproto_allocator(), &allocator);
+
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+	uint32_t ints[4] = {0xE1808000, 0x80808080, 0x80808080, 0x80808000};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints, 4, false, &err), 1);
+	EXPECT_EQ(allocator.alloc_calls, 2);
+	EXPECT_GT(live.bytes, 0);
+	ddproto_string_table_free(&table);
+	EXPECT_EQ(allocator.free_calls, 2);
+	EXPECT_EQ(live.bytes, 0);
+
+	uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+	size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .compression = DDPROTO_COMPRESSION_ALWAYS});
+	DDProtoPacket packet = ddproto_decode_packet(bytes, len, &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.allocator, nullptr);
+	EXPECT_EQ(allocator.alloc_calls, 6);
+	ddproto_free_packet(&packet);
+	EXPECT_EQ(live.bytes, 0);
+
+	ddproto_set_allocator(nullptr);
+	EXPECT_EQ(ddproto_allocator(), ddproto_default_allocator());
+}
+
+TEST(Allocator, NoAllocations) {
+	uint8_t compressed[DDPROTO_MAX_PACKET_SIZE];
+	size_t compressed_len = encode_snap_packet(compressed, {.num_snaps = 1, .num_pickups = 2, .compression = DDPROTO_COMPRESSION_ALWAYS});
+
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 0);
+	DDProtoChunk chunks[4];
+	DDProtoSnapItem items[8];
+	int32_t removed_keys[8];
+	DDProtoSnapshotStorage snapshots = {
+		.items = items,
+		.items_capacity = 8,
+		.removed_keys = removed_keys,
+		.removed_keys_capacity = 8,
+	};
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4, .snapshots = &snapshots};
+
+	// the arena allocates its block once
+	DDProtoError err = DDPROTO_ERR_NONE;
+	ddproto_decode_packet_arena(compressed, compressed_len, &arena, &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	ddproto_arena_reset(&arena);
+
+	const DDProtoAllocator global = *ddproto_allocator();
+	for(size_t i = 0; i < 3; i++) {
+		ddproto_decode_packet_arena(compressed, compressed_len, &arena, &err);
+		ddproto_arena_reset(&arena);
+		uint8_t uncompressed[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(uncompressed, {.num_snaps = 1, .num_pickups = 2, .compression = DDPROTO_COMPRESSION_NEVER});
+		ddproto_decode_packet_into(uncompressed, len, &storage, &err);
+		ddproto_decode_packet_into(compressed, compressed_len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	}
+	EXPECT_EQ(ddproto_allocator()->alloc_calls, global.alloc_calls);
+	ddproto_arena_free(&arena);
+}
@@ -0,0 +1,177 @@
+#include <ddnet_protocol/arena.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/msg_system.h>
+#include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/session.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+TEST(Arena, Alloc) {
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 256);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 0);
+
+	uint8_t *first = (uint8_t *)ddproto_arena_alloc(&arena, 3);
+	uint8_t *second = (uint8_t *)ddproto_arena_alloc(&arena, 20);
+	ASSERT_NE(first, nullptr);
+	ASSERT_NE(second, nullptr);
+	EXPECT_EQ((uintptr_t)first % DDPROTO_ARENA_ALIGNMENT, 0);
+	EXPECT_EQ((uintptr_t)second % DDPROTO_ARENA_ALIGNMENT, 0);
+	EXPECT_EQ(second, first + DDPROTO_ARENA_ALIGNMENT);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 256);
+
+	// bigger than a block
+	uint8_t *big = (uint8_t *)ddproto_arena_alloc(&arena, 1008);
+	ASSERT_NE(big, nullptr);
+	memset(big, 0xff, 1008);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 256 + 1008);
+
+	ddproto_arena_free(&arena);
+	EXPECT_EQ(arena.blocks, nullptr);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 0);
+}
+
+TEST(Arena, ResetKeepsCapacity) {
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 64);
+
+	for(size_t i = 0; i < 10; i++) {
+		ASSERT_NE(ddproto_arena_alloc(&arena, 48), nullptr);
+	}
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 640);
+
+	// the blocks are merged into one that fits all allocations of the round
+	ddproto_arena_reset(&arena);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), 640);
+	EXPECT_EQ(arena.blocks->next, nullptr);
+	const DDProtoArenaBlock *block = arena.blocks;
+
+	for(size_t round = 0; round < 3; round++) {
+		for(size_t i = 0; i < 10; i++) {
+			ASSERT_NE(ddproto_arena_alloc(&arena, 48), nullptr);
+		}
+		EXPECT_EQ(arena.blocks, block);
+		EXPECT_EQ(arena.blocks->next, nullptr);
+		ddproto_arena_reset(&arena);
+	}
+
+	ddproto_arena_free(&arena);
+}
+
+TEST(Arena, DecodePacket) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	ddproto_packer_add_int(packer, (DDPROTO_MSG_SNAPSINGLE << 1) | DDPROTO_SYSTEM);
+	ddproto_packer_add_int(packer, 100);
+	ddproto_packer_add_int(packer, 99);
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 0); // removed keys
+	ddproto_packer_add_int(packer, 2); // items
+	ddproto_packer_add_int(packer, 0);
+	for(int32_t id = 0; id < 2; id++) {
+		ddproto_packer_add_int(packer, DDPROTO_ITEM_PICKUP);
+		ddproto_packer_add_int(packer, id);
+		ddproto_packer_add_int(packer, 32);
+		ddproto_packer_add_int(packer, 64);
+		ddproto_packer_add_int(packer, 1);
+		ddproto_packer_add_int(packer, 0);
+	}
+	ASSERT_EQ(packer->err, DDPROTO_ERR_NONE);
+
+	DDProtoMsgUnknown unknown = {.buf = ddproto_packer_data(packer), .len = ddproto_packer_size(packer)};
+	DDProtoPacket packet = {};
+	packet.kind = DDPROTO_PACKET_NORMAL;
+	packet.header = {.flags = 0, .ack = 0, .num_chunks = 1, .token = 0x3de3948d};
+	DDProtoChunk chunk = {};
+	chunk.header = {.flags = 0, .size = (uint16_t)unknown.len, .sequence = 0};
+	chunk.payload.kind = DDPROTO_MSG_KIND_UNKNOWN;
+	chunk.payload.msg.unknown = unknown;
+	packet.chunks.data = &chunk;
+	packet.chunks.len = 1;
+
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 0);
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		DDProtoError err = DDPROTO_ERR_NONE;
+		size_t len = ddproto_encode_packet_with_compression(&packet, bytes, sizeof(bytes), compression, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+
+		for(size_t tick = 0; tick < 3; tick++) {
+			DDProtoPacket decoded = ddproto_decode_packet_arena(bytes, len, &arena, &err);
+			ASSERT_EQ(err, DDPROTO_ERR_NONE);
+			EXPECT_EQ(decoded.header.token, 0x3de3948d);
+			ASSERT_EQ(decoded.chunks.len, 1);
+			ASSERT_EQ(decoded.chunks.data[0].payload.kind, DDPROTO_MSG_KIND_SNAPSINGLE);
+			const DDProtoSnapshot &snap = decoded.chunks.data[0].payload.msg.snap_single.snapshot;
+			ASSERT_EQ(snap.items.len, 2);
+			EXPECT_EQ(snap.items.data[1].item.pickup.id, 1);
+			EXPECT_EQ(snap.items.data[1].item.pickup.y, 64);
+			ddproto_arena_reset(&arena);
+		}
+	}
+	EXPECT_EQ(ddproto_arena_capacity(&arena), DDPROTO_ARENA_DEFAULT_BLOCK_SIZE);
+	ddproto_arena_free(&arena);
+}
+
+TEST(Arena, DecodeSnapshot) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	ddproto_packer_add_int(packer, 2); // removed keys
+	ddproto_packer_add_int(packer, 1); // items
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 7);
+	ddproto_packer_add_int(packer, 8);
+	ddproto_packer_add_int(packer, DDPROTO_ITEM_SOUND_GLOBAL);
+	ddproto_packer_add_int(packer, 3);
+	ddproto_packer_add_int(packer, 320);
+	ddproto_packer_add_int(packer, 640);
+	ddproto_packer_add_int(packer, 12);
+	ASSERT_EQ(packer->err, DDPROTO_ERR_NONE);
+
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 0);
+	DDProtoDecodeOptions options = {.arena = &arena};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	unpacker.options = &options;
+	DDProtoSnapshot snap;
+	ASSERT_EQ(ddproto_decode_snapshot(&unpacker, &snap), DDPROTO_ERR_NONE);
+	ASSERT_EQ(snap.removed_keys.len, 2);
+	EXPECT_EQ(snap.removed_keys.data[1], 8);
+	ASSERT_EQ(snap.items.len, 1);
+	EXPECT_EQ(snap.items.data[0].kind, DDPROTO_ITEM_KIND_SOUND_GLOBAL);
+	EXPECT_EQ(snap.items.data[0].item.sound_global.sound_id, 12);
+
+	// both arrays come out of the only block
+	const uint8_t *block = (const uint8_t *)arena.blocks;
+	EXPECT_EQ(arena.blocks->next, nullptr);
+	EXPECT_GT((const uint8_t *)snap.removed_keys.data, block);
+	EXPECT_LT((const uint8_t *)snap.items.data, block + arena.blocks->size);
+	ddproto_arena_free(&arena);
+}
+
+TEST(Arena, BuildPacket) {
+	DDProtoMessage messages[] = {
+		{.kind = DDPROTO_MSG_KIND_READY},
+		{.kind = DDPROTO_MSG_KIND_ENTERGAME},
+	};
+	DDProtoSession session = {.ack = 5, .sequence = 2, .token = 0x3de3948d};
+
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 0);
+	DDProtoPacket packet;
+	ASSERT_EQ(ddproto_build_packet_arena(&packet, messages, 2, &session, &arena), DDPROTO_ERR_NONE);
+	ASSERT_EQ(packet.chunks.len, 2);
+	EXPECT_EQ(packet.chunks.data[1].payload.kind, DDPROTO_MSG_KIND_ENTERGAME);
+	EXPECT_EQ(packet.chunks.data[1].header.sequence, 4);
+	EXPECT_EQ(session.sequence, 4);
+	EXPECT_EQ(ddproto_arena_capacity(&arena), DDPROTO_ARENA_DEFAULT_BLOCK_SIZE);
+	ddproto_arena_free(&arena);
+}
@@ -92,3 +92,95 @@ TEST(Chunk, BigMessageId) {
 	EXPECT_EQ(ctx.chunks[0].header.size, 6);
 	free(ctx.chunks);
 }
+
+TEST(Chunk, FetchSanitizedString) {
+	// chat message "a\x01b" of client 1
+	const uint8_t bytes[] = {0x40, 0x07, 0x01, 0x06, 0x00, 0x01, 'a', 0x01, 'b', 0x00};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoPacketHeader header = {.num_chunks = 1};
+	DDProtoChunk chunks[1];
+	Context ctx = {.chunks = chunks, .len = 0};
+	EXPECT_EQ(ddproto_fetch_chunks(bytes, sizeof(bytes), &header, on_chunk, &ctx, &err), sizeof(bytes));
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(ctx.len, 1);
+	ASSERT_EQ(chunks[0].payload.kind, DDPROTO_MSG_KIND_SV_CHAT);
+	EXPECT_STREQ(chunks[0].payload.msg.chat.message, "a b");
+	EXPECT_EQ(bytes[7], 0x01);
+}
+
+// message 99, ready and enter game followed by the ddnet security token
+static uint8_t iterator_payload[] = {
+	0x40, 0x06, 0x03, 0x87, 0x03, 0x41, 0x42, 0x43, 0x00,
+	0x40, 0x01, 0x04, 0x1d,
+	0x40, 0x01, 0x05, 0x1f,
+	0x3d, 0xe3, 0x94, 0x8d};
+
+TEST(Chunk, Iterator) {
+	DDProtoPacketHeader header = {.num_chunks = 3};
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, iterator_payload, sizeof(iterator_payload), &header);
+
+	DDProtoChunk chunk;
+	ASSERT_TRUE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_UNKNOWN);
+	EXPECT_EQ(chunk.header.sequence, 3);
+	EXPECT_EQ(iter.raw, iterator_payload);
+	EXPECT_EQ(iter.raw_len, 9);
+
+	ASSERT_TRUE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_READY);
+	EXPECT_EQ(chunk.header.sequence, 4);
+	EXPECT_EQ(iter.raw, iterator_payload + 9);
+	EXPECT_EQ(iter.raw_len, 4);
+
+	DDProtoChunkHeader chunk_header;
+	ASSERT_TRUE(ddproto_chunk_iterator_skip(&iter, &chunk_header));
+	EXPECT_EQ(chunk_header.sequence, 5);
+	EXPECT_EQ(iter.raw, iterator_payload + 13);
+
+	EXPECT_FALSE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_EQ(iter.err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_chunk_iterator_offset(&iter), 17);
+}
+
+TEST(Chunk, IteratorSplice) {
+	DDProtoPacketHeader header = {.num_chunks = 3};
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, iterator_payload, sizeof(iterator_payload), &header);
+
+	// forward everything but the ready message without decoding it
+	uint8_t bytes[DDPROTO_MAX_PACKET_SIZE] = {0x00, 0x00, 0x02};
+	size_t len = DDPROTO_PACKET_HEADER_SIZE;
+	DDProtoChunkHeader chunk_header;
+	while(ddproto_chunk_iterator_skip(&iter, &chunk_header)) {
+		if(chunk_header.sequence != 4) {
+			memcpy(bytes + len, iter.raw, iter.raw_len);
+			len += iter.raw_len;
+		}
+	}
+	ASSERT_EQ(iter.err, DDPROTO_ERR_NONE);
+	memcpy(bytes + len, iterator_payload + ddproto_chunk_iterator_offset(&iter), sizeof(DDProtoToken));
+	len += sizeof(DDProtoToken);
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoPacket packet = ddproto_decode_packet(bytes, len, &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(packet.chunks.len, 2);
+	EXPECT_EQ(packet.chunks.data[0].payload.kind, DDPROTO_MSG_KIND_UNKNOWN);
+	EXPECT_EQ(packet.chunks.data[1].payload.kind, DDPROTO_MSG_KIND_ENTERGAME);
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+	ddproto_free_packet(&packet);
+}
+
+TEST(Chunk, IteratorTruncated) {
+	DDProtoPacketHeader header = {.num_chunks = 3};
+	DDProtoChunkIterator iter;
+	ddproto_chunk_iterator_init(&iter, iterator_payload, 15, &header);
+
+	DDProtoChunk chunk;
+	EXPECT_TRUE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_TRUE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_FALSE(ddproto_chunk_iterator_next(&iter, &chunk));
+	EXPECT_EQ(iter.err, DDPROTO_ERR_END_OF_BUFFER);
+	EXPECT_FALSE(ddproto_chunk_iterator_next(&iter, &chunk));
+}
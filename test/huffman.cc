@@ -1,7 +1,10 @@
 #include <ddnet_protocol/common.h>
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/huffman.h>
+#include <ddnet_protocol/packer.h>
 
+#include <algorithm>
+#include <cstring>
 #include <gtest/gtest.h>
 
 TEST(Huffman, Decompress) {
@@ -13,3 +16,397 @@ TEST(Huffman, Decompress) {
 	EXPECT_EQ(len, 4);
 	EXPECT_STREQ((const char *)decompressed, "foo");
 }
+
+TEST(Huffman, DecompressReference) {
+	uint8_t decompressed[512];
+	uint8_t compressed[] = {0x74, 0xde, 0x16, 0xd9, 0xa2, 0x8a, 0x1b};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t len = ddproto_huffman_decompress_reference(compressed, sizeof(compressed), decompressed, sizeof(decompressed), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(len, 4);
+	EXPECT_STREQ((const char *)decompressed, "foo");
+}
+
+static uint32_t next_random(uint32_t *state) {
+	*state = *state * 1103515245 + 12345;
+	return *state >> 16;
+}
+
+static void expect_decoders_match(const uint8_t *input, size_t input_len) {
+	uint8_t compressed[2048];
+	uint8_t fast[2048];
+	uint8_t reference[2048];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t compressed_len = ddproto_huffman_compress(input, input_len, compressed, sizeof(compressed), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+
+	DDProtoError fast_err = DDPROTO_ERR_NONE;
+	DDProtoError reference_err = DDPROTO_ERR_NONE;
+	size_t fast_len = ddproto_huffman_decompress(compressed, compressed_len, fast, sizeof(fast), &fast_err);
+	size_t reference_len = ddproto_huffman_decompress_reference(compressed, compressed_len, reference, sizeof(reference), &reference_err);
+	EXPECT_EQ(fast_err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(reference_err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(fast_len, input_len);
+	ASSERT_EQ(reference_len, input_len);
+	EXPECT_EQ(std::memcmp(fast, input, input_len), 0);
+	EXPECT_EQ(std::memcmp(reference, input, input_len), 0);
+}
+
+TEST(Huffman, MultiSymbolMatchesReferenceAllBytes) {
+	uint8_t input[256];
+	for(size_t i = 0; i < sizeof(input); i++) {
+		input[i] = i;
+	}
+	expect_decoders_match(input, sizeof(input));
+	expect_decoders_match(input, 0);
+	expect_decoders_match(input, 1);
+}
+
+TEST(Huffman, MultiSymbolMatchesReferenceRandom) {
+	uint32_t state = 1337;
+	uint8_t input[1400];
+	for(size_t len = 0; len < sizeof(input); len += 37) {
+		for(size_t i = 0; i < len; i++) {
+			input[i] = next_random(&state);
+		}
+		expect_decoders_match(input, len);
+	}
+}
+
+TEST(Huffman, MultiSymbolMatchesReferenceSnapshotLike) {
+	// packed integers with mostly small values and a lot of zeros
+	// similar to what a snapshot delta looks like
+	uint32_t state = 42;
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	while(ddproto_packer_size(packer) < 1300) {
+		uint32_t rand = next_random(&state);
+		int32_t value = 0;
+		if(rand % 3 == 0) {
+			value = (int32_t)(next_random(&state) % 64) - 32;
+		} else if(rand % 7 == 0) {
+			value = (int32_t)next_random(&state) * 1000;
+		}
+		ddproto_packer_add_int(packer, value);
+	}
+	expect_decoders_match(ddproto_packer_data(packer), ddproto_packer_size(packer));
+}
+
+TEST(Huffman, MultiSymbolTruncated) {
+	uint8_t input[64];
+	uint8_t compressed[128];
+	uint8_t decompressed[128];
+	uint32_t state = 7;
+	for(uint8_t &byte : input) {
+		byte = next_random(&state);
+	}
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t compressed_len = ddproto_huffman_compress(input, sizeof(input), compressed, sizeof(compressed), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+
+	ddproto_huffman_decompress(compressed, compressed_len / 2, decompressed, sizeof(decompressed), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_END_OF_BUFFER);
+}
+
+TEST(Huffman, MultiSymbolBufferFull) {
+	uint8_t input[64] = {};
+	uint8_t compressed[128];
+	uint8_t decompressed[63];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t compressed_len = ddproto_huffman_compress(input, sizeof(input), compressed, sizeof(compressed), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+
+	ddproto_huffman_decompress(compressed, compressed_len, decompressed, sizeof(decompressed), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_BUFFER_FULL);
+}
+
+static void expect_encoders_match(const uint8_t *input, size_t input_len) {
+	uint8_t fast[2048];
+	uint8_t reference[2048];
+	DDProtoError fast_err = DDPROTO_ERR_NONE;
+	DDProtoError reference_err = DDPROTO_ERR_NONE;
+	size_t fast_len = ddproto_huffman_compress(input, input_len, fast, sizeof(fast), &fast_err);
+	size_t reference_len = ddproto_huffman_compress_reference(input, input_len, reference, sizeof(reference), &reference_err);
+	EXPECT_EQ(fast_err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(reference_err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(fast_len, reference_len);
+	EXPECT_EQ(std::memcmp(fast, reference, fast_len), 0);
+}
+
+TEST(Huffman, CompressFoo) {
+	uint8_t compressed[32];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t len = ddproto_huffman_compress((const uint8_t *)"foo", 4, compressed, sizeof(compressed), &err);
+	uint8_t expected[] = {0x74, 0xde, 0x16, 0xd9, 0xa2, 0x8a, 0x1b};
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(len, sizeof(expected));
+	EXPECT_EQ(std::memcmp(compressed, expected, len), 0);
+}
+
+TEST(Huffman, CompressMatchesReference) {
+	uint32_t state = 99;
+	uint8_t input[1400];
+	for(size_t len = 0; len < sizeof(input); len += 13) {
+		for(size_t i = 0; i < len; i++) {
+			// mix of zeros and random bytes so short and long codes are used
+			input[i] = next_random(&state) % 2 ? 0 : next_random(&state);
+		}
+		expect_encoders_match(input, len);
+	}
+
+	uint8_t all_bytes[256];
+	for(size_t i = 0; i < sizeof(all_bytes); i++) {
+		all_bytes[i] = 255 - i;
+	}
+	expect_encoders_match(all_bytes, sizeof(all_bytes));
+}
+
+TEST(Huffman, CompressBufferFull) {
+	uint32_t state = 5;
+	uint8_t input[200];
+	for(uint8_t &byte : input) {
+		byte = next_random(&state);
+	}
+	uint8_t reference[512];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t needed = ddproto_huffman_compress_reference(input, sizeof(input), reference, sizeof(reference), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+
+	for(size_t output_len = 1; output_len <= needed + 8; output_len++) {
+		uint8_t output[512];
+		err = DDPROTO_ERR_NONE;
+		size_t len = ddproto_huffman_compress(input, sizeof(input), output, output_len, &err);
+		if(output_len < needed) {
+			EXPECT_EQ(err, DDPROTO_ERR_BUFFER_FULL);
+		} else {
+			EXPECT_EQ(err, DDPROTO_ERR_NONE);
+			ASSERT_EQ(len, needed);
+			EXPECT_EQ(std::memcmp(output, reference, len), 0);
+		}
+	}
+}
+
+TEST(Huffman, BatchMatchesSingle) {
+	// more buffers than lanes with different lengths so lanes finish and
+	// pick up new buffers at different times. Two of them fail
+	const size_t lengths[] = {1300, 0, 1, 7, 400, 1000, 3, 64, 1300, 250, 9};
+	const size_t num_buffers = sizeof(lengths) / sizeof(lengths[0]);
+	static uint8_t input[num_buffers][1400];
+	static uint8_t compressed[num_buffers][2048];
+	static uint8_t decompressed[num_buffers][2048];
+	uint8_t expected[2048];
+	uint32_t state = 5;
+	DDProtoHuffmanBuffer buffers[num_buffers];
+	for(size_t i = 0; i < num_buffers; i++) {
+		for(size_t k = 0; k < lengths[i]; k++) {
+			// mostly zeros and small values like packed ints
+			uint32_t rand = next_random(&state);
+			input[i][k] = rand % 3 == 0 ? rand >> 4 : 0;
+		}
+		buffers[i] = {input[i], lengths[i], compressed[i], sizeof(compressed[i]), 0, DDPROTO_ERR_NONE};
+	}
+	buffers[4].output_len = 10;
+
+	ddproto_huffman_compress_batch(ddproto_huffman_default(), buffers, num_buffers);
+	for(size_t i = 0; i < num_buffers; i++) {
+		DDProtoError err = DDPROTO_ERR_NONE;
+		size_t len = ddproto_huffman_compress(input[i], lengths[i], expected, buffers[i].output_len, &err);
+		EXPECT_EQ(buffers[i].err, err) << "buffer " << i;
+		ASSERT_EQ(buffers[i].result_len, len) << "buffer " << i;
+		if(err == DDPROTO_ERR_NONE) {
+			EXPECT_EQ(std::memcmp(compressed[i], expected, len), 0) << "buffer " << i;
+		}
+	}
+	EXPECT_EQ(buffers[4].err, DDPROTO_ERR_BUFFER_FULL);
+
+	for(size_t i = 0; i < num_buffers; i++) {
+		buffers[i] = {compressed[i], buffers[i].result_len, decompressed[i], sizeof(decompressed[i]), 0, DDPROTO_ERR_NONE};
+	}
+	// the failed buffer has no output, decoding nothing runs out of input
+	buffers[4].input_len = 0;
+	buffers[8].input_len /= 2;
+
+	ddproto_huffman_decompress_batch(ddproto_huffman_default(), buffers, num_buffers);
+	for(size_t i = 0; i < num_buffers; i++) {
+		DDProtoError err = DDPROTO_ERR_NONE;
+		size_t len = ddproto_huffman_decompress(buffers[i].input, buffers[i].input_len, expected, sizeof(expected), &err);
+		EXPECT_EQ(buffers[i].err, err) << "buffer " << i;
+		ASSERT_EQ(buffers[i].result_len, len) << "buffer " << i;
+		if(err == DDPROTO_ERR_NONE) {
+			EXPECT_EQ(len, lengths[i]);
+			EXPECT_EQ(std::memcmp(decompressed[i], input[i], len), 0) << "buffer " << i;
+		}
+	}
+	EXPECT_EQ(buffers[4].err, DDPROTO_ERR_END_OF_BUFFER);
+	EXPECT_EQ(buffers[8].err, DDPROTO_ERR_END_OF_BUFFER);
+}
+
+TEST(Huffman, BatchFewerBuffersThanLanes) {
+	const char *strings[] = {"foo", "bar"};
+	uint8_t compressed[2][16];
+	uint8_t decompressed[2][16];
+	DDProtoHuffmanBuffer buffers[2];
+	for(size_t i = 0; i < 2; i++) {
+		buffers[i] = {(const uint8_t *)strings[i], 4, compressed[i], sizeof(compressed[i]), 0, DDPROTO_ERR_NONE};
+	}
+	ddproto_huffman_compress_batch(ddproto_huffman_default(), buffers, 2);
+	EXPECT_EQ(buffers[0].err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(buffers[1].err, DDPROTO_ERR_NONE);
+	uint8_t foo[] = {0x74, 0xde, 0x16, 0xd9, 0xa2, 0x8a, 0x1b};
+	ASSERT_EQ(buffers[0].result_len, sizeof(foo));
+	EXPECT_EQ(std::memcmp(compressed[0], foo, sizeof(foo)), 0);
+
+	for(size_t i = 0; i < 2; i++) {
+		buffers[i] = {compressed[i], buffers[i].result_len, decompressed[i], sizeof(decompressed[i]), 0, DDPROTO_ERR_NONE};
+	}
+	ddproto_huffman_decompress_batch(ddproto_huffman_default(), buffers, 2);
+	EXPECT_EQ(buffers[0].err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(buffers[1].err, DDPROTO_ERR_NONE);
+	EXPECT_STREQ((const char *)decompressed[0], "foo");
+	EXPECT_STREQ((const char *)decompressed[1], "bar");
+
+	ddproto_huffman_decompress_batch(ddproto_huffman_default(), nullptr, 0);
+}
+
+static void expect_roundtrip(const DDProtoHuffman *huffman, const uint8_t *input, size_t input_len) {
+	uint8_t compressed[4096];
+	uint8_t decompressed[2048];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t compressed_len = ddproto_huffman_compress_with(huffman, input, input_len, compressed, sizeof(compressed), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(compressed_len, ddproto_huffman_compressed_size(huffman, input, input_len));
+	size_t len = ddproto_huffman_decompress_with(huffman, compressed, compressed_len, decompressed, sizeof(decompressed), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(len, input_len);
+	EXPECT_EQ(std::memcmp(decompressed, input, len), 0);
+}
+
+TEST(Huffman, CustomDefaultFrequenciesMatchDefault) {
+	DDProtoHuffman *huffman = ddproto_huffman_new(ddproto_huffman_default_frequencies());
+	ASSERT_NE(huffman, nullptr);
+
+	uint8_t input[1024];
+	uint32_t state = 11;
+	for(size_t i = 0; i < sizeof(input); i++) {
+		input[i] = i < 256 ? i : next_random(&state);
+	}
+	uint8_t expected[2048];
+	uint8_t compressed[2048];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t expected_len = ddproto_huffman_compress(input, sizeof(input), expected, sizeof(expected), &err);
+	size_t len = ddproto_huffman_compress_with(huffman, input, sizeof(input), compressed, sizeof(compressed), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(len, expected_len);
+	EXPECT_EQ(std::memcmp(compressed, expected, len), 0);
+	expect_roundtrip(huffman, input, sizeof(input));
+
+	ddproto_huffman_free(huffman);
+}
+
+TEST(Huffman, CustomTable) {
+	// a mod that mostly sends the same few bytes
+	uint32_t frequencies[256];
+	for(uint32_t &frequency : frequencies) {
+		frequency = 1;
+	}
+	uint8_t corpus[1000];
+	uint32_t state = 3;
+	for(uint8_t &byte : corpus) {
+		byte = "\x40\x41\x7f\x80"[next_random(&state) % 4];
+	}
+	ddproto_huffman_count_frequencies(frequencies, corpus, sizeof(corpus));
+	EXPECT_EQ(frequencies[0x40] + frequencies[0x41] + frequencies[0x7f] + frequencies[0x80], 1004);
+
+	DDProtoHuffman *huffman = ddproto_huffman_new(frequencies);
+	ASSERT_NE(huffman, nullptr);
+	size_t trained = ddproto_huffman_compressed_size(huffman, corpus, sizeof(corpus));
+	size_t standard = ddproto_huffman_compressed_size(ddproto_huffman_default(), corpus, sizeof(corpus));
+	EXPECT_LT(trained, standard);
+	expect_roundtrip(huffman, corpus, sizeof(corpus));
+
+	// bytes that are not part of the corpus still work
+	uint8_t all_bytes[256];
+	for(size_t i = 0; i < sizeof(all_bytes); i++) {
+		all_bytes[i] = i;
+	}
+	expect_roundtrip(huffman, all_bytes, sizeof(all_bytes));
+
+	ddproto_huffman_free(huffman);
+}
+
+TEST(Huffman, CustomTableLongCodes) {
+	// fibonacci frequencies and zeros would result in codes that are way too
+	// long, the table has to be flattened
+	uint32_t frequencies[256] = {0};
+	frequencies[0] = 1;
+	frequencies[1] = 1;
+	for(size_t i = 2; i < 45; i++) {
+		frequencies[i] = frequencies[i - 1] + frequencies[i - 2];
+	}
+	DDProtoHuffman *huffman = ddproto_huffman_new(frequencies);
+	ASSERT_NE(huffman, nullptr);
+
+	uint8_t input[1024];
+	uint32_t state = 17;
+	for(uint8_t &byte : input) {
+		byte = next_random(&state);
+	}
+	expect_roundtrip(huffman, input, sizeof(input));
+
+	uint8_t compressed[2048];
+	DDProtoHuffmanBuffer buffers[5];
+	for(size_t i = 0; i < 5; i++) {
+		buffers[i] = {input + i * 200, 200, compressed + i * 400, 400, 0, DDPROTO_ERR_NONE};
+	}
+	ddproto_huffman_compress_batch(huffman, buffers, 5);
+	for(size_t i = 0; i < 5; i++) {
+		EXPECT_EQ(buffers[i].err, DDPROTO_ERR_NONE);
+		EXPECT_EQ(buffers[i].result_len, ddproto_huffman_compressed_size(huffman, input + i * 200, 200));
+	}
+
+	ddproto_huffman_free(huffman);
+}
+
+TEST(Huffman, CompressedSize) {
+	EXPECT_EQ(ddproto_huffman_compressed_size(ddproto_huffman_default(), (const uint8_t *)"foo", 4), 7);
+
+	uint8_t compressed[8];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t len = ddproto_huffman_compress(nullptr, 0, compressed, sizeof(compressed), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_huffman_compressed_size(ddproto_huffman_default(), nullptr, 0), len);
+}
+
+TEST(Huffman, CompressBound) {
+	uint8_t input[1024];
+	uint8_t compressed[2048];
+	uint32_t state = 23;
+	for(uint8_t &byte : input) {
+		byte = next_random(&state);
+	}
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t bound = ddproto_huffman_compress_bound(sizeof(input));
+	ASSERT_LE(bound, sizeof(compressed));
+	size_t len = ddproto_huffman_compress(input, sizeof(input), compressed, bound, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_LE(len, bound);
+
+	// the bound is reached by the byte with the longest code
+	size_t worst_size = 0;
+	uint8_t worst = 0;
+	for(size_t i = 0; i < 256; i++) {
+		std::memset(input, i, sizeof(input));
+		size_t size = ddproto_huffman_compressed_size(ddproto_huffman_default(), input, sizeof(input));
+		if(size > worst_size) {
+			worst_size = size;
+			worst = i;
+		}
+	}
+	EXPECT_EQ(worst_size, bound);
+	std::memset(input, worst, sizeof(input));
+	len = ddproto_huffman_compress(input, sizeof(input), compressed, bound, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(len, bound);
+	EXPECT_EQ(ddproto_huffman_compress(input, sizeof(input), compressed, bound - 1, &err), (size_t)-1);
+	EXPECT_EQ(err, DDPROTO_ERR_BUFFER_FULL);
+}
@@ -1,8 +1,12 @@
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/int_string.h>
+#include <ddnet_protocol/packer.h>
 
 #include <gtest/gtest.h>
 
+#include <random>
+#include <string>
+
 TEST(IntString, StrLength) {
 	EXPECT_EQ(ddproto_str_length(""), 0);
 	EXPECT_EQ(ddproto_str_length("a"), 1);
@@ -53,3 +57,171 @@ TEST(IntString, StrToInts) {
 	err = ddproto_str_to_ints(ints, 1, "aβい🐘");
 	ASSERT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
 }
+
+TEST(IntString, IsUtf8) {
+	EXPECT_TRUE(ddproto_str_is_utf8("", 0));
+	EXPECT_TRUE(ddproto_str_is_utf8("aβい🐘", 10));
+	EXPECT_TRUE(ddproto_str_is_utf8("\x7f\xc2\x80\xdf\xbf", 5));
+	EXPECT_TRUE(ddproto_str_is_utf8("\xef\xbf\xbf\xf4\x8f\xbf\xbf", 7));
+
+	// stray continuation byte
+	EXPECT_FALSE(ddproto_str_is_utf8("\x80", 1));
+	// overlong encodings
+	EXPECT_FALSE(ddproto_str_is_utf8("\xc0\xaf", 2));
+	EXPECT_FALSE(ddproto_str_is_utf8("\xe0\x80\xaf", 3));
+	EXPECT_FALSE(ddproto_str_is_utf8("\xf0\x80\x80\xaf", 4));
+	// surrogate
+	EXPECT_FALSE(ddproto_str_is_utf8("\xed\xa0\x80", 3));
+	// above U+10FFFF
+	EXPECT_FALSE(ddproto_str_is_utf8("\xf4\x90\x80\x80", 4));
+	EXPECT_FALSE(ddproto_str_is_utf8("\xff", 1));
+	// truncated
+	EXPECT_FALSE(ddproto_str_is_utf8("🐘", 3));
+}
+
+TEST(IntString, IsUtf8LongStrings) {
+	// sequences that end behind the block they started in and in the tail
+	std::string str(300, 'a');
+	for(size_t pos : {62, 126, 254, 290}) {
+		str.replace(pos, 4, "🐘");
+	}
+	EXPECT_TRUE(ddproto_str_is_utf8(str.data(), str.size()));
+
+	for(size_t i = 0; i < str.size(); i++) {
+		std::string invalid = str;
+		invalid[i] = '\xff';
+		EXPECT_FALSE(ddproto_str_is_utf8(invalid.data(), invalid.size())) << i;
+	}
+	// cuts the first emoji in half
+	EXPECT_FALSE(ddproto_str_is_utf8(str.data(), 64));
+}
+
+// decodes code points one by one
+static bool reference_is_utf8(const uint8_t *str, size_t len) {
+	size_t i = 0;
+	while(i < len) {
+		uint32_t code_point = str[i];
+		size_t size = 1;
+		if(code_point >= 0xf0) {
+			code_point &= 0x07;
+			size = 4;
+		} else if(code_point >= 0xe0) {
+			code_point &= 0x0f;
+			size = 3;
+		} else if(code_point >= 0xc0) {
+			code_point &= 0x1f;
+			size = 2;
+		} else if(code_point >= 0x80) {
+			return false;
+		}
+		if(str[i] >= 0xf8 || i + size > len) {
+			return false;
+		}
+		for(size_t k = 1; k < size; k++) {
+			if((str[i + k] & 0xc0) != 0x80) {
+				return false;
+			}
+			code_point = (code_point << 6) | (str[i + k] & 0x3f);
+		}
+		const uint32_t min[] = {0, 0, 0x80, 0x800, 0x10000};
+		if(code_point < min[size] || code_point > 0x10ffff || (code_point >= 0xd800 && code_point <= 0xdfff)) {
+			return false;
+		}
+		i += size;
+	}
+	return true;
+}
+
+TEST(IntString, IsUtf8MatchesReference) {
+	std::mt19937 rng(1234);
+	const uint8_t bytes[] = {'a', ' ', 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbf, 0xc0, 0xc2, 0xdf, 0xe0, 0xed, 0xef, 0xf0, 0xf4, 0xf5, 0xff};
+	for(size_t round = 0; round < 5000; round++) {
+		uint8_t str[300];
+		const size_t len = rng() % sizeof(str);
+		for(size_t i = 0; i < len; i++) {
+			// mostly ASCII like the strings sent by real clients
+			str[i] = rng() % 4 ? 'a' : bytes[rng() % sizeof(bytes)];
+		}
+		EXPECT_EQ(ddproto_str_is_utf8((const char *)str, len), reference_is_utf8(str, len)) << round;
+	}
+}
+
+TEST(IntString, IntsToStrUtf8) {
+	uint32_t ints[] = {
+		0xE14E3263,
+		0x0104701F,
+		0x10188000};
+	char str[32];
+	DDProtoError err = ddproto_ints_to_str_utf8(ints, 3, str, sizeof(str));
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_STREQ(str, "aβい🐘");
+
+	// "a\xff"
+	ints[0] = 0xE17F8000;
+	err = ddproto_ints_to_str_utf8(ints, 1, str, sizeof(str));
+	EXPECT_EQ(err, DDPROTO_ERR_INVALID_UTF8);
+	EXPECT_STREQ(str, "");
+
+	err = ddproto_ints_to_str(ints, 1, str, sizeof(str));
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_STREQ(str, "a\xff");
+}
+
+TEST(IntString, IntsToStrMatchesReference) {
+	std::mt19937 rng(1234);
+	for(size_t num_ints = 1; num_ints <= 13; num_ints++) {
+		uint32_t ints[13];
+		for(size_t i = 0; i < num_ints; i++) {
+			ints[i] = rng();
+		}
+		char str[13 * sizeof(uint32_t)];
+		ASSERT_EQ(ddproto_ints_to_str(ints, num_ints, str, sizeof(str)), DDPROTO_ERR_NONE);
+
+		// the byte by byte conversion
+		for(size_t i = 0; i < num_ints * sizeof(uint32_t) - 1; i++) {
+			const uint32_t shift = (3 - i % 4) * 8;
+			EXPECT_EQ((uint8_t)str[i], (uint8_t)(((ints[i / 4] >> shift) & 0xff) - 128)) << num_ints << " " << i;
+		}
+		EXPECT_EQ(str[num_ints * sizeof(uint32_t) - 1], '\0');
+	}
+}
+
+TEST(IntString, StrToIntsRoundTrip) {
+	const char *strs[] = {"", "a", "nameless tee", "aβい🐘", "exactly15chars!"};
+	for(const char *str : strs) {
+		uint32_t ints[4];
+		ASSERT_EQ(ddproto_str_to_ints(ints, 4, str), DDPROTO_ERR_NONE);
+		char out[16];
+		ASSERT_EQ(ddproto_ints_to_str(ints, 4, out, sizeof(out)), DDPROTO_ERR_NONE);
+		EXPECT_STREQ(out, str);
+	}
+}
+
+TEST(IntString, UnpackerGetIntString) {
+	uint32_t ints[6];
+	ASSERT_EQ(ddproto_str_to_ints(ints, 6, "default_skin"), DDPROTO_ERR_NONE);
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	ddproto_packer_add_ints(packer, (const int32_t *)ints, 6);
+	ddproto_packer_add_int(packer, 0x7f); // "\xff"
+	ASSERT_EQ(packer->err, DDPROTO_ERR_NONE);
+
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	DDProtoDecodeOptions options = {.validate_utf8 = true};
+	unpacker.options = &options;
+	char skin[24];
+	EXPECT_EQ(ddproto_unpacker_get_int_string(&unpacker, 6, skin, sizeof(skin)), DDPROTO_ERR_NONE);
+	EXPECT_STREQ(skin, "default_skin");
+
+	char str[8];
+	EXPECT_EQ(ddproto_unpacker_get_int_string(&unpacker, 2, str, 4), DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
+	EXPECT_EQ(ddproto_unpacker_get_int_string(&unpacker, 1, str, sizeof(str)), DDPROTO_ERR_INVALID_UTF8);
+	EXPECT_STREQ(str, "");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_INVALID_UTF8);
+
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	char long_str[32];
+	EXPECT_EQ(ddproto_unpacker_get_int_string(&unpacker, 8, long_str, sizeof(long_str)), DDPROTO_ERR_EMPTY_BUFFER);
+	EXPECT_STREQ(long_str, "");
+}
@@ -0,0 +1,164 @@
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/chunk.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/message_records.h>
+#include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "snap_packet.h"
+
+TEST(MessageRecords, PushAndIterate) {
+	char message[] = "hello";
+	DDProtoChunk chat = {};
+	chat.header = {.flags = DDPROTO_CHUNK_FLAG_VITAL, .size = 9, .sequence = 4};
+	chat.payload.kind = DDPROTO_MSG_KIND_SV_CHAT;
+	chat.payload.msg.chat = {.team = DDPROTO_CHAT_PUBLIC, .client_id = 3, .message = message, .message_len = 5};
+
+	DDProtoChunk kill = {};
+	kill.payload.kind = DDPROTO_MSG_KIND_SV_KILLMSG;
+	kill.payload.msg.kill_msg = {.killer_id = 1, .victim_id = 2, .weapon = DDPROTO_WEAPON_HAMMER, .mode_special = 0};
+
+	DDProtoChunk ready = {};
+	ready.payload.kind = DDPROTO_MSG_KIND_READY;
+
+	uint64_t buf[64];
+	DDProtoMessageRecords records;
+	ddproto_message_records_init(&records, buf, sizeof(buf));
+	EXPECT_EQ(ddproto_message_records_first(&records), nullptr);
+
+	for(const DDProtoChunk *chunk : {&chat, &kill, &ready}) {
+		DDProtoError err = DDPROTO_ERR_NONE;
+		size_t size = ddproto_message_record_size(chunk, &err);
+		EXPECT_EQ(err, DDPROTO_ERR_NONE);
+		EXPECT_LT(size, sizeof(DDProtoChunk));
+		EXPECT_EQ(size % DDPROTO_RECORD_ALIGNMENT, 0);
+		ASSERT_EQ(ddproto_message_records_push(&records, chunk), DDPROTO_ERR_NONE);
+	}
+	EXPECT_EQ(records.count, 3);
+
+	// the record owns a copy of the string
+	memset(message, 'x', 5);
+
+	const DDProtoMessageRecord *record = ddproto_message_records_first(&records);
+	ASSERT_NE(record, nullptr);
+	ASSERT_EQ(record->kind, DDPROTO_MSG_KIND_SV_CHAT);
+	EXPECT_EQ(record->header.sequence, 4);
+	EXPECT_EQ(ddproto_message_record_msg(record)->chat.client_id, 3);
+	EXPECT_STREQ(ddproto_message_record_msg(record)->chat.message, "hello");
+	EXPECT_EQ(ddproto_message_record_msg(record)->chat.message_len, 5);
+
+	record = ddproto_message_records_next(&records, record);
+	ASSERT_NE(record, nullptr);
+	ASSERT_EQ(record->kind, DDPROTO_MSG_KIND_SV_KILLMSG);
+	EXPECT_EQ(ddproto_message_record_msg(record)->kill_msg.victim_id, 2);
+	EXPECT_EQ(ddproto_message_record_msg(record)->kill_msg.weapon, DDPROTO_WEAPON_HAMMER);
+
+	record = ddproto_message_records_next(&records, record);
+	ASSERT_NE(record, nullptr);
+	EXPECT_EQ(record->kind, DDPROTO_MSG_KIND_READY);
+	EXPECT_EQ(ddproto_message_records_next(&records, record), nullptr);
+
+	DDProtoChunk chunk;
+	ddproto_message_record_load(ddproto_message_records_first(&records), &chunk);
+	EXPECT_EQ(chunk.header.flags, DDPROTO_CHUNK_FLAG_VITAL);
+	EXPECT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_SV_CHAT);
+	EXPECT_STREQ(chunk.payload.msg.chat.message, "hello");
+
+	ddproto_message_records_reset(&records);
+	EXPECT_EQ(records.count, 0);
+	EXPECT_EQ(ddproto_message_records_first(&records), nullptr);
+}
+
+TEST(MessageRecords, Full) {
+	DDProtoChunk chunk = {};
+	chunk.payload.kind = DDPROTO_MSG_KIND_SV_BROADCAST;
+	chunk.payload.msg.broadcast.message = "a broadcast that does not fit";
+
+	uint64_t buf[4];
+	DDProtoMessageRecords records;
+	ddproto_message_records_init(&records, buf, sizeof(buf));
+	EXPECT_EQ(ddproto_message_records_push(&records, &chunk), DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
+	EXPECT_EQ(records.len, 0);
+	EXPECT_EQ(records.count, 0);
+
+	chunk.payload.kind = (DDProtoMessageKind)200;
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_message_record_size(&chunk, &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_UNKNOWN_MESSAGE);
+}
+
+TEST(MessageRecords, DecodePacket) {
+	uint64_t buf[512];
+	DDProtoMessageRecords records;
+	ddproto_message_records_init(&records, buf, sizeof(buf));
+
+	const DDProtoAllocator global = *ddproto_allocator();
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .chat = true, .compression = compression});
+
+		DDProtoError err = DDPROTO_ERR_NONE;
+		DDProtoPacketHeader header = ddproto_decode_packet_records(bytes, len, &records, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+		EXPECT_EQ(header.token, 0x3de3948d);
+
+		// the records do not point into the packet
+		memset(bytes, 0, sizeof(bytes));
+	}
+	EXPECT_EQ(records.count, 4);
+
+	// the snapshots were copied and freed
+	EXPECT_EQ(ddproto_allocator()->alloc_calls - global.alloc_calls, ddproto_allocator()->free_calls - global.free_calls);
+
+	size_t num_records = 0;
+	for(const DDProtoMessageRecord *record = ddproto_message_records_first(&records); record; record = ddproto_message_records_next(&records, record)) {
+		const DDProtoGenericMessage *msg = ddproto_message_record_msg(record);
+		if(num_records % 2 == 0) {
+			ASSERT_EQ(record->kind, DDPROTO_MSG_KIND_SNAPSINGLE);
+			EXPECT_EQ(msg->snap_single.game_tick, SNAP_GAME_TICK);
+			ASSERT_EQ(msg->snap_single.snapshot.items.len, 2);
+			EXPECT_EQ(msg->snap_single.snapshot.items.data[1].item.pickup.y, SNAP_PICKUP_Y + 1);
+			EXPECT_EQ(msg->snap_single.snapshot.allocator, nullptr);
+		} else {
+			ASSERT_EQ(record->kind, DDPROTO_MSG_KIND_SV_CHAT);
+			EXPECT_EQ(record->header.sequence, 2);
+			EXPECT_STREQ(msg->chat.message, "hello");
+		}
+		num_records++;
+	}
+	EXPECT_EQ(num_records, 4);
+}
+
+TEST(MessageRecords, DecodePacketErrors) {
+	uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+	size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .chat = true, .compression = DDPROTO_COMPRESSION_NEVER});
+
+	// the records of the packet do not fit
+	uint64_t buf[24];
+	DDProtoMessageRecords records;
+	ddproto_message_records_init(&records, buf, sizeof(buf));
+	DDProtoChunk ready = {};
+	ready.payload.kind = DDPROTO_MSG_KIND_READY;
+	ASSERT_EQ(ddproto_message_records_push(&records, &ready), DDPROTO_ERR_NONE);
+	const size_t records_len = records.len;
+
+	const DDProtoAllocator global = *ddproto_allocator();
+	DDProtoError err = DDPROTO_ERR_NONE;
+	ddproto_decode_packet_records(bytes, len, &records, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
+	EXPECT_EQ(records.len, records_len);
+	EXPECT_EQ(records.count, 1);
+	EXPECT_EQ(ddproto_allocator()->alloc_calls - global.alloc_calls, ddproto_allocator()->free_calls - global.free_calls);
+
+	uint8_t close[] = {0x10, 0x00, 0x00, 0x04, 0x4e, 0xc7, 0x3b, 0x04};
+	err = DDPROTO_ERR_NONE;
+	DDProtoPacketHeader header = ddproto_decode_packet_records(close, sizeof(close), &records, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_TRUE(header.flags & DDPROTO_PACKET_FLAG_CONTROL);
+	EXPECT_EQ(records.count, 1);
+}
@@ -1,113 +1,199 @@
+#include <ddnet_protocol/arena.h>
 #include <ddnet_protocol/chunk.h>
 #include <ddnet_protocol/errors.h>
 #include <ddnet_protocol/message.h>
 #include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/packet.h>
 
 #include <cstring>
+#include <random>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
 TEST(MessagePacker, Rcon) {
-	DDProtoPacker packer;
-	ddproto_packer_init_msg(&packer, DDPROTO_MSG_KIND_RCON_CMD);
-	ddproto_packer_add_string(&packer, "say hello");
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init_msg(&packer_buffer, DDPROTO_MSG_KIND_RCON_CMD);
+	ddproto_packer_add_string(packer, "say hello");
 	uint8_t bytes[] = {
 		0x23, 0x73, 0x61, 0x79, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x00};
-	EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+	EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 }
 
 TEST(Packer, SingleByteInts) {
-	DDProtoPacker packer;
-	ddproto_packer_init(&packer);
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
 
-	EXPECT_EQ(ddproto_packer_remaining_size(&packer), DDPROTO_PACKER_BUFFER_SIZE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 0);
+	EXPECT_EQ(ddproto_packer_remaining_size(packer), DDPROTO_PACKER_BUFFER_SIZE);
+	EXPECT_EQ(ddproto_packer_size(packer), 0);
 
-	ddproto_packer_add_int(&packer, 0);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	ddproto_packer_add_int(packer, 0);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
 
-	ddproto_packer_add_int(&packer, 1);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	ddproto_packer_add_int(packer, 1);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
 
 	uint8_t bytes[] = {0x00, 0x01};
-	EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+	EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 
-	EXPECT_EQ(ddproto_packer_size(&packer), 2);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 2);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+}
+
+TEST(Packer, Ints) {
+	std::mt19937 rng(99);
+	int32_t values[300];
+	for(int32_t &value : values) {
+		value = (int32_t)rng() >> (rng() % 32);
+	}
+	values[0] = INT32_MIN;
+	values[1] = INT32_MAX;
+
+	DDProtoPackerBuffer expected_buffer;
+	DDProtoPacker *expected = ddproto_packer_init(&expected_buffer);
+	for(int32_t value : values) {
+		ddproto_packer_add_int(expected, value);
+	}
+
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	EXPECT_EQ(ddproto_packer_add_ints(packer, values, 300), DDPROTO_ERR_NONE);
+	ASSERT_EQ(ddproto_packer_size(packer), ddproto_packer_size(expected));
+	EXPECT_EQ(std::memcmp(ddproto_packer_data(packer), ddproto_packer_data(expected), ddproto_packer_size(packer)), 0);
+	EXPECT_EQ(ddproto_packer_ints_size(values, 300), ddproto_packer_size(packer));
+}
+
+TEST(Packer, IntsBufferFull) {
+	int32_t values[] = {1, 64, -1};
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	packer->current = packer->end - 3;
+	EXPECT_EQ(ddproto_packer_add_ints(packer, values, 3), DDPROTO_ERR_BUFFER_FULL);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_BUFFER_FULL);
+	EXPECT_EQ(ddproto_packer_remaining_size(packer), 3);
 }
 
 TEST(Packer, MultiByteInts) {
-	DDProtoPacker packer;
-	ddproto_packer_init(&packer);
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
 
-	EXPECT_EQ(ddproto_packer_remaining_size(&packer), DDPROTO_PACKER_BUFFER_SIZE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 0);
+	EXPECT_EQ(ddproto_packer_remaining_size(packer), DDPROTO_PACKER_BUFFER_SIZE);
+	EXPECT_EQ(ddproto_packer_size(packer), 0);
 
-	ddproto_packer_add_int(&packer, 64);
-	EXPECT_EQ(ddproto_packer_size(&packer), 2);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	ddproto_packer_add_int(packer, 64);
+	EXPECT_EQ(ddproto_packer_size(packer), 2);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
 	{
 		uint8_t bytes[] = {0x80, 0x01};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 
-	ddproto_packer_add_int(&packer, -66663);
-	EXPECT_EQ(ddproto_packer_size(&packer), 5);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	ddproto_packer_add_int(packer, -66663);
+	EXPECT_EQ(ddproto_packer_size(packer), 5);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
 	{
 		uint8_t bytes[] = {0x80, 0x01, 0xe6, 0x91, 0x08};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 }
 
 TEST(Packer, Strings) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+
+	ddproto_packer_add_string(packer, "");
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 1);
+	EXPECT_STREQ((char *)ddproto_packer_data(packer), "");
+
+	ddproto_packer_add_string(packer, "foo");
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 5);
+	EXPECT_STREQ((char *)ddproto_packer_data(packer), "");
+	EXPECT_STREQ((char *)ddproto_packer_data(packer) + 1, "foo");
+}
+
+TEST(Packer, StringLen) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+
+	ddproto_packer_add_string_len(packer, "foobar", 3);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 4);
+	EXPECT_STREQ((char *)ddproto_packer_data(packer), "foo");
+
+	// no space for the null terminator
+	packer->current = packer->end - 3;
+	EXPECT_EQ(ddproto_packer_add_string_len(packer, "foo", 3), DDPROTO_ERR_BUFFER_FULL);
+	EXPECT_EQ(ddproto_packer_remaining_size(packer), 3);
+}
+
+TEST(Packer, ExternalBuffer) {
+	uint8_t buf[4];
 	DDProtoPacker packer;
-	ddproto_packer_init(&packer);
+	ddproto_packer_init_buf(&packer, buf, sizeof(buf));
+	EXPECT_EQ(ddproto_packer_remaining_size(&packer), 4);
 
-	ddproto_packer_add_string(&packer, "");
+	ddproto_packer_add_int(&packer, 64);
+	ddproto_packer_add_string(&packer, "a");
 	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 1);
-	EXPECT_STREQ((char *)ddproto_packer_data(&packer), "");
+	EXPECT_EQ(ddproto_packer_data(&packer), buf);
+	EXPECT_EQ(ddproto_packer_size(&packer), 4);
+	uint8_t bytes[] = {0x80, 0x01, 'a', 0x00};
+	EXPECT_EQ(std::memcmp(buf, bytes, sizeof(bytes)), 0);
 
-	ddproto_packer_add_string(&packer, "foo");
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 5);
-	EXPECT_STREQ((char *)ddproto_packer_data(&packer), "");
-	EXPECT_STREQ((char *)ddproto_packer_data(&packer) + 1, "foo");
+	ddproto_packer_add_int(&packer, 1);
+	EXPECT_EQ(packer.err, DDPROTO_ERR_BUFFER_FULL);
+
+	// only the packer buffer carries the memory to pack into
+	EXPECT_LT(sizeof(packer), 64);
+	EXPECT_GE(sizeof(DDProtoPackerBuffer), sizeof(packer) + DDPROTO_PACKER_BUFFER_SIZE);
 }
 
-TEST(Packer, StringsAndInts) {
+TEST(MessagePacker, ExternalBuffer) {
+	uint8_t buf[16];
 	DDProtoPacker packer;
-	ddproto_packer_init(&packer);
+	ddproto_packer_init_msg_buf(&packer, DDPROTO_MSG_KIND_RCON_CMD, buf, sizeof(buf));
+	ddproto_packer_add_string(&packer, "say hello");
+	uint8_t bytes[] = {
+		0x23, 0x73, 0x61, 0x79, 0x20, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x00};
+	ASSERT_EQ(ddproto_packer_size(&packer), sizeof(bytes));
+	EXPECT_EQ(std::memcmp(buf, bytes, sizeof(bytes)), 0);
+}
 
-	ddproto_packer_add_int(&packer, 2);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 1);
+TEST(Packer, StringsAndInts) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+
+	ddproto_packer_add_int(packer, 2);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 1);
 	{
 		uint8_t bytes[] = {0x02};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 
-	ddproto_packer_add_string(&packer, "");
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 2);
+	ddproto_packer_add_string(packer, "");
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 2);
 	{
 		uint8_t bytes[] = {0x02, 0x00};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 
-	ddproto_packer_add_string(&packer, "foo");
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
-	EXPECT_EQ(ddproto_packer_size(&packer), 6);
+	ddproto_packer_add_string(packer, "foo");
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_packer_size(packer), 6);
 	{
 		uint8_t bytes[] = {0x02, 0x00, 'f', 'o', 'o', 0x00};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 
-	ddproto_packer_add_int(&packer, 6);
-	EXPECT_EQ(packer.err, DDPROTO_ERR_NONE);
+	ddproto_packer_add_int(packer, 6);
+	EXPECT_EQ(packer->err, DDPROTO_ERR_NONE);
 	{
 		uint8_t bytes[] = {0x02, 0x00, 'f', 'o', 'o', 0x00, 0x06};
-		EXPECT_TRUE(std::memcmp(ddproto_packer_data(&packer), bytes, ddproto_packer_size(&packer)) == 0);
+		EXPECT_TRUE(std::memcmp(ddproto_packer_data(packer), bytes, ddproto_packer_size(packer)) == 0);
 	}
 }
 
@@ -169,8 +255,251 @@ TEST(Unpacker, NegativeIntsMultiByte) {
 	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
 }
 
+// byte by byte decoder the unpacker has to stay compatible with
+static int32_t reference_get_int(const uint8_t **buf, const uint8_t *end, DDProtoError *err) {
+	if(*buf == end) {
+		*err = DDPROTO_ERR_EMPTY_BUFFER;
+		return 0;
+	}
+	const uint8_t *p = *buf;
+	int32_t sign = (*p >> 6) & 1;
+	uint32_t value = *p & 0x3f;
+	const uint8_t masks[] = {0x7f, 0x7f, 0x7f, 0x0f};
+	for(int i = 0; i < 4 && (*p & 0x80); i++) {
+		if(++p == end) {
+			*err = DDPROTO_ERR_END_OF_BUFFER;
+			return 0;
+		}
+		value |= (uint32_t)(*p & masks[i]) << (6 + 7 * i);
+	}
+	*buf = p + 1;
+	return (int32_t)(value ^ -(uint32_t)sign);
+}
+
+TEST(Unpacker, IntsMatchReference) {
+	std::mt19937 rng(1234);
+	uint8_t bytes[16];
+	for(int round = 0; round < 200000; round++) {
+		size_t len = rng() % (sizeof(bytes) + 1);
+		// mostly set extend bits so long and unterminated integers are common
+		uint8_t extend = (round & 1) ? 0x80 : 0x00;
+		for(size_t i = 0; i < len; i++) {
+			bytes[i] = (uint8_t)(rng() | (rng() % 4 ? extend : 0));
+		}
+
+		DDProtoUnpacker unpacker;
+		ddproto_unpacker_init(&unpacker, bytes, len);
+		const uint8_t *buf = bytes;
+		DDProtoError err = DDPROTO_ERR_NONE;
+		while(err == DDPROTO_ERR_NONE) {
+			int32_t expected = reference_get_int(&buf, bytes + len, &err);
+			int32_t value = ddproto_unpacker_get_int(&unpacker);
+			ASSERT_EQ(unpacker.err, err);
+			if(err == DDPROTO_ERR_NONE) {
+				ASSERT_EQ(value, expected);
+				ASSERT_EQ(unpacker.buf, buf);
+			}
+		}
+	}
+}
+
+TEST(Unpacker, IntsRoundTrip) {
+	const int32_t values[] = {0, 1, -1, 63, 64, -64, -65, 8191, 8192, 1048575, 1048576, 134217727, 134217728, INT32_MAX, INT32_MIN};
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	for(int32_t value : values) {
+		ddproto_packer_add_int(packer, value);
+	}
+
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	for(int32_t value : values) {
+		EXPECT_EQ(ddproto_unpacker_get_int(&unpacker), value);
+	}
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_unpacker_remaining_size(&unpacker), 0);
+}
+
+TEST(Unpacker, Ints) {
+	uint8_t bytes[] = {0x05, 0x80, 0x01, 0x7f, 0x01};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	int32_t values[4];
+	EXPECT_EQ(ddproto_unpacker_get_ints(&unpacker, values, 4), DDPROTO_ERR_NONE);
+	EXPECT_EQ(values[0], 5);
+	EXPECT_EQ(values[1], 64);
+	EXPECT_EQ(values[2], -64);
+	EXPECT_EQ(values[3], 1);
+	EXPECT_EQ(ddproto_unpacker_remaining_size(&unpacker), 0);
+}
+
+TEST(Unpacker, IntsEndOfBuffer) {
+	uint8_t bytes[] = {0x05, 0x06, 0x80};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	int32_t values[4] = {1, 1, 1, 1};
+	EXPECT_EQ(ddproto_unpacker_get_ints(&unpacker, values, 4), DDPROTO_ERR_END_OF_BUFFER);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_END_OF_BUFFER);
+	EXPECT_EQ(values[0], 5);
+	EXPECT_EQ(values[1], 6);
+	EXPECT_EQ(values[2], 0);
+	EXPECT_EQ(values[3], 0);
+}
+
+TEST(Unpacker, IntsMatchGetInt) {
+	std::mt19937 rng(4321);
+	for(int round = 0; round < 1000; round++) {
+		DDProtoPackerBuffer packer_buffer;
+		DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+		size_t num = rng() % 64;
+		for(size_t i = 0; i < num; i++) {
+			ddproto_packer_add_int(packer, (int32_t)rng() >> (rng() % 32));
+		}
+
+		DDProtoUnpacker expected;
+		ddproto_unpacker_init(&expected, ddproto_packer_data(packer), ddproto_packer_size(packer));
+		DDProtoUnpacker unpacker;
+		ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+
+		// one more than packed to also hit the end of the buffer
+		int32_t values[65];
+		ddproto_unpacker_get_ints(&unpacker, values, num + 1);
+		for(size_t i = 0; i < num; i++) {
+			ASSERT_EQ(values[i], ddproto_unpacker_get_int(&expected));
+		}
+		ASSERT_EQ(values[num], 0);
+		ASSERT_EQ(unpacker.err, DDPROTO_ERR_EMPTY_BUFFER);
+	}
+}
+
+// byte by byte versions of the string cleanup the library has to match
+static void reference_sanitize(char *str, bool keep_whitespace) {
+	for(; *str; str++) {
+		uint8_t c = *str;
+		if(c < 32 && !(keep_whitespace && (c == '\r' || c == '\n' || c == '\t'))) {
+			*str = ' ';
+		}
+	}
+}
+
+static void reference_clean_whitespaces(char *str) {
+	char *read = str;
+	char *write = str;
+	while(*read == ' ') {
+		read++;
+	}
+	while(true) {
+		bool found_whitespace = false;
+		for(; *read == ' '; read++) {
+			found_whitespace = true;
+		}
+		if(!*read) {
+			*write = 0;
+			break;
+		}
+		if(found_whitespace) {
+			*write++ = ' ';
+		}
+		*write++ = *read++;
+	}
+}
+
+TEST(Str, MatchesReference) {
+	std::mt19937 rng(7);
+	const char alphabet[] = {' ', ' ', ' ', 'a', 'b', '\t', '\n', '\r', 0x01, 0x1f, '~', (char)0x80, (char)0xff};
+	for(int round = 0; round < 20000; round++) {
+		char str[128];
+		size_t len = rng() % (sizeof(str) - 1);
+		for(size_t i = 0; i < len; i++) {
+			str[i] = alphabet[rng() % sizeof(alphabet)];
+		}
+		str[len] = '\0';
+
+		char expected[128];
+		char actual[128];
+		for(int keep = 0; keep < 2; keep++) {
+			std::memcpy(expected, str, len + 1);
+			std::memcpy(actual, str, len + 1);
+			reference_sanitize(expected, keep);
+			if(keep) {
+				ddproto_str_sanitize(actual);
+			} else {
+				ddproto_str_sanitize_cc(actual);
+			}
+			ASSERT_STREQ(actual, expected);
+		}
+
+		std::memcpy(expected, str, len + 1);
+		std::memcpy(actual, str, len + 1);
+		reference_clean_whitespaces(expected);
+		ASSERT_EQ(ddproto_str_clean_whitespaces(actual), strlen(expected));
+		ASSERT_STREQ(actual, expected);
+	}
+}
+
+TEST(Unpacker, StringView) {
+	uint8_t bytes[] = {'f', 'o', 0x03, 'o', 0x00, 0x00, 'x'};
+	uint8_t copy[sizeof(bytes)];
+	std::memcpy(copy, bytes, sizeof(bytes));
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	DDProtoStringView view = ddproto_unpacker_get_string_view(&unpacker);
+	EXPECT_EQ(view.str, (const char *)bytes);
+	EXPECT_EQ(view.len, 4);
+	EXPECT_FALSE(ddproto_string_view_is_sanitized(view, DDPROTO_STRING_SANITIZE));
+	EXPECT_TRUE(ddproto_string_view_is_sanitized(view, DDPROTO_STRING_SANITIZE_NONE));
+
+	view = ddproto_unpacker_get_string_view(&unpacker);
+	EXPECT_STREQ(view.str, "");
+	EXPECT_EQ(view.len, 0);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+
+	view = ddproto_unpacker_get_string_view(&unpacker);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_STR_UNEXPECTED_EOF);
+	EXPECT_STREQ(view.str, "");
+
+	// the unpacked data was not modified
+	EXPECT_EQ(std::memcmp(bytes, copy, sizeof(bytes)), 0);
+}
+
+TEST(Unpacker, StringViewSanitize) {
+	const char *str = "  a\t\x01  b ";
+	DDProtoStringView view = {str, strlen(str)};
+	char buf[32];
+
+	EXPECT_EQ(ddproto_string_view_sanitize(view, DDPROTO_STRING_SANITIZE, buf, sizeof(buf)), view.len);
+	EXPECT_STREQ(buf, "  a\t   b ");
+	EXPECT_EQ(ddproto_string_view_sanitize(view, DDPROTO_STRING_SANITIZE_CC, buf, sizeof(buf)), view.len);
+	EXPECT_STREQ(buf, "  a    b ");
+	EXPECT_EQ(ddproto_string_view_sanitize(view, (DDProtoStringSanitize)(DDPROTO_STRING_SANITIZE_CC | DDPROTO_STRING_SKIP_START_WHITESPACES), buf, sizeof(buf)), 3);
+	EXPECT_STREQ(buf, "a b");
+
+	// truncated to the size of the buffer
+	EXPECT_EQ(ddproto_string_view_sanitize(view, DDPROTO_STRING_SANITIZE_NONE, buf, 4), 3);
+	EXPECT_STREQ(buf, "  a");
+
+	DDProtoStringView clean = {"a b", 3};
+	EXPECT_TRUE(ddproto_string_view_is_sanitized(clean, (DDProtoStringSanitize)(DDPROTO_STRING_SANITIZE_CC | DDPROTO_STRING_SKIP_START_WHITESPACES)));
+	DDProtoStringView spaces = {"a  b", 4};
+	EXPECT_TRUE(ddproto_string_view_is_sanitized(spaces, DDPROTO_STRING_SANITIZE));
+	EXPECT_FALSE(ddproto_string_view_is_sanitized(spaces, DDPROTO_STRING_SKIP_START_WHITESPACES));
+}
+
+TEST(Unpacker, StringLen) {
+	const uint8_t bytes[] = {' ', 'f', ' ', ' ', 'o', 0x00};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	size_t len = 0;
+	EXPECT_STREQ(ddproto_unpacker_get_string_sanitized_len(&unpacker, DDPROTO_STRING_SKIP_START_WHITESPACES, &len), "f o");
+	EXPECT_EQ(len, 3);
+}
+
 TEST(Unpacker, Strings) {
-	uint8_t bytes[] = {'f', 'o', 'o', 0x00, 'b', 'a', 'r', 0x00, 'A', 0x02, 0x02, 0x00, 'x'};
+	const uint8_t bytes[] = {'f', 'o', 'o', 0x00, 'b', 'a', 'r', 0x00, 'A', 0x02, 0x02, 0x00, 'x'};
 	DDProtoUnpacker unpacker;
 	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
 
@@ -185,7 +514,7 @@ TEST(Unpacker, Strings) {
 }
 
 TEST(Unpacker, StringsSanitized) {
-	uint8_t bytes[] = {'f', 'o', 'o', 0x00, 'b', 'a', 0x02, 0x03, 0x03, 'r', 0x00, ' ', ' ', 'x', 0x00};
+	const uint8_t bytes[] = {'f', 'o', 'o', 0x00, 'b', 'a', 0x02, 0x03, 0x03, 'r', 0x00, ' ', ' ', 'x', 0x00};
 	DDProtoUnpacker unpacker;
 	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
 
@@ -197,6 +526,108 @@ TEST(Unpacker, StringsSanitized) {
 	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
 }
 
+TEST(Unpacker, StringsImmutable) {
+	const uint8_t bytes[] = {'f', 'o', 'o', 0x00, 'b', 'a', 0x02, 'r', 0x00, 'b', 'a', 0x03, 'z', 0x00};
+	uint8_t copy[sizeof(bytes)];
+	memcpy(copy, bytes, sizeof(bytes));
+
+	// clean strings are not copied
+	uint8_t buf[5];
+	DDProtoStringBuffer strings = {.buf = buf, .len = 0, .capacity = sizeof(buf)};
+	DDProtoDecodeOptions options = {.strings = &strings};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	unpacker.options = &options;
+	EXPECT_EQ(ddproto_unpacker_get_string(&unpacker), (const char *)bytes);
+	EXPECT_EQ(strings.len, 0);
+
+	EXPECT_STREQ(ddproto_unpacker_get_string(&unpacker), "ba r");
+	EXPECT_EQ(strings.len, 5);
+
+	// the string buffer is full and there is no arena
+	const char *str = ddproto_unpacker_get_string(&unpacker);
+	EXPECT_STREQ(str, "ba z");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	EXPECT_TRUE((const uint8_t *)str < buf || (const uint8_t *)str >= buf + sizeof(buf));
+
+	DDProtoArena arena;
+	ddproto_arena_init(&arena, 0);
+	options.arena = &arena;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	unpacker.options = &options;
+	ddproto_unpacker_get_string(&unpacker);
+	ddproto_unpacker_get_string(&unpacker);
+	EXPECT_STREQ(ddproto_unpacker_get_string(&unpacker), "ba z");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	ddproto_arena_free(&arena);
+
+	EXPECT_EQ(memcmp(bytes, copy, sizeof(bytes)), 0);
+}
+
+TEST(Unpacker, StringsScratch) {
+	const uint8_t bytes[] = {'a', 0x01, 'b', 0x00, 'c', 0x02, 'd', 0x00};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	// without memory of their own the strings end up in the scratch buffer
+	const char *first = ddproto_unpacker_get_string(&unpacker);
+	const char *second = ddproto_unpacker_get_string(&unpacker);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	EXPECT_STREQ(first, "a b");
+	EXPECT_STREQ(second, "c d");
+	EXPECT_NE((const uint8_t *)first, bytes);
+	EXPECT_EQ(bytes[1], 0x01);
+
+	// the scratch buffer wraps around but keeps the strings of a packet
+	std::string payload(200, 'x');
+	payload[0] = 0x01;
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	const size_t num_strings = DDPROTO_MAX_PACKET_SIZE / (payload.size() + 1);
+	for(size_t i = 0; i < num_strings; i++) {
+		ddproto_packer_add_string(packer, payload.c_str());
+	}
+	payload[0] = ' ';
+	for(size_t round = 0; round < 4; round++) {
+		ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+		std::vector<const char *> strings;
+		for(size_t i = 0; i < num_strings; i++) {
+			strings.push_back(ddproto_unpacker_get_string(&unpacker));
+		}
+		EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+		for(const char *str : strings) {
+			EXPECT_EQ(str, payload);
+		}
+	}
+}
+
+TEST(Unpacker, StringsUtf8) {
+	uint8_t bytes[] = {'a', 0xce, 0xb2, 0x00, 'b', 0xff, 0x00, 'c', 0x00};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+
+	EXPECT_STREQ(ddproto_unpacker_get_string_sanitized(&unpacker, DDPROTO_STRING_VALIDATE_UTF8), "aβ");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	EXPECT_STREQ(ddproto_unpacker_get_string_sanitized(&unpacker, DDPROTO_STRING_VALIDATE_UTF8), "");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_INVALID_UTF8);
+
+	// not validated unless asked for
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	ddproto_unpacker_get_string(&unpacker);
+	EXPECT_STREQ(ddproto_unpacker_get_string(&unpacker), "b\xff");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+
+	DDProtoDecodeOptions options = {.validate_utf8 = true};
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	unpacker.options = &options;
+	EXPECT_STREQ(ddproto_unpacker_get_string_view(&unpacker).str, "aβ");
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+	DDProtoStringView view = ddproto_unpacker_get_string_view(&unpacker);
+	EXPECT_STREQ(view.str, "");
+	EXPECT_EQ(view.len, 0);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_INVALID_UTF8);
+}
+
 TEST(Unpacker, Booleans) {
 	uint8_t bytes[] = {0x00, 0x01, 0x02, 0xcc};
 	DDProtoUnpacker unpacker;
@@ -224,3 +655,59 @@ TEST(Unpacker, Raw) {
 	EXPECT_EQ(ddproto_unpacker_get_raw(&unpacker, 10), nullptr);
 	EXPECT_EQ(unpacker.err, DDPROTO_ERR_END_OF_BUFFER);
 }
+
+
+TEST(Unpacker, RawInts) {
+	uint8_t bytes[] = {0x05, 0x80, 0x01, 0x03};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	size_t size = 0;
+	EXPECT_EQ(ddproto_unpacker_get_raw_ints(&unpacker, 2, &size), bytes);
+	EXPECT_EQ(size, 3);
+	EXPECT_EQ(ddproto_unpacker_get_int(&unpacker), 3);
+	EXPECT_EQ(unpacker.err, DDPROTO_ERR_NONE);
+}
+
+TEST(Unpacker, SkipInts) {
+	uint8_t bytes[] = {0x05, 0x80, 0x01, 0x02};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, bytes, sizeof(bytes));
+	EXPECT_EQ(ddproto_unpacker_skip_ints(&unpacker, 2), DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_unpacker_get_int(&unpacker), 2);
+	EXPECT_EQ(ddproto_unpacker_skip_ints(&unpacker, 1), DDPROTO_ERR_EMPTY_BUFFER);
+}
+
+TEST(Unpacker, SkipIntsMatchGetInt) {
+	std::mt19937 rng(1234);
+	for(size_t round = 0; round < 2000; round++) {
+		// mostly valid integers of every size and sometimes runs of extend
+		// bits that the fifth byte has to end
+		uint8_t bytes[96];
+		size_t len = 0;
+		while(len < sizeof(bytes)) {
+			if(rng() % 16 == 0) {
+				bytes[len++] = 0x80 | rng();
+				continue;
+			}
+			const size_t size = 1 + rng() % 5;
+			for(size_t i = 0; i < size && len < sizeof(bytes); i++) {
+				bytes[len++] = (i + 1 < size ? 0x80 : 0x00) | (rng() & 0x7f);
+			}
+		}
+		const size_t data_len = rng() % sizeof(bytes);
+		const size_t num = rng() % 40;
+
+		DDProtoUnpacker expected;
+		ddproto_unpacker_init(&expected, bytes, data_len);
+		for(size_t i = 0; i < num && expected.err == DDPROTO_ERR_NONE; i++) {
+			ddproto_unpacker_get_int(&expected);
+		}
+
+		DDProtoUnpacker unpacker;
+		ddproto_unpacker_init(&unpacker, bytes, data_len);
+		EXPECT_EQ(ddproto_unpacker_skip_ints(&unpacker, num), expected.err) << round;
+		if(expected.err == DDPROTO_ERR_NONE) {
+			EXPECT_EQ(unpacker.buf, expected.buf) << round;
+		}
+	}
+}
@@ -117,6 +117,32 @@ TEST(ControlPacket, EncodeCloseWithReason) {
 	EXPECT_TRUE(std::memcmp(bytes, expected, size) == 0);
 }
 
+TEST(ControlPacket, EncodeBufferFull) {
+	DDProtoPacket packet = {
+		.kind = DDPROTO_PACKET_CONTROL,
+		.header = {
+			.flags = DDPROTO_PACKET_FLAG_CONTROL,
+			.token = 0x4ec73b04},
+		.control = {.kind = DDPROTO_CTRL_MSG_CLOSE, .reason = "too bad"}};
+
+	// nothing is written past the end of the buffer
+	for(size_t capacity = 0; capacity < 16; capacity++) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		memset(bytes, 0xaa, sizeof(bytes));
+		DDProtoError err = DDPROTO_ERR_NONE;
+		EXPECT_EQ(ddproto_encode_packet(&packet, bytes, capacity, &err), 0) << capacity;
+		EXPECT_EQ(err, DDPROTO_ERR_BUFFER_FULL) << capacity;
+		for(size_t i = capacity; i < sizeof(bytes); i++) {
+			ASSERT_EQ(bytes[i], 0xaa) << capacity;
+		}
+	}
+
+	uint8_t bytes[16];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_encode_packet(&packet, bytes, sizeof(bytes), &err), 16);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+}
+
 TEST(ControlPacket, EncodeConnect) {
 	DDProtoPacket packet = {
 		.kind = DDPROTO_PACKET_CONTROL,
@@ -0,0 +1,110 @@
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/fetch_chunks.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/msg_system.h>
+#include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "snap_packet.h"
+
+TEST(PacketLazy, DecodeOnDemand) {
+	DDProtoLazyChunk chunks[4];
+	DDProtoLazyPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4};
+
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .chat = true, .compression = compression});
+
+		const DDProtoAllocator global = *ddproto_allocator();
+		DDProtoError err = DDPROTO_ERR_NONE;
+		DDProtoLazyPacket packet = ddproto_decode_packet_lazy(bytes, len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+		EXPECT_EQ(packet.kind, DDPROTO_PACKET_NORMAL);
+		EXPECT_EQ(packet.header.token, 0x3de3948d);
+		ASSERT_EQ(packet.chunks.len, 2);
+		EXPECT_EQ(packet.chunks.data[1].header.sequence, 2);
+
+		DDProtoMessageCategory category;
+		EXPECT_EQ(ddproto_lazy_chunk_message_id(&packet.chunks.data[0], &category), DDPROTO_MSG_SNAPSINGLE);
+		EXPECT_EQ(category, DDPROTO_SYSTEM);
+		EXPECT_EQ(ddproto_lazy_chunk_message_id(&packet.chunks.data[1], &category), DDPROTO_MSG_SV_CHAT);
+		EXPECT_EQ(category, DDPROTO_GAME);
+
+		// the snapshot is never decoded so nothing is allocated
+		DDProtoChunk chunk;
+		ASSERT_EQ(ddproto_decode_lazy_chunk(&packet.chunks.data[1], nullptr, &chunk), DDPROTO_ERR_NONE);
+		EXPECT_EQ(ddproto_allocator()->alloc_calls, global.alloc_calls);
+		ASSERT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_SV_CHAT);
+		EXPECT_EQ(chunk.header.sequence, 2);
+		EXPECT_EQ(chunk.payload.msg.chat.client_id, 3);
+		EXPECT_STREQ(chunk.payload.msg.chat.message, "hello");
+
+		DDProtoSnapItem items[2];
+		int32_t removed_keys[1];
+		DDProtoSnapshotStorage snapshots = {.items = items, .items_capacity = 2, .removed_keys = removed_keys, .removed_keys_capacity = 1};
+		DDProtoDecodeOptions options = {.snap_storage = &snapshots};
+		ASSERT_EQ(ddproto_decode_lazy_chunk(&packet.chunks.data[0], &options, &chunk), DDPROTO_ERR_NONE);
+		ASSERT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_SNAPSINGLE);
+		EXPECT_EQ(chunk.payload.msg.snap_single.snapshot.items.data, items);
+		EXPECT_EQ(items[0].item.pickup.y, SNAP_PICKUP_Y);
+	}
+}
+
+TEST(PacketLazy, SanitizeKeepsDatagram) {
+	DDProtoLazyChunk chunks[4];
+	DDProtoLazyPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4};
+
+	uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+	size_t len = encode_snap_packet(bytes, {.num_snaps = 0, .num_pickups = 0, .chat = true, .compression = DDPROTO_COMPRESSION_NEVER, .chat_message = "he\x01llo"});
+	uint8_t copy[DDPROTO_MAX_PACKET_SIZE];
+	memcpy(copy, bytes, len);
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoLazyPacket packet = ddproto_decode_packet_lazy(bytes, len, &storage, &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(packet.chunks.len, 1);
+
+	DDProtoChunk chunk;
+	ASSERT_EQ(ddproto_decode_lazy_chunk(&packet.chunks.data[0], nullptr, &chunk), DDPROTO_ERR_NONE);
+	EXPECT_STREQ(chunk.payload.msg.chat.message, "he llo");
+	EXPECT_EQ((const uint8_t *)chunk.payload.msg.chat.message, storage.payload);
+	EXPECT_EQ(memcmp(bytes, copy, len), 0);
+}
+
+TEST(PacketLazy, Control) {
+	uint8_t bytes[] = {0x10, 0x00, 0x00, 0x04, 0x4e, 0xc7, 0x3b, 0x04};
+	DDProtoLazyPacketStorage storage = {};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoLazyPacket packet = ddproto_decode_packet_lazy(bytes, sizeof(bytes), &storage, &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.kind, DDPROTO_PACKET_CONTROL);
+	EXPECT_EQ(packet.control.kind, DDPROTO_CTRL_MSG_CLOSE);
+	EXPECT_EQ(packet.header.token, 0x4ec73b04);
+}
+
+TEST(PacketLazy, Errors) {
+	uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+	size_t len = encode_snap_packet(bytes, {.num_snaps = 1, .num_pickups = 2, .chat = true, .compression = DDPROTO_COMPRESSION_NEVER});
+
+	DDProtoLazyChunk chunks[2];
+	DDProtoLazyPacketStorage storage = {.chunks = chunks, .chunks_capacity = 1};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	ddproto_decode_packet_lazy(bytes, len, &storage, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
+
+	// the chat message is cut off
+	storage.chunks_capacity = 2;
+	err = DDPROTO_ERR_NONE;
+	ddproto_decode_packet_lazy(bytes, len - 6, &storage, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_END_OF_BUFFER);
+
+	err = DDPROTO_ERR_NONE;
+	ddproto_decode_packet_lazy(bytes, len - 1, &storage, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_MISSING_DDNET_SECURITY_TOKEN);
+}
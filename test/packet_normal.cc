@@ -1,5 +1,6 @@
 #include <ddnet_protocol/chunk.h>
 #include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/huffman.h>
 #include <ddnet_protocol/message.h>
 #include <ddnet_protocol/packet.h>
 #include <ddnet_protocol/session.h>
@@ -277,3 +278,333 @@ TEST(NormalPacket, EmptyResendRequest) {
 
 	ddproto_free_packet(&packet);
 }
+
+static DDProtoPacket build_input_packet(DDProtoSession *session) {
+	DDProtoMessage messages[3];
+	for(uint8_t i = 0; i < 3; i++) {
+		messages[i] = {};
+		messages[i].kind = DDPROTO_MSG_KIND_INPUT;
+		messages[i].msg.input.ack_game_tick = 1000 + i;
+		messages[i].msg.input.prediction_tick = 1002 + i;
+		messages[i].msg.input.size = 40;
+		messages[i].msg.input.target_x = -20;
+		messages[i].msg.input.target_y = 5;
+	}
+	DDProtoPacket packet = {};
+	DDProtoError err = ddproto_build_packet(&packet, messages, 3, session);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	return packet;
+}
+
+TEST(NormalPacket, PackAutoCompression) {
+	DDProtoSession session = {.sequence = 2, .token = 0x3de3948d};
+	DDProtoPacket packet = build_input_packet(&session);
+
+	uint8_t uncompressed[DDPROTO_MAX_PACKET_SIZE];
+	uint8_t compressed[DDPROTO_MAX_PACKET_SIZE];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t uncompressed_len = ddproto_encode_packet_with_compression(&packet, uncompressed, sizeof(uncompressed), DDPROTO_COMPRESSION_NEVER, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(uncompressed[0] & (DDPROTO_PACKET_FLAG_COMPRESSION << 2), 0);
+	size_t compressed_len = ddproto_encode_packet_with_compression(&packet, compressed, sizeof(compressed), DDPROTO_COMPRESSION_AUTO, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_LT(compressed_len, uncompressed_len);
+	ddproto_free_packet(&packet);
+
+	packet = ddproto_decode_packet(compressed, compressed_len, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.header.flags, DDPROTO_PACKET_FLAG_COMPRESSION);
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+	ASSERT_EQ(packet.chunks.len, 3);
+	for(size_t i = 0; i < 3; i++) {
+		EXPECT_EQ(packet.chunks.data[i].payload.kind, DDPROTO_MSG_KIND_INPUT);
+		EXPECT_EQ(packet.chunks.data[i].payload.msg.input.ack_game_tick, 1000 + i);
+		EXPECT_EQ(packet.chunks.data[i].payload.msg.input.target_x, -20);
+	}
+
+	// the flag from the header compresses again
+	uint8_t repack[DDPROTO_MAX_PACKET_SIZE];
+	size_t repack_len = ddproto_encode_packet(&packet, repack, sizeof(repack), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(repack_len, compressed_len);
+	EXPECT_EQ(std::memcmp(repack, compressed, repack_len), 0);
+	ddproto_free_packet(&packet);
+}
+
+TEST(NormalPacket, PackAutoCompressionSkipsIncompressible) {
+	// printable characters have longer codes than the bytes they replace
+	DDProtoMessage messages[] = {ddproto_build_msg_info("p4ssw0rd!?")};
+	DDProtoSession session = {.sequence = 2, .token = 0x3de3948d};
+	DDProtoPacket packet = {};
+	DDProtoError err = ddproto_build_packet(&packet, messages, 1, &session);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+
+	uint8_t uncompressed[DDPROTO_MAX_PACKET_SIZE];
+	uint8_t automatic[DDPROTO_MAX_PACKET_SIZE];
+	uint8_t always[DDPROTO_MAX_PACKET_SIZE];
+	size_t uncompressed_len = ddproto_encode_packet_with_compression(&packet, uncompressed, sizeof(uncompressed), DDPROTO_COMPRESSION_NEVER, &err);
+	size_t automatic_len = ddproto_encode_packet_with_compression(&packet, automatic, sizeof(automatic), DDPROTO_COMPRESSION_AUTO, &err);
+	size_t always_len = ddproto_encode_packet_with_compression(&packet, always, sizeof(always), DDPROTO_COMPRESSION_ALWAYS, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_GE(always_len, uncompressed_len);
+	EXPECT_EQ(always[0] & (DDPROTO_PACKET_FLAG_COMPRESSION << 2), DDPROTO_PACKET_FLAG_COMPRESSION << 2);
+	ASSERT_EQ(automatic_len, uncompressed_len);
+	EXPECT_EQ(std::memcmp(automatic, uncompressed, automatic_len), 0);
+	ddproto_free_packet(&packet);
+}
+
+// compresses the payload of an uncompressed packet
+static size_t compress_packet(const uint8_t *bytes, size_t len, uint8_t *compressed, size_t compressed_len) {
+	DDProtoError err = DDPROTO_ERR_NONE;
+	memcpy(compressed, bytes, DDPROTO_PACKET_HEADER_SIZE);
+	compressed[0] |= DDPROTO_PACKET_FLAG_COMPRESSION << 2;
+	size_t size = ddproto_huffman_compress(bytes + DDPROTO_PACKET_HEADER_SIZE, len - DDPROTO_PACKET_HEADER_SIZE, compressed + DDPROTO_PACKET_HEADER_SIZE, compressed_len - DDPROTO_PACKET_HEADER_SIZE, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	return DDPROTO_PACKET_HEADER_SIZE + size;
+}
+
+TEST(NormalPacket, CompressedStartInfoAndUnknown) {
+	// the chunks of the StartInfoAndRconCmd and UnknownFakeMessage tests
+	uint8_t bytes[] = {
+		0x00, 0x06, 0x03, 0x42, 0x0d, 0x05, 0x28, 0x43,
+		0x68, 0x69, 0x6c, 0x6c, 0x65, 0x72, 0x44, 0x72,
+		0x61, 0x67, 0x6f, 0x6e, 0x00, 0x7c, 0x2a, 0x4b,
+		0x6f, 0x47, 0x2a, 0x7c, 0x00, 0x80, 0x01, 0x67,
+		0x72, 0x65, 0x65, 0x6e, 0x73, 0x77, 0x61, 0x72,
+		0x64, 0x00, 0x00, 0x87, 0xc5, 0x8d, 0x0e, 0x8e,
+		0xab, 0x9e, 0x02, 0x40, 0x0c, 0x06, 0x23, 0x63,
+		0x72, 0x61, 0x73, 0x68, 0x6d, 0x65, 0x70, 0x6c,
+		0x78, 0x00, 0x40, 0x06, 0x03, 0x87, 0x03, 'A',
+		'B', 'C', 0x00, 0x3d, 0xe3, 0x94, 0x8d};
+	uint8_t compressed[DDPROTO_MAX_PACKET_SIZE];
+	size_t compressed_len = compress_packet(bytes, sizeof(bytes), compressed, sizeof(compressed));
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoPacket packet = ddproto_decode_packet(compressed, compressed_len, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.kind, DDPROTO_PACKET_NORMAL);
+	EXPECT_EQ(packet.header.flags, DDPROTO_PACKET_FLAG_COMPRESSION);
+	EXPECT_EQ(packet.header.ack, 6);
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+	ASSERT_EQ(packet.chunks.len, 3);
+
+	EXPECT_EQ(packet.chunks.data[0].payload.kind, DDPROTO_MSG_KIND_CL_STARTINFO);
+	DDProtoMsgClStartInfo start_info = packet.chunks.data[0].payload.msg.start_info;
+	EXPECT_STREQ(start_info.name, "ChillerDragon");
+	EXPECT_STREQ(start_info.clan, "|*KoG*|");
+	EXPECT_EQ(start_info.country, 64);
+	EXPECT_STREQ(start_info.skin, "greensward");
+	EXPECT_EQ(start_info.color_body, 14790983);
+	EXPECT_EQ(start_info.color_feet, 2345678);
+
+	EXPECT_EQ(packet.chunks.data[1].payload.kind, DDPROTO_MSG_KIND_RCON_CMD);
+	EXPECT_STREQ(packet.chunks.data[1].payload.msg.rcon_cmd.command, "crashmeplx");
+
+	EXPECT_EQ(packet.chunks.data[2].payload.kind, DDPROTO_MSG_KIND_UNKNOWN);
+	uint8_t unknown[] = {0x87, 0x03, 'A', 'B', 'C', 0x00};
+	ASSERT_EQ(packet.chunks.data[2].payload.msg.unknown.len, sizeof(unknown));
+	EXPECT_EQ(std::memcmp(packet.chunks.data[2].payload.msg.unknown.buf, unknown, sizeof(unknown)), 0);
+
+	uint8_t repack[DDPROTO_MAX_PACKET_SIZE];
+	size_t repack_len = ddproto_encode_packet(&packet, repack, sizeof(repack), &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ASSERT_EQ(repack_len, compressed_len);
+	EXPECT_EQ(std::memcmp(repack, compressed, repack_len), 0);
+	ddproto_free_packet(&packet);
+}
+
+TEST(NormalPacket, CompressedErrors) {
+	// one say chunk, the token and one byte too much
+	uint8_t bytes[] = {0x00, 0x00, 0x01, 0x00, 0x05, 0x22, 0x00, 'h', 'i', 0x00, 0x3d, 0xe3, 0x94, 0x8d, 0x00};
+	uint8_t compressed[DDPROTO_MAX_PACKET_SIZE];
+	DDProtoError err = DDPROTO_ERR_NONE;
+
+	size_t compressed_len = compress_packet(bytes, sizeof(bytes) - 1, compressed, sizeof(compressed));
+	DDProtoPacket packet = ddproto_decode_packet(compressed, compressed_len, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+	ASSERT_EQ(packet.chunks.len, 1);
+	EXPECT_STREQ(packet.chunks.data[0].payload.msg.say.message, "hi");
+	ddproto_free_packet(&packet);
+
+	compressed_len = compress_packet(bytes, sizeof(bytes), compressed, sizeof(compressed));
+	packet = ddproto_decode_packet(compressed, compressed_len, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_REMAINING_BYTES_IN_BUFFER);
+	ddproto_free_packet(&packet);
+
+	err = DDPROTO_ERR_NONE;
+	compressed_len = compress_packet(bytes, sizeof(bytes) - 3, compressed, sizeof(compressed));
+	packet = ddproto_decode_packet(compressed, compressed_len, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_MISSING_DDNET_SECURITY_TOKEN);
+	ddproto_free_packet(&packet);
+
+	err = DDPROTO_ERR_NONE;
+	compressed_len = compress_packet(bytes, sizeof(bytes) - 1, compressed, sizeof(compressed));
+	packet = ddproto_decode_packet(compressed, compressed_len - 1, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_END_OF_BUFFER);
+	ddproto_free_packet(&packet);
+}
+
+TEST(NormalPacket, EncodedSize) {
+	DDProtoMessage messages[] = {
+		ddproto_build_msg_info("secret"),
+		{.kind = DDPROTO_MSG_KIND_ENTERGAME},
+		{.kind = DDPROTO_MSG_KIND_READY},
+		{.kind = DDPROTO_MSG_KIND_SV_CHAT, .msg = {.chat = {.team = DDPROTO_CHAT_WHISPER_RECEIVE, .client_id = 63, .message = "hello"}}},
+		{.kind = DDPROTO_MSG_KIND_SV_KILLMSG, .msg = {.kill_msg = {.killer_id = 2, .victim_id = 100000, .weapon = DDPROTO_WEAPON_GAME, .mode_special = 1 << 30}}},
+		{.kind = DDPROTO_MSG_KIND_SV_TUNEPARAMS, .msg = {.tune_params = {.ground_control_speed = 10.0f, .gravity = -0.5f}}},
+		{.kind = DDPROTO_MSG_KIND_CL_STARTINFO, .msg = {.start_info = {.name = "nameless tee", .clan = "", .country = 276, .skin = "default", .color_body = 0xff00ff}}},
+	};
+
+	for(DDProtoMessage &message : messages) {
+		DDProtoChunk chunk = {.payload = message};
+		uint8_t buf[DDPROTO_PACKER_BUFFER_SIZE];
+		DDProtoError err = DDPROTO_ERR_NONE;
+		size_t size = ddproto_message_encoded_size(&message, &err);
+		EXPECT_EQ(err, DDPROTO_ERR_NONE);
+		EXPECT_EQ(size, ddproto_encode_message(&chunk, buf, &err)) << message.kind;
+		EXPECT_EQ(err, DDPROTO_ERR_NONE);
+		EXPECT_LE(size, ddproto_message_max_size(message.kind)) << message.kind;
+	}
+
+	DDProtoMessage snap = {.kind = DDPROTO_MSG_KIND_SNAPSINGLE};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_message_encoded_size(&snap, &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_UNKNOWN_MESSAGE);
+}
+
+TEST(NormalPacket, MessageKinds) {
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_SYSTEM, DDPROTO_MSG_PING), DDPROTO_MSG_KIND_PING);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_SYSTEM, DDPROTO_MSG_MAP_DATA), DDPROTO_MSG_KIND_MAP_DATA);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_GAME, DDPROTO_MSG_CL_STARTINFO), DDPROTO_MSG_KIND_CL_STARTINFO);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_GAME, (DDProtoMessageId)7), DDPROTO_MSG_KIND_UNKNOWN);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_SYSTEM, DDPROTO_MSG_NULL), DDPROTO_MSG_KIND_UNKNOWN);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_SYSTEM, (DDProtoMessageId)-1), DDPROTO_MSG_KIND_UNKNOWN);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_GAME, (DDProtoMessageId)99), DDPROTO_MSG_KIND_UNKNOWN);
+
+	// the message id and every integer as five bytes
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_READY), 1);
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_SNAPEMPTY), 11);
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_RCON_AUTH_STATUS), 3);
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_INPUT), 1 + 13 * 5);
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_SV_CHAT), DDPROTO_MAX_PACKET_SIZE);
+	EXPECT_EQ(ddproto_message_max_size(DDPROTO_MSG_KIND_UNKNOWN), DDPROTO_MAX_PACKET_SIZE);
+}
+
+TEST(NormalPacket, MessageRoundTrip) {
+	const uint8_t data[] = {1, 2, 3, 4, 5};
+	DDProtoMessage messages[] = {
+		{.kind = DDPROTO_MSG_KIND_PING},
+		{.kind = DDPROTO_MSG_KIND_PING_REPLY},
+		{.kind = DDPROTO_MSG_KIND_SNAP, .msg = {.snap = {.game_tick = 500, .delta_tick = 450, .num_parts = 3, .part = 1, .crc = -77, .part_size = 5, .data = data}}},
+		{.kind = DDPROTO_MSG_KIND_SNAPEMPTY, .msg = {.snap_empty = {.game_tick = 501, .delta_tick = 500}}},
+		{.kind = DDPROTO_MSG_KIND_SNAPSMALL, .msg = {.snap_small = {.game_tick = 502, .delta_tick = 501, .crc = 9, .part_size = 4, .data = data}}},
+		{.kind = DDPROTO_MSG_KIND_MAP_DATA, .msg = {.map_data = {.last = true, .map_crc = 1234, .chunk = 7, .chunk_size = 5, .data = data}}},
+		{.kind = DDPROTO_MSG_KIND_SV_EMOTICON, .msg = {.emoticon = {.client_id = 3, .emoticon = DDPROTO_EMOTICON_GHOST}}},
+		{.kind = DDPROTO_MSG_KIND_SV_VOTEOPTIONLISTADD, .msg = {.vote_option_list_add = {.num_options = 2, .descriptions = {"kick", "restart"}}}},
+		{.kind = DDPROTO_MSG_KIND_CL_SAY, .msg = {.say = {.team = DDPROTO_CHAT_TEAM, .message = "gg"}}},
+	};
+
+	for(const DDProtoMessage &message : messages) {
+		DDProtoChunk chunk = {.payload = message};
+		uint8_t buf[DDPROTO_PACKER_BUFFER_SIZE];
+		DDProtoError err = DDPROTO_ERR_NONE;
+		chunk.header.size = ddproto_encode_message(&chunk, buf, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE) << message.kind;
+		EXPECT_EQ(chunk.header.size, ddproto_message_encoded_size(&message, &err));
+
+		DDProtoChunk decoded = {.header = chunk.header};
+		EXPECT_EQ(ddproto_decode_message(&decoded, buf), DDPROTO_ERR_NONE) << message.kind;
+		EXPECT_EQ(decoded.payload.kind, message.kind);
+	}
+
+	DDProtoChunk chunk = {.payload = messages[2]};
+	uint8_t buf[DDPROTO_PACKER_BUFFER_SIZE];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	chunk.header.size = ddproto_encode_message(&chunk, buf, &err);
+	ASSERT_EQ(ddproto_decode_message(&chunk, buf), DDPROTO_ERR_NONE);
+	const DDProtoMsgSnap &snap = chunk.payload.msg.snap;
+	EXPECT_EQ(snap.game_tick, 500);
+	EXPECT_EQ(snap.num_parts, 3);
+	EXPECT_EQ(snap.part, 1);
+	EXPECT_EQ(snap.crc, -77);
+	ASSERT_EQ(snap.part_size, 5);
+	EXPECT_EQ(std::memcmp(snap.data, data, sizeof(data)), 0);
+
+	chunk = {.payload = messages[7]};
+	chunk.header.size = ddproto_encode_message(&chunk, buf, &err);
+	ASSERT_EQ(ddproto_decode_message(&chunk, buf), DDPROTO_ERR_NONE);
+	const DDProtoMsgSvVoteOptionListAdd &votes = chunk.payload.msg.vote_option_list_add;
+	EXPECT_EQ(votes.num_options, 2);
+	EXPECT_STREQ(votes.descriptions[1], "restart");
+	EXPECT_EQ(votes.descriptions[2], nullptr);
+
+	chunk = {.payload = messages[8]};
+	chunk.header.size = ddproto_encode_message(&chunk, buf, &err);
+	ASSERT_EQ(ddproto_decode_message(&chunk, buf), DDPROTO_ERR_NONE);
+	EXPECT_EQ(chunk.payload.msg.say.team, DDPROTO_CHAT_TEAM);
+	EXPECT_STREQ(chunk.payload.msg.say.message, "gg");
+	EXPECT_EQ(chunk.payload.msg.say.message_len, 2);
+}
+
+TEST(NormalPacket, DecodeMessageSanitized) {
+	const uint8_t bytes[] = {0x06, 0x00, 0x01, 'a', 0x01, 'b', 0x00};
+	DDProtoChunk chunk = {};
+	chunk.header.size = sizeof(bytes);
+	ASSERT_EQ(ddproto_decode_message(&chunk, bytes), DDPROTO_ERR_NONE);
+	ASSERT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_SV_CHAT);
+	EXPECT_EQ(chunk.payload.msg.chat.client_id, 1);
+	EXPECT_STREQ(chunk.payload.msg.chat.message, "a b");
+	EXPECT_EQ(chunk.payload.msg.chat.message_len, 3);
+	EXPECT_EQ(bytes[4], 0x01);
+}
+
+TEST(NormalPacket, PackBufferFull) {
+	DDProtoMessage messages[] = {
+		{.kind = DDPROTO_MSG_KIND_SV_CHAT, .msg = {.chat = {.team = DDPROTO_CHAT_PUBLIC, .client_id = 1, .message = "first"}}},
+		{.kind = DDPROTO_MSG_KIND_SV_CHAT, .msg = {.chat = {.team = DDPROTO_CHAT_PUBLIC, .client_id = 2, .message = "second"}}},
+	};
+	DDProtoSession session = {.sequence = 0, .token = 0x3de3948d};
+	DDProtoPacket packet = {};
+	ASSERT_EQ(ddproto_build_packet(&packet, messages, 2, &session), DDPROTO_ERR_NONE);
+
+	uint8_t buf[DDPROTO_MAX_PACKET_SIZE];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t len = ddproto_encode_packet(&packet, buf, sizeof(buf), &err);
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(len, DDPROTO_PACKET_HEADER_SIZE + 3 + packet.chunks.data[0].header.size + 3 + packet.chunks.data[1].header.size + sizeof(DDProtoToken));
+
+	// nothing is written past the end of the buffer
+	for(size_t capacity = 0; capacity < len; capacity++) {
+		uint8_t small[DDPROTO_MAX_PACKET_SIZE];
+		memset(small, 0xaa, sizeof(small));
+		err = DDPROTO_ERR_NONE;
+		EXPECT_EQ(ddproto_encode_packet(&packet, small, capacity, &err), 0) << capacity;
+		EXPECT_EQ(err, DDPROTO_ERR_BUFFER_FULL) << capacity;
+		for(size_t i = capacity; i < sizeof(small); i++) {
+			ASSERT_EQ(small[i], 0xaa) << capacity;
+		}
+	}
+
+	err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_encode_packet(&packet, buf, len, &err), len);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	ddproto_free_packet(&packet);
+}
+
+TEST(NormalPacket, PackInvalidMessage) {
+	DDProtoChunk chunks[2] = {};
+	chunks[0].payload.kind = DDPROTO_MSG_KIND_READY;
+	chunks[1].payload.kind = (DDProtoMessageKind)200;
+	DDProtoPacket packet = {};
+	packet.kind = DDPROTO_PACKET_NORMAL;
+	packet.header = {.flags = 0, .ack = 0, .num_chunks = 2, .token = 0x3de3948d};
+	packet.chunks.data = chunks;
+	packet.chunks.len = 2;
+
+	// no chunk with a bogus size is written
+	uint8_t buf[DDPROTO_MAX_PACKET_SIZE];
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_encode_packet(&packet, buf, sizeof(buf), &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_UNKNOWN_MESSAGE);
+}
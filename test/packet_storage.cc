@@ -0,0 +1,210 @@
+#include <ddnet_protocol/allocator.h>
+#include <ddnet_protocol/chunk.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/packet.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+#include "snap_packet.h"
+
+static void expect_snap_chunks(const DDProtoPacket &packet, size_t num_chunks, size_t num_pickups) {
+	ASSERT_EQ(packet.chunks.len, num_chunks);
+	for(size_t i = 0; i < num_chunks; i++) {
+		ASSERT_EQ(packet.chunks.data[i].payload.kind, DDPROTO_MSG_KIND_SNAPSINGLE);
+		const DDProtoMsgSnapSingle &snap_single = packet.chunks.data[i].payload.msg.snap_single;
+		EXPECT_EQ(snap_single.game_tick, SNAP_GAME_TICK);
+		ASSERT_EQ(snap_single.snapshot.removed_keys.len, 1);
+		EXPECT_EQ(snap_single.snapshot.removed_keys.data[0], SNAP_REMOVED_KEY);
+		ASSERT_EQ(snap_single.snapshot.items.len, num_pickups);
+		for(size_t k = 0; k < num_pickups; k++) {
+			const DDProtoSnapItem &item = snap_single.snapshot.items.data[k];
+			ASSERT_EQ(item.kind, DDPROTO_ITEM_KIND_PICKUP);
+			EXPECT_EQ(item.item.pickup.id, k);
+			EXPECT_EQ(item.item.pickup.y, SNAP_PICKUP_Y + k);
+		}
+	}
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+}
+
+TEST(PacketStorage, Uncompressed) {
+	uint8_t bytes[] = {
+		0x00, 0x00, 0x01, 0x41, 0x07, 0x03, 0x03, 0x30,
+		0x2e, 0x36, 0x20, 0x36, 0x32, 0x36, 0x66, 0x63,
+		0x65, 0x39, 0x61, 0x37, 0x37, 0x38, 0x64, 0x66,
+		0x34, 0x64, 0x34, 0x00, 0x00, 0x3d, 0xe3, 0x94,
+		0x8d};
+
+	DDProtoChunk chunks[4];
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoPacket packet = ddproto_decode_packet_into(bytes, sizeof(bytes), &storage, &err);
+
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.kind, DDPROTO_PACKET_NORMAL);
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+	ASSERT_EQ(packet.chunks.len, 1);
+	EXPECT_EQ(packet.chunks.data, chunks);
+	EXPECT_STREQ(packet.chunks.data[0].payload.msg.info.version, "0.6 626fce9a778df4d4");
+
+	// the payload and its strings are borrowed from the datagram
+	EXPECT_EQ(packet.payload, bytes + DDPROTO_PACKET_HEADER_SIZE);
+	EXPECT_EQ(packet.payload_len, sizeof(bytes) - DDPROTO_PACKET_HEADER_SIZE);
+	EXPECT_EQ((const uint8_t *)packet.chunks.data[0].payload.msg.info.version, bytes + 7);
+}
+
+TEST(PacketStorage, SanitizeKeepsDatagram) {
+	DDProtoChunk chunks[4];
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4};
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 0, .num_pickups = 0, .chat = true, .compression = compression, .chat_message = "he\x01llo"});
+		uint8_t copy[DDPROTO_MAX_PACKET_SIZE];
+		memcpy(copy, bytes, len);
+
+		DDProtoError err = DDPROTO_ERR_NONE;
+		DDProtoPacket packet = ddproto_decode_packet_into(bytes, len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE);
+		ASSERT_EQ(packet.chunks.len, 1);
+		const DDProtoMsgSvChat &chat = packet.chunks.data[0].payload.msg.chat;
+		EXPECT_STREQ(chat.message, "he llo");
+		EXPECT_EQ(chat.message_len, 6);
+		EXPECT_GE((const uint8_t *)chat.message, storage.payload);
+		EXPECT_LT((const uint8_t *)chat.message, storage.payload + sizeof(storage.payload));
+		EXPECT_EQ(memcmp(bytes, copy, len), 0);
+	}
+}
+
+TEST(PacketStorage, Control) {
+	uint8_t bytes[] = {0x10, 0x00, 0x00, 0x04, 'b', 'y', 'e', 0x00, 0x3d, 0xe3, 0x94, 0x8d};
+
+	DDProtoPacketStorage storage = {};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	DDProtoPacket packet = ddproto_decode_packet_into(bytes, sizeof(bytes), &storage, &err);
+
+	ASSERT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(packet.kind, DDPROTO_PACKET_CONTROL);
+	EXPECT_EQ(packet.control.kind, DDPROTO_CTRL_MSG_CLOSE);
+	EXPECT_STREQ(packet.control.reason, "bye");
+	EXPECT_EQ(packet.header.token, 0x3de3948d);
+}
+
+TEST(PacketStorage, Snapshots) {
+	DDProtoChunk chunks[4];
+	DDProtoSnapItem items[16];
+	int32_t removed_keys[4];
+	DDProtoSnapshotStorage snapshots = {
+		.items = items,
+		.items_capacity = 16,
+		.removed_keys = removed_keys,
+		.removed_keys_capacity = 4,
+	};
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4, .snapshots = &snapshots};
+
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 2, .num_pickups = 5, .compression = compression});
+
+		// the storage is emptied for every packet
+		for(size_t round = 0; round < 2; round++) {
+			DDProtoError err = DDPROTO_ERR_NONE;
+			DDProtoPacket packet = ddproto_decode_packet_into(bytes, len, &storage, &err);
+			ASSERT_EQ(err, DDPROTO_ERR_NONE) << compression;
+			expect_snap_chunks(packet, 2, 5);
+			EXPECT_EQ(packet.chunks.data[0].payload.msg.snap_single.snapshot.items.data, items);
+			EXPECT_EQ(packet.chunks.data[1].payload.msg.snap_single.snapshot.items.data, items + 5);
+			EXPECT_EQ(packet.chunks.data[1].payload.msg.snap_single.snapshot.removed_keys.data, removed_keys + 1);
+			EXPECT_EQ(snapshots.items_len, 10);
+			EXPECT_EQ(snapshots.removed_keys_len, 2);
+		}
+	}
+}
+
+TEST(PacketStorage, CapacityExceeded) {
+	DDProtoChunk chunks[4];
+	DDProtoSnapItem items[8];
+	int32_t removed_keys[4];
+	DDProtoSnapshotStorage snapshots = {
+		.items = items,
+		.items_capacity = 8,
+		.removed_keys = removed_keys,
+		.removed_keys_capacity = 4,
+	};
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 1, .snapshots = &snapshots};
+
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 2, .num_pickups = 5, .compression = compression});
+
+		storage.chunks_capacity = 1;
+		DDProtoError err = DDPROTO_ERR_NONE;
+		ddproto_decode_packet_into(bytes, len, &storage, &err);
+		EXPECT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL) << compression;
+
+		// the second snapshot does not fit into the items
+		storage.chunks_capacity = 4;
+		err = DDPROTO_ERR_NONE;
+		ddproto_decode_packet_into(bytes, len, &storage, &err);
+		EXPECT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL) << compression;
+		EXPECT_EQ(snapshots.items_len, 5);
+
+		// without snapshot storage the items are allocated
+		storage.snapshots = nullptr;
+		err = DDPROTO_ERR_NONE;
+		DDProtoPacket packet = ddproto_decode_packet_into(bytes, len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE) << compression;
+		expect_snap_chunks(packet, 2, 5);
+		for(size_t i = 0; i < packet.chunks.len; i++) {
+			ddproto_free_snapshot(&packet.chunks.data[i].payload.msg.snap_single.snapshot);
+		}
+		storage.snapshots = &snapshots;
+	}
+}
+
+TEST(PacketStorage, Kinds) {
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_SYSTEM, DDPROTO_MSG_SNAPSINGLE), DDPROTO_MSG_KIND_SNAPSINGLE);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_GAME, DDPROTO_MSG_SV_CHAT), DDPROTO_MSG_KIND_SV_CHAT);
+	EXPECT_EQ(ddproto_message_kind(DDPROTO_GAME, (DDProtoMessageId)99), DDPROTO_MSG_KIND_UNKNOWN);
+
+	DDProtoChunk chunks[4];
+	DDProtoPacketStorage storage = {.chunks = chunks, .chunks_capacity = 4};
+	for(DDProtoCompression compression : {DDPROTO_COMPRESSION_NEVER, DDPROTO_COMPRESSION_ALWAYS}) {
+		uint8_t bytes[DDPROTO_MAX_PACKET_SIZE];
+		size_t len = encode_snap_packet(bytes, {.num_snaps = 2, .num_pickups = 5, .compression = compression});
+
+		// the snapshots are neither decoded nor allocated
+		storage.kinds = DDPROTO_MSG_KIND_BIT(DDPROTO_MSG_KIND_SV_CHAT);
+		const DDProtoAllocator global = *ddproto_allocator();
+		DDProtoError err = DDPROTO_ERR_NONE;
+		DDProtoPacket packet = ddproto_decode_packet_into(bytes, len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE) << compression;
+		EXPECT_EQ(ddproto_allocator()->alloc_calls, global.alloc_calls);
+		EXPECT_EQ(packet.header.token, 0x3de3948d);
+		ASSERT_EQ(packet.chunks.len, 2);
+		for(size_t i = 0; i < 2; i++) {
+			const DDProtoChunk &chunk = packet.chunks.data[i];
+			EXPECT_EQ(chunk.payload.kind, DDPROTO_MSG_KIND_UNKNOWN);
+			ASSERT_EQ(chunk.payload.msg.unknown.len, chunk.header.size);
+			EXPECT_EQ(chunk.payload.msg.unknown.buf[0], (DDPROTO_MSG_SNAPSINGLE << 1) | DDPROTO_SYSTEM);
+		}
+
+		// wanted kinds are decoded as usual
+		DDProtoSnapItem items[16];
+		int32_t removed_keys[4];
+		DDProtoSnapshotStorage snapshots = {
+			.items = items,
+			.items_capacity = 16,
+			.removed_keys = removed_keys,
+			.removed_keys_capacity = 4,
+		};
+		storage.snapshots = &snapshots;
+		storage.kinds = DDPROTO_MSG_KIND_BIT(DDPROTO_MSG_KIND_SV_CHAT) | DDPROTO_MSG_KIND_BIT(DDPROTO_MSG_KIND_SNAPSINGLE);
+		packet = ddproto_decode_packet_into(bytes, len, &storage, &err);
+		ASSERT_EQ(err, DDPROTO_ERR_NONE) << compression;
+		expect_snap_chunks(packet, 2, 5);
+		storage.snapshots = nullptr;
+	}
+}
@@ -202,6 +202,7 @@ TEST(NormalPacket, TuneParams) {
 	EXPECT_EQ(chat.team, DDPROTO_CHAT_PUBLIC);
 	EXPECT_EQ(chat.client_id, 15);
 	EXPECT_STREQ(chat.message, "(invalid): Do you know someone who uses a bot? Please report them to the moderators.");
+	EXPECT_EQ(chat.message_len, strlen(chat.message));
 
 	msg = &packet.chunks.data[7].payload;
 	EXPECT_EQ(msg->kind, DDPROTO_MSG_KIND_SV_VOTEOPTIONADD);
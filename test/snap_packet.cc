@@ -0,0 +1,60 @@
+#include "snap_packet.h"
+
+#include <ddnet_protocol/chunk.h>
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/message.h>
+#include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/snapshot.h>
+
+#include <gtest/gtest.h>
+
+size_t encode_snap_packet(uint8_t *buf, const SnapPacketOptions &options) {
+	DDProtoPackerBuffer snap_buffer;
+	DDProtoPacker *snap = ddproto_packer_init(&snap_buffer);
+	ddproto_packer_add_int(snap, (DDPROTO_MSG_SNAPSINGLE << 1) | DDPROTO_SYSTEM);
+	ddproto_packer_add_int(snap, SNAP_GAME_TICK);
+	ddproto_packer_add_int(snap, SNAP_GAME_TICK - 1); // delta tick
+	ddproto_packer_add_int(snap, 0); // crc
+	ddproto_packer_add_int(snap, 0); // part size
+	ddproto_packer_add_int(snap, 1); // removed keys
+	ddproto_packer_add_int(snap, options.num_pickups); // items
+	ddproto_packer_add_int(snap, 0);
+	ddproto_packer_add_int(snap, SNAP_REMOVED_KEY);
+	for(size_t i = 0; i < options.num_pickups; i++) {
+		ddproto_packer_add_int(snap, DDPROTO_ITEM_PICKUP);
+		ddproto_packer_add_int(snap, i);
+		ddproto_packer_add_int(snap, SNAP_PICKUP_X);
+		ddproto_packer_add_int(snap, SNAP_PICKUP_Y + i);
+		ddproto_packer_add_int(snap, 1);
+		ddproto_packer_add_int(snap, 0);
+	}
+	EXPECT_EQ(snap->err, DDPROTO_ERR_NONE);
+
+	DDProtoPackerBuffer chat_buffer;
+	DDProtoPacker *chat = ddproto_packer_init(&chat_buffer);
+	ddproto_packer_add_int(chat, (DDPROTO_MSG_SV_CHAT << 1) | DDPROTO_GAME);
+	ddproto_packer_add_int(chat, DDPROTO_CHAT_PUBLIC);
+	ddproto_packer_add_int(chat, 3);
+	ddproto_packer_add_string(chat, options.chat_message ? options.chat_message : "hello");
+	EXPECT_EQ(chat->err, DDPROTO_ERR_NONE);
+
+	DDProtoChunk chunks[8] = {};
+	const size_t num_chunks = options.num_snaps + options.chat;
+	EXPECT_LE(num_chunks, 8);
+	for(size_t i = 0; i < num_chunks; i++) {
+		DDProtoPacker *packer = i < options.num_snaps ? snap : chat;
+		chunks[i].header = {.flags = DDPROTO_CHUNK_FLAG_VITAL, .size = (uint16_t)ddproto_packer_size(packer), .sequence = (uint16_t)(i + 1)};
+		chunks[i].payload.kind = DDPROTO_MSG_KIND_UNKNOWN;
+		chunks[i].payload.msg.unknown = {.buf = ddproto_packer_data(packer), .len = ddproto_packer_size(packer)};
+	}
+	DDProtoPacket packet = {};
+	packet.kind = DDPROTO_PACKET_NORMAL;
+	packet.header = {.flags = 0, .ack = 0, .num_chunks = (uint8_t)num_chunks, .token = 0x3de3948d};
+	packet.chunks.data = chunks;
+	packet.chunks.len = num_chunks;
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	size_t len = ddproto_encode_packet_with_compression(&packet, buf, DDPROTO_MAX_PACKET_SIZE, options.compression, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	return len;
+}
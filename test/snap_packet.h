@@ -0,0 +1,28 @@
+#pragma once
+
+#include <ddnet_protocol/packet.h>
+
+// the snapshots built by encode_snap_packet have this game tick and removed
+// key. Pickup `i` has the id `i` and is at SNAP_PICKUP_X, SNAP_PICKUP_Y + `i`
+#define SNAP_GAME_TICK 1420
+#define SNAP_REMOVED_KEY 42
+#define SNAP_PICKUP_X 100
+#define SNAP_PICKUP_Y 200
+
+struct SnapPacketOptions {
+	// amount of snap single chunks
+	size_t num_snaps;
+	size_t num_pickups;
+
+	// appends a public chat message "hello" of client 3
+	bool chat;
+
+	DDProtoCompression compression;
+
+	// sent instead of "hello" if it is set
+	const char *chat_message;
+};
+
+// packs a packet of vital chunks with the sequence numbers 1, 2, ... into
+// `buf` which has to fit DDPROTO_MAX_PACKET_SIZE bytes. Returns its size
+size_t encode_snap_packet(uint8_t *buf, const SnapPacketOptions &options);
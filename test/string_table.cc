@@ -0,0 +1,223 @@
+#include <ddnet_protocol/errors.h>
+#include <ddnet_protocol/int_string.h>
+#include <ddnet_protocol/packer.h>
+#include <ddnet_protocol/snapshot.h>
+#include <ddnet_protocol/string_table.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+TEST(StringTable, Intern) {
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+
+	uint32_t name[4];
+	uint32_t other[4];
+	uint32_t skin[6];
+	ASSERT_EQ(ddproto_str_to_ints(name, 4, "nameless tee"), DDPROTO_ERR_NONE);
+	ASSERT_EQ(ddproto_str_to_ints(other, 4, "brainless tee"), DDPROTO_ERR_NONE);
+	ASSERT_EQ(ddproto_str_to_ints(skin, 6, "nameless tee"), DDPROTO_ERR_NONE);
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	uint32_t name_id = ddproto_string_table_intern(&table, name, 4, false, &err);
+	uint32_t other_id = ddproto_string_table_intern(&table, other, 4, false, &err);
+	uint32_t skin_id = ddproto_string_table_intern(&table, skin, 6, false, &err);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(name_id, 1);
+	EXPECT_EQ(other_id, 2);
+	// keyed by the packed integers which are padded differently
+	EXPECT_EQ(skin_id, 3);
+	EXPECT_EQ(ddproto_string_table_intern(&table, name, 4, false, &err), name_id);
+	EXPECT_EQ(table.len, 3);
+
+	EXPECT_STREQ(ddproto_string_table_str(&table, name_id), "nameless tee");
+	EXPECT_STREQ(ddproto_string_table_str(&table, other_id), "brainless tee");
+	EXPECT_STREQ(ddproto_string_table_str(&table, skin_id), "nameless tee");
+	EXPECT_STREQ(ddproto_string_table_str(&table, 0), "");
+
+	uint32_t too_long[DDPROTO_STRING_TABLE_MAX_INTS + 1] = {};
+	EXPECT_EQ(ddproto_string_table_intern(&table, too_long, DDPROTO_STRING_TABLE_MAX_INTS + 1, false, &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_OUTPUT_VAR_TOO_SMALL);
+	EXPECT_EQ(ddproto_string_table_intern(&table, too_long, DDPROTO_STRING_TABLE_MAX_INTS + 1, false, nullptr), 0);
+
+	ddproto_string_table_free(&table);
+	EXPECT_EQ(table.len, 0);
+	EXPECT_EQ(table.entries, nullptr);
+}
+
+TEST(StringTable, Grow) {
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	for(size_t round = 0; round < 2; round++) {
+		for(size_t i = 0; i < 1000; i++) {
+			uint32_t ints[4];
+			ASSERT_EQ(ddproto_str_to_ints(ints, 4, ("tee " + std::to_string(i)).c_str()), DDPROTO_ERR_NONE);
+			EXPECT_EQ(ddproto_string_table_intern(&table, ints, 4, false, &err), i + 1);
+		}
+	}
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(table.len, 1000);
+	EXPECT_STREQ(ddproto_string_table_str(&table, 1), "tee 0");
+	EXPECT_STREQ(ddproto_string_table_str(&table, 1000), "tee 999");
+
+	ddproto_string_table_free(&table);
+}
+
+TEST(StringTable, Utf8) {
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+
+	// "a\xff"
+	uint32_t ints[] = {0xE17F8000};
+	DDProtoError err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints, 1, false, &err), 1);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints, 1, true, &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_INVALID_UTF8);
+
+	ddproto_string_table_free(&table);
+}
+
+TEST(StringTable, Full) {
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+	EXPECT_EQ(table.max_len, DDPROTO_STRING_TABLE_MAX_LEN);
+	table.max_len = 3;
+
+	uint32_t ints[4][1];
+	for(uint32_t i = 0; i < 4; i++) {
+		ints[i][0] = i;
+	}
+
+	DDProtoError err = DDPROTO_ERR_NONE;
+	for(uint32_t i = 0; i < 3; i++) {
+		EXPECT_EQ(ddproto_string_table_intern(&table, ints[i], 1, false, &err), i + 1);
+	}
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints[3], 1, false, &err), 0);
+	EXPECT_EQ(err, DDPROTO_ERR_STRING_TABLE_FULL);
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints[3], 1, false, nullptr), 0);
+	EXPECT_EQ(table.len, 3);
+	EXPECT_EQ(table.capacity, 3);
+
+	// strings that are already in the table are still found
+	err = DDPROTO_ERR_NONE;
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints[1], 1, false, &err), 2);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+
+	// clearing keeps the memory and starts the ids over
+	uint32_t *slots = table.slots;
+	ddproto_string_table_clear(&table);
+	EXPECT_EQ(table.len, 0);
+	EXPECT_EQ(table.slots, slots);
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints[3], 1, false, &err), 1);
+	EXPECT_EQ(ddproto_string_table_intern(&table, ints[0], 1, false, &err), 2);
+	EXPECT_EQ(err, DDPROTO_ERR_NONE);
+
+	ddproto_string_table_free(&table);
+}
+
+static void pack_client_info(DDProtoPacker *packer, int32_t id, const char *name, const char *skin) {
+	uint32_t name_ints[4];
+	uint32_t clan_ints[3];
+	uint32_t skin_ints[6];
+	ddproto_str_to_ints(name_ints, 4, name);
+	ddproto_str_to_ints(clan_ints, 3, "");
+	ddproto_str_to_ints(skin_ints, 6, skin);
+
+	ddproto_packer_add_int(packer, DDPROTO_ITEM_CLIENT_INFO);
+	ddproto_packer_add_int(packer, id);
+	ddproto_packer_add_ints(packer, (const int32_t *)name_ints, 4);
+	ddproto_packer_add_ints(packer, (const int32_t *)clan_ints, 3);
+	ddproto_packer_add_int(packer, -1);
+	ddproto_packer_add_ints(packer, (const int32_t *)skin_ints, 6);
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 65408);
+	ddproto_packer_add_int(packer, 65408);
+}
+
+TEST(StringTable, Snapshot) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	// no removed keys, two items and the unused zero field
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 2);
+	ddproto_packer_add_int(packer, 0);
+	pack_client_info(packer, 0, "nameless tee", "default");
+	pack_client_info(packer, 1, "brainless tee", "default");
+	ASSERT_EQ(packer->err, DDPROTO_ERR_NONE);
+
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+
+	DDProtoDecodeOptions options = {.string_table = &table};
+	DDProtoSnapshot snaps[2];
+	for(DDProtoSnapshot &snap : snaps) {
+		DDProtoUnpacker unpacker;
+		ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+		unpacker.options = &options;
+		ASSERT_EQ(ddproto_decode_snapshot(&unpacker, &snap), DDPROTO_ERR_NONE);
+		ASSERT_EQ(snap.items.len, 2);
+	}
+
+	const DDProtoObjClientInfo *first = &snaps[0].items.data[0].item.client_info;
+	const DDProtoObjClientInfo *second = &snaps[0].items.data[1].item.client_info;
+	EXPECT_TRUE(first->interned);
+	EXPECT_STREQ(ddproto_string_table_str(&table, first->name_id), "nameless tee");
+	EXPECT_STREQ(ddproto_string_table_str(&table, second->name_id), "brainless tee");
+	EXPECT_STREQ(ddproto_string_table_str(&table, first->clan_id), "");
+	EXPECT_EQ(first->country, -1);
+	EXPECT_EQ(first->skin_id, second->skin_id);
+	EXPECT_STREQ(ddproto_string_table_str(&table, first->skin_id), "default");
+	EXPECT_EQ(first->color_feet, 65408);
+
+	// the next snapshot refers to the same strings
+	const DDProtoObjClientInfo *next = &snaps[1].items.data[0].item.client_info;
+	EXPECT_EQ(next->name_id, first->name_id);
+	EXPECT_EQ(next->clan_id, first->clan_id);
+	EXPECT_EQ(next->skin_id, first->skin_id);
+	EXPECT_EQ(table.len, 4);
+
+	// without a table the strings are copied into the items
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	DDProtoSnapshot snap;
+	ASSERT_EQ(ddproto_decode_snapshot(&unpacker, &snap), DDPROTO_ERR_NONE);
+	EXPECT_STREQ(snap.items.data[1].item.client_info.name, "brainless tee");
+	EXPECT_FALSE(snap.items.data[1].item.client_info.interned);
+
+	ddproto_free_snapshot(&snap);
+	ddproto_free_snapshot(&snaps[0]);
+	ddproto_free_snapshot(&snaps[1]);
+	ddproto_string_table_free(&table);
+}
+
+TEST(StringTable, SnapshotFull) {
+	DDProtoPackerBuffer packer_buffer;
+	DDProtoPacker *packer = ddproto_packer_init(&packer_buffer);
+	ddproto_packer_add_int(packer, 0);
+	ddproto_packer_add_int(packer, 2);
+	ddproto_packer_add_int(packer, 0);
+	pack_client_info(packer, 0, "nameless tee", "default");
+	pack_client_info(packer, 1, "brainless tee", "default");
+	ASSERT_EQ(packer->err, DDPROTO_ERR_NONE);
+
+	// the name, clan and skin of the first item fit but not the second name
+	DDProtoStringTable table;
+	ddproto_string_table_init(&table);
+	table.max_len = 3;
+
+	DDProtoDecodeOptions options = {.string_table = &table};
+	DDProtoUnpacker unpacker;
+	ddproto_unpacker_init(&unpacker, ddproto_packer_data(packer), ddproto_packer_size(packer));
+	unpacker.options = &options;
+	DDProtoSnapshot snap;
+	EXPECT_EQ(ddproto_decode_snapshot(&unpacker, &snap), DDPROTO_ERR_STRING_TABLE_FULL);
+	EXPECT_EQ(table.len, 3);
+
+	ddproto_free_snapshot(&snap);
+	ddproto_string_table_free(&table);
+}